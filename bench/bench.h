@@ -0,0 +1,62 @@
+#ifndef ATTITUDE_BENCH_H
+#define ATTITUDE_BENCH_H
+
+/*
+ * Minimal micro-benchmark harness for the attitude library.
+ *
+ * A benchmark case is a function that performs `iterations` calls of the code under test. It
+ * reads its inputs from a small rotating table (BENCH_INPUT_COUNT entries) so the compiler
+ * cannot hoist the work out of the loop, and folds one output value per call into a local sum
+ * that is finally written to bench_sink so the calls cannot be discarded.
+ *
+ * Cases are grouped into suites (one per bench_*.c file); bench_main.c owns the registry of
+ * suites, the timing loop, the statistics, and the CSV/JSON output.
+ */
+
+#include <stddef.h>
+
+/* Power of two so that `index & BENCH_INPUT_MASK` selects an input. */
+#define BENCH_INPUT_COUNT 64u
+#define BENCH_INPUT_MASK (BENCH_INPUT_COUNT - 1u)
+
+typedef void (*BenchFn)(size_t iterations);
+
+typedef struct {
+    const char *name;
+    BenchFn run;
+    /* Operations performed per iteration (vectors per batch call, etc.); 1 for scalar calls. */
+    size_t ops_per_iteration;
+} BenchCase;
+
+typedef struct {
+    const char *name;
+    /* Fills the suite's input tables; called once before any of its cases run. */
+    void (*setup)(void);
+    const BenchCase *cases;
+    size_t case_count;
+} BenchSuite;
+
+/* Consumes benchmark results so the optimiser has to compute them. */
+extern volatile double bench_sink;
+
+/* Deterministic pseudo-random value in [-1, 1) for building input tables. */
+double bench_random(void);
+
+/* Fills q with a random unit quaternion. */
+void bench_random_quaternion(double q[4]);
+
+extern const BenchSuite bench_suite_core;
+extern const BenchSuite bench_suite_float;
+extern const BenchSuite bench_suite_batch;
+extern const BenchSuite bench_suite_kinematics;
+extern const BenchSuite bench_suite_interpolation;
+extern const BenchSuite bench_suite_wahba;
+extern const BenchSuite bench_suite_fixed;
+extern const BenchSuite bench_suite_inline;
+extern const BenchSuite bench_suite_ahrs;
+extern const BenchSuite bench_suite_mekf;
+extern const BenchSuite bench_suite_convert;
+extern const BenchSuite bench_suite_attitude_log;
+extern const BenchSuite bench_suite_quaternion_codec;
+
+#endif // ATTITUDE_BENCH_H
@@ -0,0 +1,170 @@
+/*
+ * Cost of one AHRS update (cycles_per_op is the per-update budget) and of replaying a recorded
+ * buffer. The naive case is the Mahony IMU update as callers wrote it on top of the public
+ * primitives: a quaternion inverse and rotation for the predicted gravity, vector3_normalize,
+ * an explicit derivative step and a full quaternion_normalize.
+ */
+#include "bench.h"
+
+#include <math.h>
+
+#include "attitude/ahrs.h"
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+/* One second of a 1 kHz IMU; replay cases report cost per sample. */
+#define AHRS_SAMPLES 1024
+#define AHRS_DT 0.001
+
+static double g_gyro[AHRS_SAMPLES * 3];
+static double g_accel[AHRS_SAMPLES * 3];
+static double g_mag[AHRS_SAMPLES * 3];
+static float g_gyrof[AHRS_SAMPLES * 3];
+static float g_accelf[AHRS_SAMPLES * 3];
+static float g_magf[AHRS_SAMPLES * 3];
+
+static void setup(void) {
+    for (size_t i = 0; i < AHRS_SAMPLES; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            g_gyro[3 * i + k] = 0.5 * bench_random();
+            g_accel[3 * i + k] = (k == 2 ? 9.81 : 0.0) + 0.3 * bench_random();
+            g_mag[3 * i + k] = (k == 0 ? 0.21 : (k == 2 ? -0.45 : 0.0)) + 0.02 * bench_random();
+            g_gyrof[3 * i + k] = (float)g_gyro[3 * i + k];
+            g_accelf[3 * i + k] = (float)g_accel[3 * i + k];
+            g_magf[3 * i + k] = (float)g_mag[3 * i + k];
+        }
+    }
+}
+
+static void naive_mahony_imu(double q[4], double integral[3], const double gyro[3], const double accel[3], double dt) {
+    const double kp = 1.0;
+    const double ki = 0.05;
+    const double up[3] = {0.0, 0.0, 1.0};
+    double a[3] = {accel[0], accel[1], accel[2]};
+    double q_inv[4];
+    double v[3];
+    double error[3];
+    vector3_normalize(a);
+    quaternion_inverse(q, q_inv);
+    quaternion_rotate_vector(q_inv, up, v);
+    vector3_cross(a, v, error);
+
+    double omega[4] = {0.0, 0.0, 0.0, 0.0};
+    for (int k = 0; k < 3; ++k) {
+        integral[k] += ki * error[k] * dt;
+        omega[k + 1] = gyro[k] + kp * error[k] + integral[k];
+    }
+    double q_dot[4];
+    quaternion_multiply(q, omega, q_dot);
+    for (int k = 0; k < 4; ++k) {
+        q[k] += 0.5 * q_dot[k] * dt;
+    }
+    quaternion_normalize(q);
+}
+
+static void bench_naive_mahony_imu(size_t iterations) {
+    double q[4] = {1.0, 0.0, 0.0, 0.0};
+    double integral[3] = {0.0, 0.0, 0.0};
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        naive_mahony_imu(q, integral, &g_gyro[s], &g_accel[s], AHRS_DT);
+    }
+    bench_sink = q[0];
+}
+
+static void bench_ahrs_mahony_update_imu(size_t iterations) {
+    MahonyFilter filter;
+    ahrs_mahony_init(&filter, NULL, 1.0, 0.05);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrs_mahony_update_imu(&filter, &g_gyro[s], &g_accel[s], AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrs_mahony_update_marg(size_t iterations) {
+    MahonyFilter filter;
+    ahrs_mahony_init(&filter, NULL, 1.0, 0.05);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrs_mahony_update_marg(&filter, &g_gyro[s], &g_accel[s], &g_mag[s], AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrs_madgwick_update_imu(size_t iterations) {
+    MadgwickFilter filter;
+    ahrs_madgwick_init(&filter, NULL, 0.1);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrs_madgwick_update_imu(&filter, &g_gyro[s], &g_accel[s], AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrs_madgwick_update_marg(size_t iterations) {
+    MadgwickFilter filter;
+    ahrs_madgwick_init(&filter, NULL, 0.1);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrs_madgwick_update_marg(&filter, &g_gyro[s], &g_accel[s], &g_mag[s], AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrsf_mahony_update_marg(size_t iterations) {
+    MahonyFilterf filter;
+    ahrsf_mahony_init(&filter, NULL, 1.0f, 0.05f);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrsf_mahony_update_marg(&filter, &g_gyrof[s], &g_accelf[s], &g_magf[s], (float)AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrsf_madgwick_update_marg(size_t iterations) {
+    MadgwickFilterf filter;
+    ahrsf_madgwick_init(&filter, NULL, 0.1f);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (AHRS_SAMPLES - 1));
+        ahrsf_madgwick_update_marg(&filter, &g_gyrof[s], &g_accelf[s], &g_magf[s], (float)AHRS_DT);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrs_mahony_replay_marg(size_t iterations) {
+    MahonyFilter filter;
+    ahrs_mahony_init(&filter, NULL, 1.0, 0.05);
+    for (size_t i = 0; i < iterations; ++i) {
+        ahrs_mahony_replay(&filter, g_gyro, g_accel, g_mag, AHRS_SAMPLES, AHRS_DT, NULL);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_ahrs_madgwick_replay_marg(size_t iterations) {
+    MadgwickFilter filter;
+    ahrs_madgwick_init(&filter, NULL, 0.1);
+    for (size_t i = 0; i < iterations; ++i) {
+        ahrs_madgwick_replay(&filter, g_gyro, g_accel, g_mag, AHRS_SAMPLES, AHRS_DT, NULL);
+    }
+    bench_sink = filter.q[0];
+}
+
+static const BenchCase k_cases[] = {
+    {"naive_mahony_imu", bench_naive_mahony_imu, 1},
+    {"ahrs_mahony_update_imu", bench_ahrs_mahony_update_imu, 1},
+    {"ahrs_mahony_update_marg", bench_ahrs_mahony_update_marg, 1},
+    {"ahrs_madgwick_update_imu", bench_ahrs_madgwick_update_imu, 1},
+    {"ahrs_madgwick_update_marg", bench_ahrs_madgwick_update_marg, 1},
+    {"ahrsf_mahony_update_marg", bench_ahrsf_mahony_update_marg, 1},
+    {"ahrsf_madgwick_update_marg", bench_ahrsf_madgwick_update_marg, 1},
+    {"ahrs_mahony_replay_marg", bench_ahrs_mahony_replay_marg, AHRS_SAMPLES},
+    {"ahrs_madgwick_replay_marg", bench_ahrs_madgwick_replay_marg, AHRS_SAMPLES},
+};
+
+const BenchSuite bench_suite_ahrs = {
+    "ahrs",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
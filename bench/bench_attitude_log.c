@@ -0,0 +1,122 @@
+/*
+ * Binary attitude log against the CSV it replaces (ops are records): writing through the
+ * block buffer, walking a log in memory and feeding the blocks to a batch function in place,
+ * and parsing the same records from CSV text with strtod.
+ */
+#include "bench.h"
+
+#include "attitude/attitude_log.h"
+#include "attitude/quaternion.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_RECORDS (1u << 16)
+#define LOG_BLOCK_RECORDS 1024u
+
+static double g_records[LOG_RECORDS][8];
+static double g_log[LOG_RECORDS * 8 + 4096];
+static size_t g_log_size;
+static unsigned char g_block[LOG_BLOCK_RECORDS * 64];
+static char g_csv[LOG_RECORDS * 200];
+static double g_rotvecs[LOG_BLOCK_RECORDS][3];
+
+static int memory_sink(void *context, const void *data, size_t size) {
+    size_t *used = (size_t *)context;
+    memcpy((unsigned char *)g_log + *used, data, size);
+    *used += size;
+    return 1;
+}
+
+static void write_log(void) {
+    AttitudeLogWriter writer;
+    g_log_size = 0;
+    attitude_log_writer_init(&writer, ATTITUDE_LOG_HAS_RATE, g_block, sizeof(g_block), memory_sink, &g_log_size);
+    for (size_t i = 0; i < LOG_RECORDS; ++i) {
+        attitude_log_writer_append(&writer, g_records[i][0], g_records[i] + 1, g_records[i] + 5);
+    }
+    attitude_log_writer_close(&writer);
+}
+
+static void setup(void) {
+    char *csv = g_csv;
+    for (size_t i = 0; i < LOG_RECORDS; ++i) {
+        double *r = g_records[i];
+        r[0] = 0.0025 * (double)i;
+        bench_random_quaternion(r + 1);
+        for (int k = 5; k < 8; ++k) {
+            r[k] = 3.0 * bench_random();
+        }
+        csv += sprintf(csv, "%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g\n", r[0], r[1], r[2], r[3], r[4], r[5],
+                       r[6], r[7]);
+    }
+    write_log();
+}
+
+static void bench_write(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        write_log();
+    }
+    bench_sink = (double)g_log_size;
+}
+
+/* Visits every timestamp and quaternion, as a replay that only needs the attitude would. */
+static void bench_read_binary(size_t iterations) {
+    double sum = 0.0;
+    for (size_t it = 0; it < iterations; ++it) {
+        AttitudeLogReader reader;
+        AttitudeLogBlock block;
+        attitude_log_reader_open_memory(&reader, g_log, g_log_size);
+        while (attitude_log_reader_next(&reader, &block)) {
+            for (size_t i = 0; i < block.count; ++i) {
+                sum += block.timestamps[i] + block.quaternions[4 * i];
+            }
+        }
+    }
+    bench_sink = sum;
+}
+
+/* The zero-copy path: blocks go straight into a batch function. */
+static void bench_read_binary_log_batch(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        AttitudeLogReader reader;
+        AttitudeLogBlock block;
+        attitude_log_reader_open_memory(&reader, g_log, g_log_size);
+        while (attitude_log_reader_next(&reader, &block)) {
+            quaternion_log_batch(block.quaternions, block.count, g_rotvecs[0]);
+        }
+    }
+    bench_sink = g_rotvecs[0][0];
+}
+
+static void bench_read_csv(size_t iterations) {
+    double sum = 0.0;
+    for (size_t it = 0; it < iterations; ++it) {
+        const char *p = g_csv;
+        for (size_t i = 0; i < LOG_RECORDS; ++i) {
+            double r[8];
+            for (int k = 0; k < 8; ++k) {
+                char *end;
+                r[k] = strtod(p, &end);
+                p = end + 1;
+            }
+            sum += r[0] + r[1];
+        }
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"write", bench_write, LOG_RECORDS},
+    {"read_binary", bench_read_binary, LOG_RECORDS},
+    {"read_binary_log_batch", bench_read_binary_log_batch, LOG_RECORDS},
+    {"read_csv", bench_read_csv, LOG_RECORDS},
+};
+
+const BenchSuite bench_suite_attitude_log = {
+    "attitude_log",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
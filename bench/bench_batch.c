@@ -0,0 +1,321 @@
+#include "bench.h"
+
+#include "attitude/average.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+#include "attitude/quaternion_soa.h"
+
+/* Large enough to amortise call overhead, small enough to stay in L1/L2. */
+#define BATCH_SIZE 1024
+
+static double g_q[4];
+static double g_vectors[BATCH_SIZE * 3];
+static double g_rotated[BATCH_SIZE * 3];
+
+static double g_soa_storage_a[QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE)];
+static double g_soa_storage_b[QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE)];
+static double g_soa_storage_out[QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE)];
+static QuaternionSoA g_soa_a;
+static QuaternionSoA g_soa_b;
+static QuaternionSoA g_soa_out;
+static double g_lanes[3][BATCH_SIZE];
+static double g_lanes_out[3][BATCH_SIZE];
+static double g_quaternions[BATCH_SIZE * 4];
+static EulerAngles g_angles[BATCH_SIZE];
+static double g_dcms[BATCH_SIZE * 9];
+static double g_dcm_lanes[9][BATCH_SIZE];
+static double g_dcms_out[BATCH_SIZE * 9];
+static double g_propagated[BATCH_SIZE * 4];
+/* Accumulators for the mean of a particle cloud (0.1 rad spread) and of uniform samples. */
+static QuaternionAverage g_cloud_average;
+static QuaternionAverage g_uniform_average;
+
+static void setup(void) {
+    double aos[BATCH_SIZE * 4];
+
+    bench_random_quaternion(g_q);
+    for (size_t i = 0; i < BATCH_SIZE * 3; ++i) {
+        g_vectors[i] = 10.0 * bench_random();
+    }
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        g_lanes[0][i] = g_vectors[3 * i];
+        g_lanes[1][i] = g_vectors[3 * i + 1];
+        g_lanes[2][i] = g_vectors[3 * i + 2];
+    }
+
+    quaternion_soa_init(&g_soa_a, g_soa_storage_a, QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE), BATCH_SIZE);
+    quaternion_soa_init(&g_soa_b, g_soa_storage_b, QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE), BATCH_SIZE);
+    quaternion_soa_init(&g_soa_out, g_soa_storage_out, QUATERNION_SOA_STORAGE_DOUBLES(BATCH_SIZE), BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        bench_random_quaternion(&aos[4 * i]);
+    }
+    quaternion_soa_from_aos(&g_soa_a, aos);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        bench_random_quaternion(&aos[4 * i]);
+    }
+    quaternion_soa_from_aos(&g_soa_b, aos);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        bench_random_quaternion(&g_quaternions[4 * i]);
+    }
+
+    for (size_t i = 0; i < BATCH_SIZE * 4; ++i) {
+        g_propagated[i] = g_quaternions[i] * (1.0 + 1e-7);
+    }
+
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        double dcm[3][3];
+        quaternion_to_dcm(&g_quaternions[4 * i], dcm);
+        for (int k = 0; k < 9; ++k) {
+            g_dcms[9 * i + k] = (&dcm[0][0])[k] + 1e-4 * bench_random();
+        }
+    }
+
+    double *const dcm_lanes[9] = {
+        g_dcm_lanes[0], g_dcm_lanes[1], g_dcm_lanes[2], g_dcm_lanes[3], g_dcm_lanes[4],
+        g_dcm_lanes[5], g_dcm_lanes[6], g_dcm_lanes[7], g_dcm_lanes[8]
+    };
+    quaternion_soa_to_dcm(&g_soa_a, dcm_lanes);
+
+    quaternion_average_init(&g_cloud_average);
+    quaternion_average_init(&g_uniform_average);
+    quaternion_average_push_batch(&g_uniform_average, g_quaternions, NULL, BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        double particle[4];
+        for (int k = 0; k < 4; ++k) {
+            particle[k] = g_q[k] + 0.05 * bench_random();
+        }
+        quaternion_average_push(&g_cloud_average, particle, 1.0);
+    }
+}
+
+static void bench_quaternion_rotate_vector_loop(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t v = 0; v < BATCH_SIZE; ++v) {
+            quaternion_rotate_vector(g_q, &g_vectors[3 * v], &g_rotated[3 * v]);
+        }
+    }
+    bench_sink = g_rotated[0];
+}
+
+static void bench_quaternion_rotate_vectors(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_rotate_vectors(g_q, g_vectors, g_rotated, BATCH_SIZE, 3);
+    }
+    bench_sink = g_rotated[0];
+}
+
+static void soa_multiply(size_t iterations, QuaternionSoaBackend backend) {
+    quaternion_soa_set_backend(backend);
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_soa_multiply(&g_soa_a, &g_soa_b, &g_soa_out);
+    }
+    quaternion_soa_set_backend(QUATERNION_SOA_BACKEND_AUTO);
+    bench_sink = g_soa_out.w[0];
+}
+
+static void soa_rotate(size_t iterations, QuaternionSoaBackend backend) {
+    const double *const in[3] = {g_lanes[0], g_lanes[1], g_lanes[2]};
+    double *const out[3] = {g_lanes_out[0], g_lanes_out[1], g_lanes_out[2]};
+
+    quaternion_soa_set_backend(backend);
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_soa_rotate(&g_soa_a, in, out);
+    }
+    quaternion_soa_set_backend(QUATERNION_SOA_BACKEND_AUTO);
+    bench_sink = g_lanes_out[0][0];
+}
+
+static void bench_quaternion_soa_multiply_scalar(size_t iterations) {
+    soa_multiply(iterations, QUATERNION_SOA_BACKEND_SCALAR);
+}
+
+static void bench_quaternion_soa_multiply(size_t iterations) {
+    soa_multiply(iterations, QUATERNION_SOA_BACKEND_AUTO);
+}
+
+static void bench_quaternion_soa_rotate_scalar(size_t iterations) {
+    soa_rotate(iterations, QUATERNION_SOA_BACKEND_SCALAR);
+}
+
+static void bench_quaternion_soa_rotate(size_t iterations) {
+    soa_rotate(iterations, QUATERNION_SOA_BACKEND_AUTO);
+}
+
+static void bench_quaternion_soa_normalize(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_soa_normalize(&g_soa_a);
+    }
+    bench_sink = g_soa_a.w[0];
+}
+
+/*
+ * Per-step renormalisation of a batch of propagated attitudes. After the first call the
+ * buffer is unit to rounding, the steady state of an integrator.
+ */
+static void bench_quaternion_normalize_loop(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t v = 0; v < BATCH_SIZE; ++v) {
+            quaternion_normalize(&g_propagated[4 * v]);
+        }
+    }
+    bench_sink = g_propagated[0];
+}
+
+static void bench_quaternion_renormalize_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_renormalize_batch(g_propagated, BATCH_SIZE);
+    }
+    bench_sink = g_propagated[0];
+}
+
+static void bench_euler_from_quaternion_loop(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t v = 0; v < BATCH_SIZE; ++v) {
+            euler_from_quaternion(&g_quaternions[4 * v], EULER_ZYX, &g_angles[v]);
+        }
+    }
+    bench_sink = g_angles[0].yaw;
+}
+
+static void bench_euler_from_quaternions(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        euler_from_quaternions(g_quaternions, BATCH_SIZE, EULER_ZYX, g_angles);
+    }
+    bench_sink = g_angles[0].yaw;
+}
+
+/* Random orientations, so the scalar conversion's four-way branch is unpredictable. */
+static void bench_dcm_to_quaternion_loop(size_t iterations) {
+    double q[4] = {0.0, 0.0, 0.0, 0.0};
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t v = 0; v < BATCH_SIZE; ++v) {
+            const double dcm[3][3] = {
+                {g_dcm_lanes[0][v], g_dcm_lanes[1][v], g_dcm_lanes[2][v]},
+                {g_dcm_lanes[3][v], g_dcm_lanes[4][v], g_dcm_lanes[5][v]},
+                {g_dcm_lanes[6][v], g_dcm_lanes[7][v], g_dcm_lanes[8][v]}
+            };
+            dcm_to_quaternion_unchecked(dcm, q);
+            g_soa_out.w[v] = q[0];
+        }
+    }
+    bench_sink = q[0];
+}
+
+static void soa_from_dcm(size_t iterations, QuaternionSoaBackend backend) {
+    const double *const lanes[9] = {
+        g_dcm_lanes[0], g_dcm_lanes[1], g_dcm_lanes[2], g_dcm_lanes[3], g_dcm_lanes[4],
+        g_dcm_lanes[5], g_dcm_lanes[6], g_dcm_lanes[7], g_dcm_lanes[8]
+    };
+
+    quaternion_soa_set_backend(backend);
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_soa_from_dcm(lanes, &g_soa_out);
+    }
+    quaternion_soa_set_backend(QUATERNION_SOA_BACKEND_AUTO);
+    bench_sink = g_soa_out.w[0];
+}
+
+static void bench_quaternion_soa_from_dcm_scalar(size_t iterations) {
+    soa_from_dcm(iterations, QUATERNION_SOA_BACKEND_SCALAR);
+}
+
+static void bench_quaternion_soa_from_dcm(size_t iterations) {
+    soa_from_dcm(iterations, QUATERNION_SOA_BACKEND_AUTO);
+}
+
+static void bench_dcm_orthonormalize_fast_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        dcm_orthonormalize_fast_batch(g_dcms, BATCH_SIZE, g_dcms_out);
+    }
+    bench_sink = g_dcms_out[0];
+}
+
+static void bench_dcm_orthonormalize_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        dcm_orthonormalize_batch(g_dcms, BATCH_SIZE, g_dcms_out);
+    }
+    bench_sink = g_dcms_out[0];
+}
+
+static void bench_quaternion_average_push_loop(size_t iterations) {
+    QuaternionAverage acc;
+    quaternion_average_init(&acc);
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t v = 0; v < BATCH_SIZE; ++v) {
+            quaternion_average_push(&acc, &g_quaternions[4 * v], 1.0);
+        }
+    }
+    bench_sink = acc.m[0][0];
+}
+
+static void bench_quaternion_average_push_batch(size_t iterations) {
+    QuaternionAverage acc;
+    quaternion_average_init(&acc);
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_average_push_batch(&acc, g_quaternions, NULL, BATCH_SIZE);
+    }
+    bench_sink = acc.m[0][0];
+}
+
+/* Solves cost the same for any sample count; these are per call. */
+static void bench_quaternion_average_eigen(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        quaternion_average_eigen(&g_cloud_average, q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_average_fast(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        quaternion_average_fast(&g_cloud_average, q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_average_fast_uniform(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        quaternion_average_fast(&g_uniform_average, q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternion_rotate_vector_loop", bench_quaternion_rotate_vector_loop, BATCH_SIZE},
+    {"quaternion_rotate_vectors", bench_quaternion_rotate_vectors, BATCH_SIZE},
+    {"quaternion_soa_multiply_scalar", bench_quaternion_soa_multiply_scalar, BATCH_SIZE},
+    {"quaternion_soa_multiply", bench_quaternion_soa_multiply, BATCH_SIZE},
+    {"quaternion_soa_rotate_scalar", bench_quaternion_soa_rotate_scalar, BATCH_SIZE},
+    {"quaternion_soa_rotate", bench_quaternion_soa_rotate, BATCH_SIZE},
+    {"quaternion_soa_normalize", bench_quaternion_soa_normalize, BATCH_SIZE},
+    {"quaternion_normalize_loop", bench_quaternion_normalize_loop, BATCH_SIZE},
+    {"quaternion_renormalize_batch", bench_quaternion_renormalize_batch, BATCH_SIZE},
+    {"euler_from_quaternion_loop", bench_euler_from_quaternion_loop, BATCH_SIZE},
+    {"euler_from_quaternions", bench_euler_from_quaternions, BATCH_SIZE},
+    {"dcm_to_quaternion_loop", bench_dcm_to_quaternion_loop, BATCH_SIZE},
+    {"quaternion_soa_from_dcm_scalar", bench_quaternion_soa_from_dcm_scalar, BATCH_SIZE},
+    {"quaternion_soa_from_dcm", bench_quaternion_soa_from_dcm, BATCH_SIZE},
+    {"dcm_orthonormalize_fast_batch", bench_dcm_orthonormalize_fast_batch, BATCH_SIZE},
+    {"dcm_orthonormalize_batch", bench_dcm_orthonormalize_batch, BATCH_SIZE},
+    {"quaternion_average_push_loop", bench_quaternion_average_push_loop, BATCH_SIZE},
+    {"quaternion_average_push_batch", bench_quaternion_average_push_batch, BATCH_SIZE},
+    {"quaternion_average_eigen", bench_quaternion_average_eigen, 1},
+    {"quaternion_average_fast", bench_quaternion_average_fast, 1},
+    {"quaternion_average_fast_uniform", bench_quaternion_average_fast_uniform, 1},
+};
+
+const BenchSuite bench_suite_batch = {
+    "batch",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
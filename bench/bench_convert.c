@@ -0,0 +1,93 @@
+/*
+ * Throughput of attitude_convert() over a buffer larger than the last-level cache, against the
+ * plain loop over the checked scalar conversion it replaces (ops are elements). The pool uses
+ * every online CPU, so its speed-up over the serial case depends on the machine; with one
+ * logical CPU it only shows the chunking and scheduling overhead.
+ */
+#include "bench.h"
+
+#include "attitude/convert.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+#define CONVERT_COUNT (1u << 17)
+
+static double g_quaternions[CONVERT_COUNT][4];
+static double g_dcms[CONVERT_COUNT][3][3];
+static EulerAngles g_euler[CONVERT_COUNT];
+static double g_q_out[CONVERT_COUNT][4];
+static unsigned char g_mask[ATTITUDE_CONVERT_MASK_BYTES(CONVERT_COUNT)];
+static AttitudeThreadPool *g_pool;
+
+static void setup(void) {
+    for (size_t i = 0; i < CONVERT_COUNT; ++i) {
+        bench_random_quaternion(g_quaternions[i]);
+        quaternion_to_dcm(g_quaternions[i], g_dcms[i]);
+    }
+    if (g_pool == NULL) {
+        g_pool = attitude_thread_pool_create(0);
+    }
+}
+
+static void bench_loop_euler_from_quaternion(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        for (size_t i = 0; i < CONVERT_COUNT; ++i) {
+            euler_from_quaternion_checked(g_quaternions[i], EULER_ZYX, &g_euler[i]);
+        }
+    }
+    bench_sink = g_euler[CONVERT_COUNT - 1].yaw;
+}
+
+static void run_conversion(AttitudeConversionKind kind, const void *src, void *dst, int threaded, size_t iterations) {
+    const AttitudeExecutor pool = attitude_thread_pool_executor(g_pool);
+    const AttitudeConversion conversion = {kind, EULER_ZYX, src, dst, CONVERT_COUNT, g_mask, 0};
+    for (size_t it = 0; it < iterations; ++it) {
+        attitude_convert(&conversion, threaded ? &pool : NULL);
+    }
+}
+
+static void bench_convert_quaternion_to_euler(size_t iterations) {
+    run_conversion(ATTITUDE_CONVERT_QUATERNION_TO_EULER, g_quaternions, g_euler, 0, iterations);
+    bench_sink = g_euler[CONVERT_COUNT - 1].yaw;
+}
+
+static void bench_convert_quaternion_to_euler_pool(size_t iterations) {
+    run_conversion(ATTITUDE_CONVERT_QUATERNION_TO_EULER, g_quaternions, g_euler, 1, iterations);
+    bench_sink = g_euler[CONVERT_COUNT - 1].yaw;
+}
+
+static void bench_loop_dcm_to_quaternion(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        for (size_t i = 0; i < CONVERT_COUNT; ++i) {
+            dcm_to_quaternion_checked((const double (*)[3])g_dcms[i], g_q_out[i]);
+        }
+    }
+    bench_sink = g_q_out[CONVERT_COUNT - 1][0];
+}
+
+static void bench_convert_dcm_to_quaternion(size_t iterations) {
+    run_conversion(ATTITUDE_CONVERT_DCM_TO_QUATERNION, g_dcms, g_q_out, 0, iterations);
+    bench_sink = g_q_out[CONVERT_COUNT - 1][0];
+}
+
+static void bench_convert_dcm_to_quaternion_pool(size_t iterations) {
+    run_conversion(ATTITUDE_CONVERT_DCM_TO_QUATERNION, g_dcms, g_q_out, 1, iterations);
+    bench_sink = g_q_out[CONVERT_COUNT - 1][0];
+}
+
+static const BenchCase k_cases[] = {
+    {"loop_euler_from_quaternion", bench_loop_euler_from_quaternion, CONVERT_COUNT},
+    {"convert_quaternion_to_euler", bench_convert_quaternion_to_euler, CONVERT_COUNT},
+    {"convert_quaternion_to_euler_pool", bench_convert_quaternion_to_euler_pool, CONVERT_COUNT},
+    {"loop_dcm_to_quaternion", bench_loop_dcm_to_quaternion, CONVERT_COUNT},
+    {"convert_dcm_to_quaternion", bench_convert_dcm_to_quaternion, CONVERT_COUNT},
+    {"convert_dcm_to_quaternion_pool", bench_convert_dcm_to_quaternion_pool, CONVERT_COUNT},
+};
+
+const BenchSuite bench_suite_convert = {
+    "convert",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
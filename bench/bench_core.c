@@ -0,0 +1,551 @@
+#include "bench.h"
+
+#include "attitude/attitude_utils.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+static double g_q[BENCH_INPUT_COUNT][4];
+static double g_q2[BENCH_INPUT_COUNT][4];
+static double g_v[BENCH_INPUT_COUNT][3];
+static double g_axis[BENCH_INPUT_COUNT][3];
+static double g_angle[BENCH_INPUT_COUNT];
+static double g_t[BENCH_INPUT_COUNT];
+static double g_rotvec[BENCH_INPUT_COUNT][3];
+static double g_dcm[BENCH_INPUT_COUNT][3][3];
+static double g_dcm_drifted[BENCH_INPUT_COUNT][3][3];
+static EulerAngles g_euler[BENCH_INPUT_COUNT];
+
+static void setup(void) {
+    for (size_t i = 0; i < BENCH_INPUT_COUNT; ++i) {
+        bench_random_quaternion(g_q[i]);
+        bench_random_quaternion(g_q2[i]);
+        for (int k = 0; k < 3; ++k) {
+            g_v[i][k] = 10.0 * bench_random();
+        }
+        g_axis[i][0] = g_q2[i][1];
+        g_axis[i][1] = g_q2[i][2];
+        g_axis[i][2] = g_q2[i][3];
+        vector3_normalize(g_axis[i]);
+        g_angle[i] = ATTITUDE_PI * bench_random();
+        g_t[i] = 0.5 + 0.5 * bench_random();
+        for (int k = 0; k < 3; ++k) {
+            g_rotvec[i][k] = g_axis[i][k] * g_angle[i];
+        }
+        quaternion_to_dcm(g_q[i], g_dcm[i]);
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                g_dcm_drifted[i][r][c] = g_dcm[i][r][c] + 1e-4 * bench_random();
+            }
+        }
+        g_euler[i].roll = ATTITUDE_PI * bench_random();
+        g_euler[i].pitch = 0.49 * ATTITUDE_PI * bench_random();
+        g_euler[i].yaw = ATTITUDE_PI * bench_random();
+        g_euler[i].order = EULER_ZYX;
+    }
+}
+
+/* Quaternion */
+
+static void bench_quaternion_multiply(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[4];
+        quaternion_multiply(g_q[i & BENCH_INPUT_MASK], g_q2[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_normalize(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *q = g_q[i & BENCH_INPUT_MASK];
+        double scaled[4] = {q[0] * 1.5, q[1] * 1.5, q[2] * 1.5, q[3] * 1.5};
+        quaternion_normalize(scaled);
+        sum += scaled[0];
+    }
+    bench_sink = sum;
+}
+
+/* Integrator steady state: the norm is off by rounding-level drift, not by 50%. */
+static void bench_quaternion_normalize_near_unit(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *q = g_q[i & BENCH_INPUT_MASK];
+        const double drift = 1.0 + 1e-7;
+        double scaled[4] = {q[0] * drift, q[1] * drift, q[2] * drift, q[3] * drift};
+        quaternion_normalize(scaled);
+        sum += scaled[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_renormalize(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *q = g_q[i & BENCH_INPUT_MASK];
+        const double drift = 1.0 + 1e-7;
+        double scaled[4] = {q[0] * drift, q[1] * drift, q[2] * drift, q[3] * drift};
+        quaternion_renormalize(scaled);
+        sum += scaled[0];
+    }
+    bench_sink = sum;
+}
+
+/* Outside the series range: the exact fallback. */
+static void bench_quaternion_renormalize_far(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *q = g_q[i & BENCH_INPUT_MASK];
+        double scaled[4] = {q[0] * 1.5, q[1] * 1.5, q[2] * 1.5, q[3] * 1.5};
+        quaternion_renormalize(scaled);
+        sum += scaled[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_inverse(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[4];
+        sum += quaternion_inverse(g_q[i & BENCH_INPUT_MASK], out);
+        sum += out[1];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_relative(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[4];
+        sum += quaternion_relative(g_q[i & BENCH_INPUT_MASK], g_q2[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_orientation_error_axis_angle(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double axis[3];
+        double angle;
+        quaternion_orientation_error_axis_angle(g_q[i & BENCH_INPUT_MASK],
+                                                g_q2[i & BENCH_INPUT_MASK], axis, &angle);
+        sum += angle;
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_to_axis_angle(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double axis[3];
+        double angle;
+        quaternion_to_axis_angle(g_q[i & BENCH_INPUT_MASK], axis, &angle);
+        sum += angle;
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_exp(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        quaternion_exp(g_rotvec[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_log(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double rotvec[3];
+        sum += quaternion_log(g_q[i & BENCH_INPUT_MASK], rotvec);
+        sum += rotvec[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_rotvec_to_dcm(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double dcm[3][3];
+        rotvec_to_dcm(g_rotvec[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[1][2];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_to_dcm(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double dcm[3][3];
+        quaternion_to_dcm(g_q[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[1][2];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_to_euler(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double roll, pitch, yaw;
+        quaternion_to_euler(g_q[i & BENCH_INPUT_MASK], &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_slerp(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[4];
+        quaternion_slerp(g_q[i & BENCH_INPUT_MASK], g_q2[i & BENCH_INPUT_MASK],
+                         g_t[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_rotate_vector(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        quaternion_rotate_vector(g_q[i & BENCH_INPUT_MASK], g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_rotate_vector_explicit(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        quaternion_rotate_vector_explicit(g_q[i & BENCH_INPUT_MASK], g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_axis_angle_rotate(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        axis_angle_rotate(g_axis[i & BENCH_INPUT_MASK], g_angle[i & BENCH_INPUT_MASK],
+                          g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+/* DCM */
+
+static void bench_dcm_to_quaternion(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        dcm_to_quaternion((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_to_quaternion_checked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        sum += dcm_to_quaternion_checked((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_to_quaternion_unchecked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        dcm_to_quaternion_unchecked((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_to_euler(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double roll, pitch, yaw;
+        dcm_to_euler((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_to_euler_checked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double roll, pitch, yaw;
+        sum += dcm_to_euler_checked((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK],
+                                    &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_to_euler_unchecked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double roll, pitch, yaw;
+        dcm_to_euler_unchecked((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_is_orthonormal(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sum += dcm_is_orthonormal((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK],
+                                  ATTITUDE_DCM_ORTHONORMAL_TOL);
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_is_rotation_fast(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sum += dcm_is_rotation_fast((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK],
+                                    ATTITUDE_DCM_ORTHONORMAL_TOL);
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_orthonormalize_fast(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3][3];
+        dcm_orthonormalize_fast((const double (*)[3])g_dcm_drifted[i & BENCH_INPUT_MASK], out);
+        sum += out[1][2];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_orthonormalize(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3][3];
+        dcm_orthonormalize((const double (*)[3])g_dcm_drifted[i & BENCH_INPUT_MASK], out);
+        sum += out[1][2];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcm_apply(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        dcm_apply((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+/* Euler */
+
+static void bench_euler_to_dcm(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double dcm[3][3];
+        euler_to_dcm(&g_euler[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[0][1];
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_to_dcm_checked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double dcm[3][3];
+        sum += euler_to_dcm_checked(&g_euler[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[0][1];
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_to_quaternion(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        euler_to_quaternion(&g_euler[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_to_quaternion_checked(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        sum += euler_to_quaternion_checked(&g_euler[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_to_dcm_zyz(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        EulerAngles e = g_euler[i & BENCH_INPUT_MASK];
+        double dcm[3][3];
+        e.order = EULER_ZYZ;
+        euler_to_dcm(&e, dcm);
+        sum += dcm[0][1];
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_from_dcm_zyx(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        EulerAngles e;
+        euler_from_dcm((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], EULER_ZYX, &e);
+        sum += e.roll + e.pitch + e.yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_from_dcm_zyz(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        EulerAngles e;
+        euler_from_dcm((const double (*)[3])g_dcm[i & BENCH_INPUT_MASK], EULER_ZYZ, &e);
+        sum += e.roll + e.pitch + e.yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_from_quaternion_zyx(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        EulerAngles e;
+        euler_from_quaternion(g_q[i & BENCH_INPUT_MASK], EULER_ZYX, &e);
+        sum += e.roll + e.pitch + e.yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_euler_from_quaternion_zyz(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        EulerAngles e;
+        euler_from_quaternion(g_q[i & BENCH_INPUT_MASK], EULER_ZYZ, &e);
+        sum += e.roll + e.pitch + e.yaw;
+    }
+    bench_sink = sum;
+}
+
+/* Vector and utility helpers */
+
+static void bench_vector3_cross(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        vector3_cross(g_v[i & BENCH_INPUT_MASK], g_axis[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_vector3_dot(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sum += vector3_dot(g_v[i & BENCH_INPUT_MASK], g_axis[i & BENCH_INPUT_MASK]);
+    }
+    bench_sink = sum;
+}
+
+static void bench_vector3_normalize(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *v = g_v[i & BENCH_INPUT_MASK];
+        double copy[3] = {v[0], v[1], v[2]};
+        vector3_normalize(copy);
+        sum += copy[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_vector3_renormalize(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *axis = g_axis[i & BENCH_INPUT_MASK];
+        const double drift = 1.0 - 1e-7;
+        double copy[3] = {axis[0] * drift, axis[1] * drift, axis[2] * drift};
+        vector3_renormalize(copy);
+        sum += copy[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_wrap_angle(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sum += wrap_angle(4.0 * g_angle[i & BENCH_INPUT_MASK]);
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternion_multiply", bench_quaternion_multiply, 1},
+    {"quaternion_normalize", bench_quaternion_normalize, 1},
+    {"quaternion_normalize_near_unit", bench_quaternion_normalize_near_unit, 1},
+    {"quaternion_renormalize", bench_quaternion_renormalize, 1},
+    {"quaternion_renormalize_far", bench_quaternion_renormalize_far, 1},
+    {"quaternion_inverse", bench_quaternion_inverse, 1},
+    {"quaternion_relative", bench_quaternion_relative, 1},
+    {"quaternion_orientation_error_axis_angle", bench_quaternion_orientation_error_axis_angle, 1},
+    {"quaternion_to_axis_angle", bench_quaternion_to_axis_angle, 1},
+    {"quaternion_exp", bench_quaternion_exp, 1},
+    {"quaternion_log", bench_quaternion_log, 1},
+    {"rotvec_to_dcm", bench_rotvec_to_dcm, 1},
+    {"quaternion_to_dcm", bench_quaternion_to_dcm, 1},
+    {"quaternion_to_euler", bench_quaternion_to_euler, 1},
+    {"quaternion_slerp", bench_quaternion_slerp, 1},
+    {"quaternion_rotate_vector", bench_quaternion_rotate_vector, 1},
+    {"quaternion_rotate_vector_explicit", bench_quaternion_rotate_vector_explicit, 1},
+    {"axis_angle_rotate", bench_axis_angle_rotate, 1},
+    {"dcm_to_quaternion", bench_dcm_to_quaternion, 1},
+    {"dcm_to_quaternion_checked", bench_dcm_to_quaternion_checked, 1},
+    {"dcm_to_quaternion_unchecked", bench_dcm_to_quaternion_unchecked, 1},
+    {"dcm_to_euler", bench_dcm_to_euler, 1},
+    {"dcm_to_euler_checked", bench_dcm_to_euler_checked, 1},
+    {"dcm_to_euler_unchecked", bench_dcm_to_euler_unchecked, 1},
+    {"dcm_is_orthonormal", bench_dcm_is_orthonormal, 1},
+    {"dcm_is_rotation_fast", bench_dcm_is_rotation_fast, 1},
+    {"dcm_orthonormalize_fast", bench_dcm_orthonormalize_fast, 1},
+    {"dcm_orthonormalize", bench_dcm_orthonormalize, 1},
+    {"dcm_apply", bench_dcm_apply, 1},
+    {"euler_to_dcm", bench_euler_to_dcm, 1},
+    {"euler_to_dcm_checked", bench_euler_to_dcm_checked, 1},
+    {"euler_to_quaternion", bench_euler_to_quaternion, 1},
+    {"euler_to_quaternion_checked", bench_euler_to_quaternion_checked, 1},
+    {"euler_to_dcm_zyz", bench_euler_to_dcm_zyz, 1},
+    {"euler_from_dcm_zyx", bench_euler_from_dcm_zyx, 1},
+    {"euler_from_dcm_zyz", bench_euler_from_dcm_zyz, 1},
+    {"euler_from_quaternion_zyx", bench_euler_from_quaternion_zyx, 1},
+    {"euler_from_quaternion_zyz", bench_euler_from_quaternion_zyz, 1},
+    {"vector3_cross", bench_vector3_cross, 1},
+    {"vector3_dot", bench_vector3_dot, 1},
+    {"vector3_normalize", bench_vector3_normalize, 1},
+    {"vector3_renormalize", bench_vector3_renormalize, 1},
+    {"wrap_angle", bench_wrap_angle, 1},
+};
+
+const BenchSuite bench_suite_core = {
+    "core",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
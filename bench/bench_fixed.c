@@ -0,0 +1,119 @@
+#include "bench.h"
+
+#include <stdint.h>
+
+#include "attitude/fixed_point.h"
+#include "attitude/quaternion.h"
+
+/*
+ * Q1.30 integer API against the double functions it mirrors. On a host with an FPU the double
+ * path is expected to win; the point of these cases is the relative cost of each operation and
+ * catching regressions. On an FPU-less core the ratio inverts.
+ */
+static double g_q[BENCH_INPUT_COUNT][4];
+static double g_p[BENCH_INPUT_COUNT][4];
+static double g_v[BENCH_INPUT_COUNT][3];
+static int32_t g_q30[BENCH_INPUT_COUNT][4];
+static int32_t g_p30[BENCH_INPUT_COUNT][4];
+static int32_t g_drifted30[BENCH_INPUT_COUNT][4];
+static int32_t g_v30[BENCH_INPUT_COUNT][3];
+
+static void setup(void) {
+    for (size_t i = 0; i < BENCH_INPUT_COUNT; ++i) {
+        bench_random_quaternion(g_q[i]);
+        bench_random_quaternion(g_p[i]);
+        quaternion_q30_from_double(g_q[i], g_q30[i]);
+        quaternion_q30_from_double(g_p[i], g_p30[i]);
+        double drifted[4];
+        const double scale = 1.0 + 1e-3 * bench_random();
+        for (int k = 0; k < 4; ++k) {
+            drifted[k] = g_q[i][k] * scale;
+        }
+        quaternion_q30_from_double(drifted, g_drifted30[i]);
+        for (int k = 0; k < 3; ++k) {
+            g_v[i][k] = bench_random();
+            g_v30[i][k] = (int32_t)(g_v[i][k] * (double)ATTITUDE_Q30_ONE);
+        }
+    }
+}
+
+static void bench_quaternion_q30_multiply(size_t iterations) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        int32_t out[4];
+        quaternion_q30_multiply(g_q30[i & BENCH_INPUT_MASK], g_p30[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = (double)sum;
+}
+
+static void bench_quaternion_multiply_reference(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[4];
+        quaternion_multiply(g_q[i & BENCH_INPUT_MASK], g_p[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_q30_normalize(size_t iterations) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        int32_t q[4];
+        const int32_t *in = g_drifted30[i & BENCH_INPUT_MASK];
+        q[0] = in[0];
+        q[1] = in[1];
+        q[2] = in[2];
+        q[3] = in[3];
+        quaternion_q30_normalize(q);
+        sum += q[0];
+    }
+    bench_sink = (double)sum;
+}
+
+static void bench_quaternion_q30_to_dcm(size_t iterations) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        int32_t dcm[3][3];
+        quaternion_q30_to_dcm(g_q30[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[0][0] + dcm[2][1];
+    }
+    bench_sink = (double)sum;
+}
+
+static void bench_quaternion_q30_rotate_vector(size_t iterations) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        int32_t out[3];
+        quaternion_q30_rotate_vector(g_q30[i & BENCH_INPUT_MASK], g_v30[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = (double)sum;
+}
+
+static void bench_quaternion_rotate_vector_reference(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double out[3];
+        quaternion_rotate_vector(g_q[i & BENCH_INPUT_MASK], g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternion_q30_multiply", bench_quaternion_q30_multiply, 1},
+    {"quaternion_multiply_reference", bench_quaternion_multiply_reference, 1},
+    {"quaternion_q30_normalize", bench_quaternion_q30_normalize, 1},
+    {"quaternion_q30_to_dcm", bench_quaternion_q30_to_dcm, 1},
+    {"quaternion_q30_rotate_vector", bench_quaternion_q30_rotate_vector, 1},
+    {"quaternion_rotate_vector_reference", bench_quaternion_rotate_vector_reference, 1},
+};
+
+const BenchSuite bench_suite_fixed = {
+    "fixed",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
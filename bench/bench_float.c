@@ -0,0 +1,158 @@
+#include "bench.h"
+
+#include "attitude/attitude_utils.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+static float g_q[BENCH_INPUT_COUNT][4];
+static float g_q2[BENCH_INPUT_COUNT][4];
+static float g_v[BENCH_INPUT_COUNT][3];
+static float g_t[BENCH_INPUT_COUNT];
+static float g_dcm[BENCH_INPUT_COUNT][3][3];
+static EulerAnglesf g_euler[BENCH_INPUT_COUNT];
+
+static void setup(void) {
+    for (size_t i = 0; i < BENCH_INPUT_COUNT; ++i) {
+        double q[4];
+        double q2[4];
+        bench_random_quaternion(q);
+        bench_random_quaternion(q2);
+        for (int k = 0; k < 4; ++k) {
+            g_q[i][k] = (float)q[k];
+            g_q2[i][k] = (float)q2[k];
+        }
+        for (int k = 0; k < 3; ++k) {
+            g_v[i][k] = (float)(10.0 * bench_random());
+        }
+        g_t[i] = (float)(0.5 + 0.5 * bench_random());
+        quaternionf_to_dcm(g_q[i], g_dcm[i]);
+        g_euler[i].roll = (float)(ATTITUDE_PI * bench_random());
+        g_euler[i].pitch = (float)(0.49 * ATTITUDE_PI * bench_random());
+        g_euler[i].yaw = (float)(ATTITUDE_PI * bench_random());
+        g_euler[i].order = EULER_ZYX;
+    }
+}
+
+static void bench_quaternionf_multiply(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float out[4];
+        quaternionf_multiply(g_q[i & BENCH_INPUT_MASK], g_q2[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternionf_normalize(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        const float *q = g_q[i & BENCH_INPUT_MASK];
+        float scaled[4] = {q[0] * 1.5f, q[1] * 1.5f, q[2] * 1.5f, q[3] * 1.5f};
+        quaternionf_normalize(scaled);
+        sum += scaled[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternionf_to_dcm(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float dcm[3][3];
+        quaternionf_to_dcm(g_q[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[1][2];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternionf_to_euler(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float roll, pitch, yaw;
+        quaternionf_to_euler(g_q[i & BENCH_INPUT_MASK], &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternionf_slerp(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float out[4];
+        quaternionf_slerp(g_q[i & BENCH_INPUT_MASK], g_q2[i & BENCH_INPUT_MASK],
+                          g_t[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternionf_rotate_vector(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float out[3];
+        quaternionf_rotate_vector(g_q[i & BENCH_INPUT_MASK], g_v[i & BENCH_INPUT_MASK], out);
+        sum += out[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcmf_to_quaternion_checked(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float q[4];
+        sum += (float)dcmf_to_quaternion_checked((const float (*)[3])g_dcm[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_dcmf_to_euler_checked(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float roll, pitch, yaw;
+        sum += (float)dcmf_to_euler_checked((const float (*)[3])g_dcm[i & BENCH_INPUT_MASK],
+                                            &roll, &pitch, &yaw);
+        sum += roll + pitch + yaw;
+    }
+    bench_sink = sum;
+}
+
+static void bench_eulerf_to_dcm_checked(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float dcm[3][3];
+        sum += (float)eulerf_to_dcm_checked(&g_euler[i & BENCH_INPUT_MASK], dcm);
+        sum += dcm[0][1];
+    }
+    bench_sink = sum;
+}
+
+static void bench_eulerf_to_quaternion_checked(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float q[4];
+        sum += (float)eulerf_to_quaternion_checked(&g_euler[i & BENCH_INPUT_MASK], q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternionf_multiply", bench_quaternionf_multiply, 1},
+    {"quaternionf_normalize", bench_quaternionf_normalize, 1},
+    {"quaternionf_to_dcm", bench_quaternionf_to_dcm, 1},
+    {"quaternionf_to_euler", bench_quaternionf_to_euler, 1},
+    {"quaternionf_slerp", bench_quaternionf_slerp, 1},
+    {"quaternionf_rotate_vector", bench_quaternionf_rotate_vector, 1},
+    {"dcmf_to_quaternion_checked", bench_dcmf_to_quaternion_checked, 1},
+    {"dcmf_to_euler_checked", bench_dcmf_to_euler_checked, 1},
+    {"eulerf_to_dcm_checked", bench_eulerf_to_dcm_checked, 1},
+    {"eulerf_to_quaternion_checked", bench_eulerf_to_quaternion_checked, 1},
+};
+
+const BenchSuite bench_suite_float = {
+    "float",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,137 @@
+/*
+ * Loop throughput of the hot-path kernels called through the library versus expanded from
+ * include/attitude/{quaternion,dcm,vector3}_inline.h by ATTITUDE_INLINE. Both variants live in
+ * this file: with the macros in force, a parenthesised name, (quaternion_multiply)(...), still
+ * calls the library.
+ * Every pass updates its arrays in place (or ping-pongs between two), so a pass depends on the
+ * previous one and the compiler cannot collapse the repetitions of an inlined loop.
+ */
+#define ATTITUDE_INLINE
+
+#include "bench.h"
+
+#include "attitude/dcm.h"
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+#define LOOP_SIZE 1024u
+
+static double g_a[LOOP_SIZE][4];
+static double g_b[LOOP_SIZE][4];
+static double g_v[LOOP_SIZE][3];
+static double g_w[LOOP_SIZE][3];
+static double g_rotated[LOOP_SIZE][3];
+static double g_applied[2][LOOP_SIZE][3];
+static double g_q[4];
+static double g_dcm[3][3];
+
+static void setup(void) {
+    for (size_t i = 0; i < LOOP_SIZE; ++i) {
+        bench_random_quaternion(g_a[i]);
+        bench_random_quaternion(g_b[i]);
+        for (int k = 0; k < 3; ++k) {
+            g_v[i][k] = bench_random();
+            g_w[i][k] = bench_random();
+            g_rotated[i][k] = g_v[i][k];
+            g_applied[0][i][k] = g_v[i][k];
+        }
+    }
+    bench_random_quaternion(g_q);
+    (quaternion_to_dcm)(g_q, g_dcm);
+}
+
+static void bench_multiply_library(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            (quaternion_multiply)(g_a[n], g_b[n], g_a[n]);
+        }
+    }
+    bench_sink = g_a[0][0];
+}
+
+static void bench_multiply_inline(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            quaternion_multiply(g_a[n], g_b[n], g_a[n]);
+        }
+    }
+    bench_sink = g_a[0][0];
+}
+
+static void bench_rotate_vector_library(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            (quaternion_rotate_vector)(g_q, g_rotated[n], g_rotated[n]);
+        }
+    }
+    bench_sink = g_rotated[0][0];
+}
+
+static void bench_rotate_vector_inline(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            quaternion_rotate_vector(g_q, g_rotated[n], g_rotated[n]);
+        }
+    }
+    bench_sink = g_rotated[0][0];
+}
+
+static void bench_dcm_apply_library(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        double (*const in)[3] = g_applied[i & 1];
+        double (*const out)[3] = g_applied[(i + 1) & 1];
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            (dcm_apply)((const double (*)[3])g_dcm, in[n], out[n]);
+        }
+    }
+    bench_sink = g_applied[0][0][0];
+}
+
+static void bench_dcm_apply_inline(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        double (*const in)[3] = g_applied[i & 1];
+        double (*const out)[3] = g_applied[(i + 1) & 1];
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            dcm_apply((const double (*)[3])g_dcm, in[n], out[n]);
+        }
+    }
+    bench_sink = g_applied[0][0][0];
+}
+
+static void bench_vector3_dot_library(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            sum += (vector3_dot)(g_v[n], g_w[n]);
+        }
+    }
+    bench_sink = sum;
+}
+
+static void bench_vector3_dot_inline(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < LOOP_SIZE; ++n) {
+            sum += vector3_dot(g_v[n], g_w[n]);
+        }
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternion_multiply_library", bench_multiply_library, LOOP_SIZE},
+    {"quaternion_multiply_inline", bench_multiply_inline, LOOP_SIZE},
+    {"quaternion_rotate_vector_library", bench_rotate_vector_library, LOOP_SIZE},
+    {"quaternion_rotate_vector_inline", bench_rotate_vector_inline, LOOP_SIZE},
+    {"dcm_apply_library", bench_dcm_apply_library, LOOP_SIZE},
+    {"dcm_apply_inline", bench_dcm_apply_inline, LOOP_SIZE},
+    {"vector3_dot_library", bench_vector3_dot_library, LOOP_SIZE},
+    {"vector3_dot_inline", bench_vector3_dot_inline, LOOP_SIZE},
+};
+
+const BenchSuite bench_suite_inline = {
+    "inline",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
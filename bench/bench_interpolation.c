@@ -0,0 +1,203 @@
+#include "bench.h"
+
+#include "attitude/quaternion.h"
+#include "attitude/slerp.h"
+#include "attitude/spline.h"
+
+/* One second of a 50 Hz attitude log upsampled to 1 kHz: cases report cost per output sample. */
+#define KEY_COUNT 51
+#define UPSAMPLE_FACTOR 20
+#define OUTPUT_COUNT ((KEY_COUNT - 1) * UPSAMPLE_FACTOR + 1)
+
+static double g_keys[KEY_COUNT * 4];
+static double g_output[OUTPUT_COUNT * 4];
+static float g_keysf[KEY_COUNT * 4];
+static float g_outputf[OUTPUT_COUNT * 4];
+static SlerpSegment g_segment;
+/* Unrelated endpoint pairs for the pairwise interpolation cases. */
+#define PAIR_COUNT 256
+static double g_pair_q1[PAIR_COUNT * 4];
+static double g_pair_q2[PAIR_COUNT * 4];
+static double g_pair_t[PAIR_COUNT];
+static double g_pair_out[PAIR_COUNT * 4];
+static float g_pair_q1f[PAIR_COUNT * 4];
+static float g_pair_q2f[PAIR_COUNT * 4];
+static float g_pair_tf[PAIR_COUNT];
+static float g_pair_outf[PAIR_COUNT * 4];
+/* The same keyframes as a 50 Hz spline sampled at 1 kHz timestamps. */
+static double g_key_times[KEY_COUNT];
+static double g_sample_times[OUTPUT_COUNT];
+static double g_omega[OUTPUT_COUNT * 3];
+static double g_squad_storage[QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT)];
+static double g_hermite_storage[QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT)];
+static QuaternionSpline g_squad;
+static QuaternionSpline g_hermite;
+
+static void setup(void) {
+    /* Neighbouring keyframes a realistic 50 Hz step apart (a few degrees). */
+    double q[4];
+    bench_random_quaternion(q);
+    for (size_t key = 0; key < KEY_COUNT; ++key) {
+        const double step[4] = {1.0, 0.05 * bench_random(), 0.05 * bench_random(), 0.05 * bench_random()};
+        double next[4];
+        quaternion_multiply(q, step, next);
+        quaternion_normalize(next);
+        for (int k = 0; k < 4; ++k) {
+            q[k] = next[k];
+            g_keys[4 * key + k] = q[k];
+            g_keysf[4 * key + k] = (float)q[k];
+        }
+    }
+    slerp_segment_init(&g_segment, &g_keys[0], &g_keys[4]);
+
+    for (size_t key = 0; key < KEY_COUNT; ++key) {
+        g_key_times[key] = 0.02 * (double)key;
+    }
+    for (size_t s = 0; s < OUTPUT_COUNT; ++s) {
+        g_sample_times[s] = 0.001 * (double)s;
+    }
+    quaternion_spline_init(&g_squad, QUATERNION_SPLINE_SQUAD, g_key_times, g_keys, KEY_COUNT, g_squad_storage,
+                           QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT));
+    quaternion_spline_init(&g_hermite, QUATERNION_SPLINE_HERMITE, g_key_times, g_keys, KEY_COUNT, g_hermite_storage,
+                           QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT));
+
+    for (size_t i = 0; i < PAIR_COUNT; ++i) {
+        bench_random_quaternion(&g_pair_q1[4 * i]);
+        bench_random_quaternion(&g_pair_q2[4 * i]);
+        g_pair_t[i] = 0.5 + 0.5 * bench_random();
+        g_pair_tf[i] = (float)g_pair_t[i];
+        for (int k = 0; k < 4; ++k) {
+            g_pair_q1f[4 * i + k] = (float)g_pair_q1[4 * i + k];
+            g_pair_q2f[4 * i + k] = (float)g_pair_q2[4 * i + k];
+        }
+    }
+}
+
+/* What callers wrote before slerp.h: quaternion_slerp for every output sample. */
+static void bench_quaternion_slerp_upsample(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t key = 0; key + 1 < KEY_COUNT; ++key) {
+            for (size_t s = 0; s < UPSAMPLE_FACTOR; ++s) {
+                quaternion_slerp(&g_keys[4 * key], &g_keys[4 * key + 4], (double)s / UPSAMPLE_FACTOR,
+                                 &g_output[4 * (key * UPSAMPLE_FACTOR + s)]);
+            }
+        }
+    }
+    bench_sink = g_output[4 * OUTPUT_COUNT - 8];
+}
+
+static void bench_slerp_upsample(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerp_upsample(g_keys, KEY_COUNT, UPSAMPLE_FACTOR, g_output);
+    }
+    bench_sink = g_output[4 * OUTPUT_COUNT - 8];
+}
+
+static void bench_slerpf_upsample(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerpf_upsample(g_keysf, KEY_COUNT, UPSAMPLE_FACTOR, g_outputf);
+    }
+    bench_sink = g_outputf[4 * OUTPUT_COUNT - 8];
+}
+
+static void bench_slerp_segment_eval(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        slerp_segment_eval(&g_segment, (double)(i & BENCH_INPUT_MASK) / BENCH_INPUT_COUNT, q);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_quaternion_slerp_pairs(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t p = 0; p < PAIR_COUNT; ++p) {
+            quaternion_slerp(&g_pair_q1[4 * p], &g_pair_q2[4 * p], g_pair_t[p], &g_pair_out[4 * p]);
+        }
+    }
+    bench_sink = g_pair_out[4 * PAIR_COUNT - 1];
+}
+
+static void bench_slerp_fast_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerp_fast_batch(g_pair_q1, g_pair_q2, g_pair_t, PAIR_COUNT, g_pair_out);
+    }
+    bench_sink = g_pair_out[4 * PAIR_COUNT - 1];
+}
+
+static void bench_slerpf_fast_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerpf_fast_batch(g_pair_q1f, g_pair_q2f, g_pair_tf, PAIR_COUNT, g_pair_outf);
+    }
+    bench_sink = g_pair_outf[4 * PAIR_COUNT - 1];
+}
+
+static void bench_slerp_fast_coarse_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerp_fast_coarse_batch(g_pair_q1, g_pair_q2, g_pair_t, PAIR_COUNT, g_pair_out);
+    }
+    bench_sink = g_pair_out[4 * PAIR_COUNT - 1];
+}
+
+static void bench_slerpf_fast_coarse_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        slerpf_fast_coarse_batch(g_pair_q1f, g_pair_q2f, g_pair_tf, PAIR_COUNT, g_pair_outf);
+    }
+    bench_sink = g_pair_outf[4 * PAIR_COUNT - 1];
+}
+
+static void bench_spline_squad_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_spline_eval_batch(&g_squad, g_sample_times, OUTPUT_COUNT, g_output, NULL, NULL);
+    }
+    bench_sink = g_output[4 * OUTPUT_COUNT - 8];
+}
+
+static void bench_spline_squad_rates_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_spline_eval_batch(&g_squad, g_sample_times, OUTPUT_COUNT, g_output, g_omega, NULL);
+    }
+    bench_sink = g_omega[3 * OUTPUT_COUNT - 1];
+}
+
+static void bench_spline_hermite_batch(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        quaternion_spline_eval_batch(&g_hermite, g_sample_times, OUTPUT_COUNT, g_output, NULL, NULL);
+    }
+    bench_sink = g_output[4 * OUTPUT_COUNT - 8];
+}
+
+/* Binary search on every sample, as for out-of-order queries. */
+static void bench_spline_hermite_eval(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        quaternion_spline_eval(&g_hermite, g_sample_times[(i * 7919) % OUTPUT_COUNT], q, NULL, NULL);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"quaternion_slerp_upsample20", bench_quaternion_slerp_upsample, OUTPUT_COUNT - 1},
+    {"slerp_upsample20", bench_slerp_upsample, OUTPUT_COUNT},
+    {"slerpf_upsample20", bench_slerpf_upsample, OUTPUT_COUNT},
+    {"slerp_segment_eval", bench_slerp_segment_eval, 1},
+    {"quaternion_slerp_pairs", bench_quaternion_slerp_pairs, PAIR_COUNT},
+    {"slerp_fast_batch", bench_slerp_fast_batch, PAIR_COUNT},
+    {"slerpf_fast_batch", bench_slerpf_fast_batch, PAIR_COUNT},
+    {"slerp_fast_coarse_batch", bench_slerp_fast_coarse_batch, PAIR_COUNT},
+    {"slerpf_fast_coarse_batch", bench_slerpf_fast_coarse_batch, PAIR_COUNT},
+    {"spline_squad_batch", bench_spline_squad_batch, OUTPUT_COUNT},
+    {"spline_squad_rates_batch", bench_spline_squad_rates_batch, OUTPUT_COUNT},
+    {"spline_hermite_batch", bench_spline_hermite_batch, OUTPUT_COUNT},
+    {"spline_hermite_eval", bench_spline_hermite_eval, 1},
+};
+
+const BenchSuite bench_suite_interpolation = {
+    "interpolation",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,104 @@
+#include "bench.h"
+
+#include <math.h>
+
+#include "attitude/kinematics.h"
+#include "attitude/quaternion.h"
+
+/* One 8 kHz IMU burst: the propagate cases report cost per gyro sample. */
+#define GYRO_SAMPLES 1024
+#define GYRO_DT (1.0 / 8000.0)
+
+static double g_q0[4];
+static double g_omega[GYRO_SAMPLES * 3];
+static double g_delta_theta[GYRO_SAMPLES * 3];
+static double g_attitudes[GYRO_SAMPLES * 4];
+static float g_q0f[4];
+static float g_omegaf[GYRO_SAMPLES * 3];
+static float g_attitudesf[GYRO_SAMPLES * 4];
+
+static void setup(void) {
+    bench_random_quaternion(g_q0);
+    for (size_t i = 0; i < GYRO_SAMPLES * 3; ++i) {
+        g_omega[i] = 6.0 * bench_random();
+        g_delta_theta[i] = g_omega[i] * GYRO_DT;
+        g_omegaf[i] = (float)g_omega[i];
+    }
+    for (int k = 0; k < 4; ++k) {
+        g_q0f[k] = (float)g_q0[k];
+    }
+}
+
+/* What callers wrote before kinematics.h: first-order step, then an exact renormalisation. */
+static void bench_naive_multiply_normalize(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        const double *previous = g_q0;
+        for (size_t s = 0; s < GYRO_SAMPLES; ++s) {
+            const double *rate = &g_omega[3 * s];
+            const double dq[4] = {1.0, 0.5 * rate[0] * GYRO_DT, 0.5 * rate[1] * GYRO_DT, 0.5 * rate[2] * GYRO_DT};
+            double *q = &g_attitudes[4 * s];
+            quaternion_multiply(previous, dq, q);
+            const double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            q[0] /= norm;
+            q[1] /= norm;
+            q[2] /= norm;
+            q[3] /= norm;
+            previous = q;
+        }
+    }
+    bench_sink = g_attitudes[4 * GYRO_SAMPLES - 1];
+}
+
+static void bench_kinematics_propagate(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        kinematics_propagate(g_q0, g_omega, GYRO_SAMPLES, GYRO_DT, g_attitudes);
+    }
+    bench_sink = g_attitudes[4 * GYRO_SAMPLES - 1];
+}
+
+static void bench_kinematicsf_propagate(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        kinematicsf_propagate(g_q0f, g_omegaf, GYRO_SAMPLES, (float)GYRO_DT, g_attitudesf);
+    }
+    bench_sink = g_attitudesf[4 * GYRO_SAMPLES - 1];
+}
+
+static void bench_kinematics_propagate_coning4(size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        kinematics_propagate_coning(g_q0, g_delta_theta, GYRO_SAMPLES, 4, g_attitudes);
+    }
+    bench_sink = g_attitudes[GYRO_SAMPLES - 1];
+}
+
+static void bench_kinematics_integrate_exp(size_t iterations) {
+    double q[4] = {g_q0[0], g_q0[1], g_q0[2], g_q0[3]};
+    for (size_t i = 0; i < iterations; ++i) {
+        kinematics_integrate_exp(q, &g_omega[3 * (i % GYRO_SAMPLES)], GYRO_DT, q);
+    }
+    bench_sink = q[0];
+}
+
+static void bench_kinematics_integrate_rk4(size_t iterations) {
+    double q[4] = {g_q0[0], g_q0[1], g_q0[2], g_q0[3]};
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = i % (GYRO_SAMPLES - 1);
+        kinematics_integrate_rk4(q, &g_omega[3 * s], &g_omega[3 * s + 3], GYRO_DT, q);
+    }
+    bench_sink = q[0];
+}
+
+static const BenchCase k_cases[] = {
+    {"naive_multiply_normalize", bench_naive_multiply_normalize, GYRO_SAMPLES},
+    {"kinematics_propagate", bench_kinematics_propagate, GYRO_SAMPLES},
+    {"kinematicsf_propagate", bench_kinematicsf_propagate, GYRO_SAMPLES},
+    {"kinematics_propagate_coning4", bench_kinematics_propagate_coning4, GYRO_SAMPLES},
+    {"kinematics_integrate_exp", bench_kinematics_integrate_exp, 1},
+    {"kinematics_integrate_rk4", bench_kinematics_integrate_rk4, 1},
+};
+
+const BenchSuite bench_suite_kinematics = {
+    "kinematics",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,425 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+
+#include "attitude/quaternion_soa.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef ATTITUDE_BENCH_BUILD_TYPE
+#define ATTITUDE_BENCH_BUILD_TYPE "unknown"
+#endif
+
+#ifdef __VERSION__
+#define BENCH_COMPILER __VERSION__
+#else
+#define BENCH_COMPILER "unknown"
+#endif
+
+#define MAX_REPS 10001
+
+volatile double bench_sink;
+
+static const BenchSuite *const k_suites[] = {
+    &bench_suite_core,
+    &bench_suite_float,
+    &bench_suite_batch,
+    &bench_suite_kinematics,
+    &bench_suite_interpolation,
+    &bench_suite_wahba,
+    &bench_suite_fixed,
+    &bench_suite_inline,
+    &bench_suite_ahrs,
+    &bench_suite_mekf,
+    &bench_suite_convert,
+    &bench_suite_attitude_log,
+    &bench_suite_quaternion_codec,
+};
+
+typedef enum {
+    FORMAT_CSV,
+    FORMAT_JSON
+} OutputFormat;
+
+typedef struct {
+    OutputFormat format;
+    const char *filter;
+    const char *output_path;
+    int list_only;
+    int warmup;
+    int reps;
+    long sample_ns;
+} BenchOptions;
+
+typedef struct {
+    char cpu_model[128];
+    long logical_cpus;
+    char governor[32];
+    long cur_khz;
+    long max_khz;
+    char boost[16];
+    long timer_resolution_ns;
+} BenchEnvironment;
+
+typedef struct {
+    size_t iterations;
+    double min_ns;
+    double median_ns;
+    double p99_ns;
+    double mean_ns;
+} BenchResult;
+
+/* Bench helpers */
+
+static uint64_t g_random_state = 0x9E3779B97F4A7C15ull;
+
+double bench_random(void) {
+    // xorshift64*: deterministic across platforms so every run times the same inputs.
+    g_random_state ^= g_random_state >> 12;
+    g_random_state ^= g_random_state << 25;
+    g_random_state ^= g_random_state >> 27;
+    const uint64_t bits = (g_random_state * 0x2545F4914F6CDD1Dull) >> 11;
+    return (double)bits / 4503599627370496.0 - 1.0;
+}
+
+void bench_random_quaternion(double q[4]) {
+    double norm_sq;
+    do {
+        for (int k = 0; k < 4; ++k) {
+            q[k] = bench_random();
+        }
+        norm_sq = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+    } while (norm_sq < 1e-2 || norm_sq > 1.0);
+
+    double scale = 1.0 / sqrt(norm_sq);
+    for (int k = 0; k < 4; ++k) {
+        q[k] *= scale;
+    }
+}
+
+/* Environment notes */
+
+static int read_line(const char *path, char *buffer, size_t size) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        return 0;
+    }
+    int ok = fgets(buffer, (int)size, file) != NULL;
+    fclose(file);
+    if (ok) {
+        buffer[strcspn(buffer, "\r\n")] = '\0';
+    }
+    return ok;
+}
+
+static long read_long(const char *path) {
+    char buffer[64];
+    return read_line(path, buffer, sizeof(buffer)) ? strtol(buffer, NULL, 10) : -1;
+}
+
+static void read_cpu_model(char *buffer, size_t size) {
+    char line[256];
+    FILE *file = fopen("/proc/cpuinfo", "r");
+
+    snprintf(buffer, size, "unknown");
+    if (file == NULL) {
+        return;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (strncmp(line, "model name", 10) == 0 || strncmp(line, "Model", 5) == 0) {
+            const char *value = strchr(line, ':');
+            if (value != NULL) {
+                value += 1 + strspn(value + 1, " \t");
+                snprintf(buffer, size, "%s", value);
+                buffer[strcspn(buffer, "\r\n")] = '\0';
+                break;
+            }
+        }
+    }
+    fclose(file);
+}
+
+static void collect_environment(BenchEnvironment *env) {
+    struct timespec resolution;
+
+    read_cpu_model(env->cpu_model, sizeof(env->cpu_model));
+    env->logical_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (!read_line("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor", env->governor,
+                   sizeof(env->governor))) {
+        snprintf(env->governor, sizeof(env->governor), "unknown");
+    }
+    env->cur_khz = read_long("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq");
+    env->max_khz = read_long("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq");
+
+    // Turbo/boost makes ns/op depend on thermal state; record it so runs can be compared.
+    long no_turbo = read_long("/sys/devices/system/cpu/intel_pstate/no_turbo");
+    long boost = read_long("/sys/devices/system/cpu/cpufreq/boost");
+    if (no_turbo >= 0) {
+        snprintf(env->boost, sizeof(env->boost), "%s", no_turbo ? "off" : "on");
+    } else if (boost >= 0) {
+        snprintf(env->boost, sizeof(env->boost), "%s", boost ? "on" : "off");
+    } else {
+        snprintf(env->boost, sizeof(env->boost), "unknown");
+    }
+
+    env->timer_resolution_ns = clock_getres(CLOCK_MONOTONIC, &resolution) == 0
+                                   ? resolution.tv_sec * 1000000000L + resolution.tv_nsec
+                                   : -1;
+}
+
+/* Timing */
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int64_t time_run(const BenchCase *bench_case, size_t iterations) {
+    const int64_t start = now_ns();
+    bench_case->run(iterations);
+    return now_ns() - start;
+}
+
+static int compare_double(const void *a, const void *b) {
+    const double lhs = *(const double *)a;
+    const double rhs = *(const double *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static void run_case(const BenchCase *bench_case, const BenchOptions *options, BenchResult *result) {
+    static double samples[MAX_REPS];
+
+    // Grow the iteration count until one sample is long enough to swamp timer resolution.
+    size_t iterations = 1;
+    while (time_run(bench_case, iterations) < options->sample_ns && iterations < ((size_t)1 << 40)) {
+        iterations *= 2;
+    }
+    for (int rep = 0; rep < options->warmup; ++rep) {
+        time_run(bench_case, iterations);
+    }
+
+    const double ops = (double)iterations * (double)bench_case->ops_per_iteration;
+    double total = 0.0;
+    for (int rep = 0; rep < options->reps; ++rep) {
+        samples[rep] = (double)time_run(bench_case, iterations) / ops;
+        total += samples[rep];
+    }
+    qsort(samples, (size_t)options->reps, sizeof(samples[0]), compare_double);
+
+    // Nearest-rank percentiles.
+    const int p99_rank = (99 * options->reps + 99) / 100;
+    result->iterations = iterations;
+    result->min_ns = samples[0];
+    result->median_ns = samples[options->reps / 2];
+    result->p99_ns = samples[p99_rank - 1];
+    result->mean_ns = total / options->reps;
+}
+
+/* Output */
+
+static double cycles_per_op(const BenchEnvironment *env, double ns) {
+    return env->cur_khz > 0 ? ns * (double)env->cur_khz * 1e-6 : -1.0;
+}
+
+static void write_header(FILE *out, const BenchOptions *options, const BenchEnvironment *env) {
+    const char *backend = quaternion_soa_backend_name(quaternion_soa_backend());
+
+    if (options->format == FORMAT_CSV) {
+        fprintf(out, "# attitude_bench build=%s compiler=\"%s\"\n", ATTITUDE_BENCH_BUILD_TYPE, BENCH_COMPILER);
+        fprintf(out, "# cpu=\"%s\" logical_cpus=%ld soa_backend=%s\n", env->cpu_model, env->logical_cpus, backend);
+        fprintf(out, "# governor=%s cur_khz=%ld max_khz=%ld boost=%s timer_resolution_ns=%ld\n",
+                env->governor, env->cur_khz, env->max_khz, env->boost, env->timer_resolution_ns);
+        fprintf(out, "# warmup=%d reps=%d sample_ns=%ld\n", options->warmup, options->reps, options->sample_ns);
+        fprintf(out, "suite,name,iterations,ops_per_iteration,min_ns,median_ns,p99_ns,mean_ns,"
+                     "ops_per_s,cycles_per_op\n");
+        return;
+    }
+
+    fprintf(out, "{\n  \"environment\": {\n");
+    fprintf(out, "    \"build\": \"%s\",\n    \"compiler\": \"%s\",\n", ATTITUDE_BENCH_BUILD_TYPE, BENCH_COMPILER);
+    fprintf(out, "    \"cpu\": \"%s\",\n    \"logical_cpus\": %ld,\n", env->cpu_model, env->logical_cpus);
+    fprintf(out, "    \"soa_backend\": \"%s\",\n    \"governor\": \"%s\",\n", backend, env->governor);
+    fprintf(out, "    \"cur_khz\": %ld,\n    \"max_khz\": %ld,\n", env->cur_khz, env->max_khz);
+    fprintf(out, "    \"boost\": \"%s\",\n    \"timer_resolution_ns\": %ld,\n", env->boost,
+            env->timer_resolution_ns);
+    fprintf(out, "    \"warmup\": %d,\n    \"reps\": %d,\n    \"sample_ns\": %ld\n  },\n",
+            options->warmup, options->reps, options->sample_ns);
+    fprintf(out, "  \"results\": [");
+}
+
+static void write_result(FILE *out,
+                         const BenchOptions *options,
+                         const BenchEnvironment *env,
+                         const char *suite,
+                         const BenchCase *bench_case,
+                         const BenchResult *result,
+                         int first) {
+    const double ops_per_s = result->median_ns > 0.0 ? 1e9 / result->median_ns : 0.0;
+    const double cycles = cycles_per_op(env, result->median_ns);
+
+    if (options->format == FORMAT_CSV) {
+        fprintf(out, "%s,%s,%zu,%zu,%.3f,%.3f,%.3f,%.3f,%.0f,%.2f\n",
+                suite, bench_case->name, result->iterations, bench_case->ops_per_iteration,
+                result->min_ns, result->median_ns, result->p99_ns, result->mean_ns, ops_per_s, cycles);
+    } else {
+        fprintf(out, "%s\n    {\"suite\": \"%s\", \"name\": \"%s\", \"iterations\": %zu, "
+                     "\"ops_per_iteration\": %zu, \"min_ns\": %.3f, \"median_ns\": %.3f, "
+                     "\"p99_ns\": %.3f, \"mean_ns\": %.3f, \"ops_per_s\": %.0f, \"cycles_per_op\": %.2f}",
+                first ? "" : ",", suite, bench_case->name, result->iterations,
+                bench_case->ops_per_iteration, result->min_ns, result->median_ns, result->p99_ns,
+                result->mean_ns, ops_per_s, cycles);
+    }
+    fflush(out);
+}
+
+static void write_footer(FILE *out, const BenchOptions *options) {
+    if (options->format == FORMAT_JSON) {
+        fprintf(out, "\n  ]\n}\n");
+    }
+}
+
+/* Command line */
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --format csv|json   Output format (default csv)\n"
+            "  --output FILE       Write results to FILE instead of stdout\n"
+            "  --filter TEXT       Only run cases whose suite/name contains TEXT\n"
+            "  --warmup N          Untimed samples before measuring (default 5)\n"
+            "  --reps N            Timed samples per case (default 31, max %d)\n"
+            "  --sample-us N       Minimum duration of one sample (default 2000)\n"
+            "  --list              List cases and exit\n"
+            "\n"
+            "cycles_per_op is estimated from the cpufreq reading taken at start-up (-1 when the\n"
+            "frequency is not exposed). For stable numbers pin the process (taskset -c 2), use\n"
+            "the performance governor, and disable turbo/boost.\n",
+            program, MAX_REPS);
+}
+
+static int parse_int(const char *text, long min, long max, long *value) {
+    char *end = NULL;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < min || parsed > max) {
+        return 0;
+    }
+    *value = parsed;
+    return 1;
+}
+
+static int parse_options(int argc, char **argv, BenchOptions *options) {
+    options->format = FORMAT_CSV;
+    options->filter = NULL;
+    options->output_path = NULL;
+    options->list_only = 0;
+    options->warmup = 5;
+    options->reps = 31;
+    options->sample_ns = 2000000;
+
+    for (int index = 1; index < argc; ++index) {
+        const char *arg = argv[index];
+        const char *value = index + 1 < argc ? argv[index + 1] : NULL;
+        long number;
+
+        if (strcmp(arg, "--list") == 0) {
+            options->list_only = 1;
+            continue;
+        }
+        if (value == NULL) {
+            return 0;
+        }
+        ++index;
+        if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "csv") == 0) {
+                options->format = FORMAT_CSV;
+            } else if (strcmp(value, "json") == 0) {
+                options->format = FORMAT_JSON;
+            } else {
+                return 0;
+            }
+        } else if (strcmp(arg, "--output") == 0) {
+            options->output_path = value;
+        } else if (strcmp(arg, "--filter") == 0) {
+            options->filter = value;
+        } else if (strcmp(arg, "--warmup") == 0 && parse_int(value, 0, 1000, &number)) {
+            options->warmup = (int)number;
+        } else if (strcmp(arg, "--reps") == 0 && parse_int(value, 1, MAX_REPS, &number)) {
+            options->reps = (int)number;
+        } else if (strcmp(arg, "--sample-us") == 0 && parse_int(value, 1, 10000000, &number)) {
+            options->sample_ns = number * 1000;
+        } else {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int matches(const BenchOptions *options, const char *suite, const char *name) {
+    return options->filter == NULL || strstr(name, options->filter) != NULL ||
+           strstr(suite, options->filter) != NULL;
+}
+
+int main(int argc, char **argv) {
+    BenchOptions options;
+    BenchEnvironment env;
+
+    if (!parse_options(argc, argv, &options)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (options.list_only) {
+        for (size_t s = 0; s < sizeof(k_suites) / sizeof(k_suites[0]); ++s) {
+            for (size_t c = 0; c < k_suites[s]->case_count; ++c) {
+                if (matches(&options, k_suites[s]->name, k_suites[s]->cases[c].name)) {
+                    printf("%s/%s\n", k_suites[s]->name, k_suites[s]->cases[c].name);
+                }
+            }
+        }
+        return 0;
+    }
+
+    FILE *out = stdout;
+    if (options.output_path != NULL) {
+        out = fopen(options.output_path, "w");
+        if (out == NULL) {
+            perror(options.output_path);
+            return 1;
+        }
+    }
+
+    collect_environment(&env);
+    write_header(out, &options, &env);
+
+    int first = 1;
+    for (size_t s = 0; s < sizeof(k_suites) / sizeof(k_suites[0]); ++s) {
+        const BenchSuite *suite = k_suites[s];
+        int prepared = 0;
+        for (size_t c = 0; c < suite->case_count; ++c) {
+            BenchResult result;
+            if (!matches(&options, suite->name, suite->cases[c].name)) {
+                continue;
+            }
+            if (!prepared) {
+                suite->setup();
+                prepared = 1;
+            }
+            run_case(&suite->cases[c], &options, &result);
+            write_result(out, &options, &env, suite->name, &suite->cases[c], &result, first);
+            first = 0;
+        }
+    }
+
+    write_footer(out, &options);
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,299 @@
+/*
+ * Cost of the MEKF predict and update kernels (cycles_per_op is the per-call budget; the cycle
+ * cases are one gyro step plus gravity and magnetometer updates). The dense cases are the
+ * same filter written the usual way on top of a generic row-major matrix helper: a full 6x6
+ * Phi P Phi^T + Q and a 3x3 innovation covariance that is inverted for the gain.
+ */
+#include "bench.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "attitude/kinematics.h"
+#include "attitude/mekf.h"
+#include "attitude/quaternion.h"
+
+#define MEKF_SAMPLES 1024
+#define MEKF_DT 0.01
+
+static double g_gyro[MEKF_SAMPLES * 3];
+static double g_accel[MEKF_SAMPLES * 3];
+static double g_mag[MEKF_SAMPLES * 3];
+static double g_att[MEKF_SAMPLES * 4];
+static float g_gyrof[MEKF_SAMPLES * 3];
+static float g_accelf[MEKF_SAMPLES * 3];
+static float g_magf[MEKF_SAMPLES * 3];
+
+static const double k_up[3] = {0.0, 0.0, 1.0};
+static const double k_field[3] = {0.21, 0.0, -0.45};
+static const float k_upf[3] = {0.0f, 0.0f, 1.0f};
+static const float k_fieldf[3] = {0.21f, 0.0f, -0.45f};
+
+static void setup(void) {
+    for (size_t i = 0; i < MEKF_SAMPLES; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            g_gyro[3 * i + k] = 0.5 * bench_random();
+            g_accel[3 * i + k] = k_up[k] + 0.05 * bench_random();
+            g_mag[3 * i + k] = k_field[k] + 0.02 * bench_random();
+            g_gyrof[3 * i + k] = (float)g_gyro[3 * i + k];
+            g_accelf[3 * i + k] = (float)g_accel[3 * i + k];
+            g_magf[3 * i + k] = (float)g_mag[3 * i + k];
+        }
+        double *q = &g_att[4 * i];
+        q[0] = 1.0;
+        q[1] = 0.02 * bench_random();
+        q[2] = 0.02 * bench_random();
+        q[3] = 0.02 * bench_random();
+        quaternion_normalize(q);
+    }
+}
+
+static void init_filter(MekfFilter *filter) {
+    mekf_init(filter, NULL, 0.1, 0.01, 1e-3, 1e-5);
+}
+
+/* ---- Dense reference ---------------------------------------------------- */
+
+typedef struct {
+    double q[4];
+    double bias[3];
+    double p[6][6];
+    double gyro_noise;
+    double bias_noise;
+} DenseMekf;
+
+/* out (n x m) = a (n x k) * b (k x m), or a * b^T when transpose_b is set. */
+static void mat_mul(const double *a, const double *b, double *out, int n, int k, int m, int transpose_b) {
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            double sum = 0.0;
+            for (int l = 0; l < k; ++l) {
+                sum += a[i * k + l] * (transpose_b ? b[j * k + l] : b[l * m + j]);
+            }
+            out[i * m + j] = sum;
+        }
+    }
+}
+
+static void dense_init(DenseMekf *filter) {
+    memset(filter, 0, sizeof(*filter));
+    filter->q[0] = 1.0;
+    for (int i = 0; i < 3; ++i) {
+        filter->p[i][i] = 0.01;
+        filter->p[3 + i][3 + i] = 1e-4;
+    }
+    filter->gyro_noise = 1e-6;
+    filter->bias_noise = 1e-10;
+}
+
+static void dense_predict(DenseMekf *filter, const double gyro[3], double dt) {
+    const double omega[3] = {gyro[0] - filter->bias[0], gyro[1] - filter->bias[1], gyro[2] - filter->bias[2]};
+    const double phi_v[3] = {omega[0] * dt, omega[1] * dt, omega[2] * dt};
+    double next[4];
+    double dq[4];
+    double theta[3][3];
+    kinematics_integrate_exp(filter->q, omega, dt, next);
+    memcpy(filter->q, next, sizeof(next));
+    quaternion_exp(phi_v, dq);
+    quaternion_to_dcm(dq, theta);
+
+    double phi[6][6] = {{0.0}};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            phi[i][j] = theta[j][i];
+        }
+        phi[i][3 + i] = -dt;
+        phi[3 + i][3 + i] = 1.0;
+    }
+    double tmp[6][6];
+    mat_mul(&phi[0][0], &filter->p[0][0], &tmp[0][0], 6, 6, 6, 0);
+    mat_mul(&tmp[0][0], &phi[0][0], &filter->p[0][0], 6, 6, 6, 1);
+    for (int k = 0; k < 3; ++k) {
+        filter->p[k][k] += filter->gyro_noise * dt + filter->bias_noise * dt * dt * dt / 3.0;
+        filter->p[k][3 + k] -= 0.5 * filter->bias_noise * dt * dt;
+        filter->p[3 + k][k] -= 0.5 * filter->bias_noise * dt * dt;
+        filter->p[3 + k][3 + k] += filter->bias_noise * dt;
+    }
+}
+
+static void dense_update_vector(DenseMekf *filter, const double measured[3], const double reference[3], double variance) {
+    double m[3] = {measured[0], measured[1], measured[2]};
+    double q_inv[4];
+    double y[3];
+    const double m_norm = sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+    for (int k = 0; k < 3; ++k) {
+        m[k] /= m_norm;
+    }
+    quaternion_inverse(filter->q, q_inv);
+    quaternion_rotate_vector(q_inv, reference, y);
+
+    const double h[3][6] = {
+        {0.0, -y[2], y[1], 0.0, 0.0, 0.0},
+        {y[2], 0.0, -y[0], 0.0, 0.0, 0.0},
+        {-y[1], y[0], 0.0, 0.0, 0.0, 0.0}
+    };
+    double pht[6][3];
+    double s[3][3];
+    mat_mul(&filter->p[0][0], &h[0][0], &pht[0][0], 6, 6, 3, 1);
+    mat_mul(&h[0][0], &pht[0][0], &s[0][0], 3, 6, 3, 0);
+    for (int k = 0; k < 3; ++k) {
+        s[k][k] += variance;
+    }
+
+    double s_inv[3][3];
+    s_inv[0][0] = s[1][1] * s[2][2] - s[1][2] * s[2][1];
+    s_inv[0][1] = s[0][2] * s[2][1] - s[0][1] * s[2][2];
+    s_inv[0][2] = s[0][1] * s[1][2] - s[0][2] * s[1][1];
+    s_inv[1][0] = s[1][2] * s[2][0] - s[1][0] * s[2][2];
+    s_inv[1][1] = s[0][0] * s[2][2] - s[0][2] * s[2][0];
+    s_inv[1][2] = s[0][2] * s[1][0] - s[0][0] * s[1][2];
+    s_inv[2][0] = s[1][0] * s[2][1] - s[1][1] * s[2][0];
+    s_inv[2][1] = s[0][1] * s[2][0] - s[0][0] * s[2][1];
+    s_inv[2][2] = s[0][0] * s[1][1] - s[0][1] * s[1][0];
+    const double det = s[0][0] * s_inv[0][0] + s[0][1] * s_inv[1][0] + s[0][2] * s_inv[2][0];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            s_inv[i][j] /= det;
+        }
+    }
+
+    double k_gain[6][3];
+    double khp[6][6];
+    double hp[3][6];
+    mat_mul(&pht[0][0], &s_inv[0][0], &k_gain[0][0], 6, 3, 3, 0);
+    mat_mul(&h[0][0], &filter->p[0][0], &hp[0][0], 3, 6, 6, 0);
+    mat_mul(&k_gain[0][0], &hp[0][0], &khp[0][0], 6, 3, 6, 0);
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < 6; ++j) {
+            filter->p[i][j] -= khp[i][j];
+        }
+    }
+
+    const double z[3] = {m[0] - y[0], m[1] - y[1], m[2] - y[2]};
+    double dx[6];
+    mat_mul(&k_gain[0][0], z, dx, 6, 3, 1, 0);
+    const double dq[4] = {1.0, 0.5 * dx[0], 0.5 * dx[1], 0.5 * dx[2]};
+    double product[4];
+    quaternion_multiply(filter->q, dq, product);
+    quaternion_normalize(product);
+    memcpy(filter->q, product, sizeof(product));
+    for (int k = 0; k < 3; ++k) {
+        filter->bias[k] += dx[3 + k];
+    }
+}
+
+static void bench_dense_predict(size_t iterations) {
+    DenseMekf filter;
+    dense_init(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        dense_predict(&filter, &g_gyro[s], MEKF_DT);
+    }
+    bench_sink = filter.p[0][0];
+}
+
+static void bench_dense_update_vector(size_t iterations) {
+    DenseMekf filter;
+    dense_init(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        dense_update_vector(&filter, &g_accel[s], k_up, 1e-4);
+        // Keep the covariance from collapsing so every iteration does representative work.
+        filter.p[0][0] += 1e-6;
+        filter.p[1][1] += 1e-6;
+        filter.p[2][2] += 1e-6;
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_dense_cycle(size_t iterations) {
+    DenseMekf filter;
+    dense_init(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        dense_predict(&filter, &g_gyro[s], MEKF_DT);
+        dense_update_vector(&filter, &g_accel[s], k_up, 1e-4);
+        dense_update_vector(&filter, &g_mag[s], k_field, 1e-4);
+    }
+    bench_sink = filter.q[0];
+}
+
+/* ---- Library ------------------------------------------------------------ */
+
+static void bench_mekf_predict(size_t iterations) {
+    MekfFilter filter;
+    init_filter(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        mekf_predict(&filter, &g_gyro[s], MEKF_DT);
+    }
+    bench_sink = filter.p[0];
+}
+
+static void bench_mekf_update_vector(size_t iterations) {
+    MekfFilter filter;
+    init_filter(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        mekf_update_vector(&filter, &g_accel[s], k_up, 1e-4);
+        // Keep the covariance from collapsing, as in bench_dense_update_vector().
+        filter.p[0] += 1e-6;
+        filter.p[6] += 1e-6;
+        filter.p[11] += 1e-6;
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_mekf_update_attitude(size_t iterations) {
+    MekfFilter filter;
+    init_filter(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        mekf_update_attitude(&filter, &g_att[4 * (i & (MEKF_SAMPLES - 1))], 1e-4);
+        filter.p[0] += 1e-6;
+        filter.p[6] += 1e-6;
+        filter.p[11] += 1e-6;
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_mekf_cycle(size_t iterations) {
+    MekfFilter filter;
+    init_filter(&filter);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        mekf_predict(&filter, &g_gyro[s], MEKF_DT);
+        mekf_update_vector(&filter, &g_accel[s], k_up, 1e-4);
+        mekf_update_vector(&filter, &g_mag[s], k_field, 1e-4);
+    }
+    bench_sink = filter.q[0];
+}
+
+static void bench_mekff_cycle(size_t iterations) {
+    MekfFilterf filter;
+    mekff_init(&filter, NULL, 0.1f, 0.01f, 1e-3f, 1e-5f);
+    for (size_t i = 0; i < iterations; ++i) {
+        const size_t s = 3 * (i & (MEKF_SAMPLES - 1));
+        mekff_predict(&filter, &g_gyrof[s], (float)MEKF_DT);
+        mekff_update_vector(&filter, &g_accelf[s], k_upf, 1e-4f);
+        mekff_update_vector(&filter, &g_magf[s], k_fieldf, 1e-4f);
+    }
+    bench_sink = filter.q[0];
+}
+
+static const BenchCase k_cases[] = {
+    {"dense_predict", bench_dense_predict, 1},
+    {"mekf_predict", bench_mekf_predict, 1},
+    {"dense_update_vector", bench_dense_update_vector, 1},
+    {"mekf_update_vector", bench_mekf_update_vector, 1},
+    {"mekf_update_attitude", bench_mekf_update_attitude, 1},
+    {"dense_cycle", bench_dense_cycle, 1},
+    {"mekf_cycle", bench_mekf_cycle, 1},
+    {"mekff_cycle", bench_mekff_cycle, 1},
+};
+
+const BenchSuite bench_suite_mekf = {
+    "mekf",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,97 @@
+/*
+ * Quaternion codec throughput (ops are samples) on a smooth 1 kHz trajectory: smallest-three
+ * packing at 10 and 16 bits, and delta / predictive streams at 16 bits. ops_per_s of the
+ * decode cases is the decoded samples per second on one core.
+ */
+#include "bench.h"
+
+#include "attitude/quaternion.h"
+#include "attitude/quaternion_codec.h"
+
+#include <math.h>
+
+#define CODEC_COUNT (1u << 16)
+
+static double g_input[CODEC_COUNT][4];
+static double g_output[CODEC_COUNT][4];
+static unsigned char g_packed10[QUATERNION_PACK_BYTES(CODEC_COUNT, 10)];
+static unsigned char g_packed16[QUATERNION_PACK_BYTES(CODEC_COUNT, 16)];
+static unsigned char g_delta[QUATERNION_STREAM_MAX_BYTES(CODEC_COUNT, 16)];
+static unsigned char g_predictive[QUATERNION_STREAM_MAX_BYTES(CODEC_COUNT, 16)];
+static size_t g_delta_size;
+static size_t g_predictive_size;
+
+static const QuaternionStreamConfig k_delta = {16, QUATERNION_CODEC_DELTA, 0};
+static const QuaternionStreamConfig k_predictive = {16, QUATERNION_CODEC_PREDICTIVE, 0};
+
+static void setup(void) {
+    for (size_t i = 0; i < CODEC_COUNT; ++i) {
+        const double t = 1e-3 * (double)i;
+        const double rotvec[3] = {0.3 * sin(2.0 * t), 0.2 * cos(1.3 * t), 1.5 * t};
+        quaternion_exp(rotvec, g_input[i]);
+    }
+    quaternion_pack(&g_input[0][0], CODEC_COUNT, 10, g_packed10);
+    quaternion_pack(&g_input[0][0], CODEC_COUNT, 16, g_packed16);
+    quaternion_stream_encode(&g_input[0][0], CODEC_COUNT, &k_delta, g_delta, sizeof(g_delta), &g_delta_size);
+    quaternion_stream_encode(&g_input[0][0], CODEC_COUNT, &k_predictive, g_predictive, sizeof(g_predictive),
+                             &g_predictive_size);
+}
+
+static void bench_pack16(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_pack(&g_input[0][0], CODEC_COUNT, 16, g_packed16);
+    }
+    bench_sink = g_packed16[0];
+}
+
+static void bench_unpack10(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_unpack(g_packed10, CODEC_COUNT, 10, &g_output[0][0]);
+    }
+    bench_sink = g_output[CODEC_COUNT - 1][0];
+}
+
+static void bench_unpack16(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_unpack(g_packed16, CODEC_COUNT, 16, &g_output[0][0]);
+    }
+    bench_sink = g_output[CODEC_COUNT - 1][0];
+}
+
+static void bench_encode_predictive16(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_stream_encode(&g_input[0][0], CODEC_COUNT, &k_predictive, g_predictive, sizeof(g_predictive),
+                                 &g_predictive_size);
+    }
+    bench_sink = (double)g_predictive_size;
+}
+
+static void bench_decode_delta16(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_stream_decode(g_delta, g_delta_size, CODEC_COUNT, &k_delta, &g_output[0][0]);
+    }
+    bench_sink = g_output[CODEC_COUNT - 1][0];
+}
+
+static void bench_decode_predictive16(size_t iterations) {
+    for (size_t it = 0; it < iterations; ++it) {
+        quaternion_stream_decode(g_predictive, g_predictive_size, CODEC_COUNT, &k_predictive, &g_output[0][0]);
+    }
+    bench_sink = g_output[CODEC_COUNT - 1][0];
+}
+
+static const BenchCase k_cases[] = {
+    {"pack16", bench_pack16, CODEC_COUNT},
+    {"unpack10", bench_unpack10, CODEC_COUNT},
+    {"unpack16", bench_unpack16, CODEC_COUNT},
+    {"stream_encode_predictive16", bench_encode_predictive16, CODEC_COUNT},
+    {"stream_decode_delta16", bench_decode_delta16, CODEC_COUNT},
+    {"stream_decode_predictive16", bench_decode_predictive16, CODEC_COUNT},
+};
+
+const BenchSuite bench_suite_quaternion_codec = {
+    "quaternion_codec",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,124 @@
+#include "bench.h"
+
+#include "attitude/quaternion.h"
+#include "attitude/wahba.h"
+
+/*
+ * Wahba solvers by observation count: 2 pairs (magnetometer + accelerometer), 8 and 32
+ * (star-tracker frames). Each call solves a different problem from a rotating table; cases
+ * report cost per solve.
+ */
+#define MAX_PAIRS 32
+#define PROBLEM_COUNT 16u
+#define PROBLEM_MASK (PROBLEM_COUNT - 1u)
+
+static double g_observed[PROBLEM_COUNT][MAX_PAIRS * 3];
+static double g_reference[PROBLEM_COUNT][MAX_PAIRS * 3];
+static double g_weights[MAX_PAIRS];
+static float g_observedf[PROBLEM_COUNT][MAX_PAIRS * 3];
+static float g_referencef[PROBLEM_COUNT][MAX_PAIRS * 3];
+
+static void setup(void) {
+    for (size_t p = 0; p < PROBLEM_COUNT; ++p) {
+        double q[4];
+        bench_random_quaternion(q);
+        for (size_t i = 0; i < MAX_PAIRS; ++i) {
+            double *r = &g_reference[p][3 * i];
+            double *b = &g_observed[p][3 * i];
+            for (int k = 0; k < 3; ++k) {
+                r[k] = bench_random();
+            }
+            quaternion_rotate_vector(q, r, b);
+            for (int k = 0; k < 3; ++k) {
+                b[k] += 1e-3 * bench_random();
+                g_referencef[p][3 * i + k] = (float)r[k];
+                g_observedf[p][3 * i + k] = (float)b[k];
+            }
+        }
+    }
+    for (size_t i = 0; i < MAX_PAIRS; ++i) {
+        g_weights[i] = 1.0 + 0.5 * bench_random();
+    }
+}
+
+#define WAHBA_BENCH(solver, pairs)                                                               \
+    static void bench_##solver##_##pairs(size_t iterations) {                                    \
+        double sum = 0.0;                                                                        \
+        for (size_t i = 0; i < iterations; ++i) {                                                \
+            double q[4];                                                                         \
+            solver(g_observed[i & PROBLEM_MASK], g_reference[i & PROBLEM_MASK], g_weights, pairs, \
+                   q, NULL);                                                                     \
+            sum += q[0];                                                                         \
+        }                                                                                        \
+        bench_sink = sum;                                                                        \
+    }
+
+WAHBA_BENCH(wahba_quest, 2)
+WAHBA_BENCH(wahba_esoq2, 2)
+WAHBA_BENCH(wahba_davenport, 2)
+WAHBA_BENCH(wahba_svd, 2)
+WAHBA_BENCH(wahba_quest, 8)
+WAHBA_BENCH(wahba_esoq2, 8)
+WAHBA_BENCH(wahba_davenport, 8)
+WAHBA_BENCH(wahba_svd, 8)
+WAHBA_BENCH(wahba_quest, 32)
+WAHBA_BENCH(wahba_esoq2, 32)
+WAHBA_BENCH(wahba_davenport, 32)
+WAHBA_BENCH(wahba_svd, 32)
+
+/* With the covariance, the usual filter-update configuration. */
+static void bench_wahba_quest_covariance_8(size_t iterations) {
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        double q[4];
+        double covariance[3][3];
+        wahba_quest(g_observed[i & PROBLEM_MASK], g_reference[i & PROBLEM_MASK], g_weights, 8, q, covariance);
+        sum += q[0] + covariance[0][0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_wahbaf_quest_8(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float q[4];
+        wahbaf_quest(g_observedf[i & PROBLEM_MASK], g_referencef[i & PROBLEM_MASK], NULL, 8, q, NULL);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static void bench_wahbaf_esoq2_8(size_t iterations) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < iterations; ++i) {
+        float q[4];
+        wahbaf_esoq2(g_observedf[i & PROBLEM_MASK], g_referencef[i & PROBLEM_MASK], NULL, 8, q, NULL);
+        sum += q[0];
+    }
+    bench_sink = sum;
+}
+
+static const BenchCase k_cases[] = {
+    {"wahba_quest_2", bench_wahba_quest_2, 1},
+    {"wahba_esoq2_2", bench_wahba_esoq2_2, 1},
+    {"wahba_davenport_2", bench_wahba_davenport_2, 1},
+    {"wahba_svd_2", bench_wahba_svd_2, 1},
+    {"wahba_quest_8", bench_wahba_quest_8, 1},
+    {"wahba_esoq2_8", bench_wahba_esoq2_8, 1},
+    {"wahba_davenport_8", bench_wahba_davenport_8, 1},
+    {"wahba_svd_8", bench_wahba_svd_8, 1},
+    {"wahba_quest_32", bench_wahba_quest_32, 1},
+    {"wahba_esoq2_32", bench_wahba_esoq2_32, 1},
+    {"wahba_davenport_32", bench_wahba_davenport_32, 1},
+    {"wahba_svd_32", bench_wahba_svd_32, 1},
+    {"wahba_quest_covariance_8", bench_wahba_quest_covariance_8, 1},
+    {"wahbaf_quest_8", bench_wahbaf_quest_8, 1},
+    {"wahbaf_esoq2_8", bench_wahbaf_esoq2_8, 1},
+};
+
+const BenchSuite bench_suite_wahba = {
+    "wahba",
+    setup,
+    k_cases,
+    sizeof(k_cases) / sizeof(k_cases[0])
+};
@@ -0,0 +1,97 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/attitude.dir/DependInfo.cmake"
+  "CMakeFiles/attitude_shared.dir/DependInfo.cmake"
+  "CMakeFiles/test_ahrs.dir/DependInfo.cmake"
+  "CMakeFiles/test_attitude.dir/DependInfo.cmake"
+  "CMakeFiles/test_attitude_degrees.dir/DependInfo.cmake"
+  "CMakeFiles/test_attitude_log.dir/DependInfo.cmake"
+  "CMakeFiles/test_conversion_contracts.dir/DependInfo.cmake"
+  "CMakeFiles/test_convert.dir/DependInfo.cmake"
+  "CMakeFiles/test_dcm_orthogonal.dir/DependInfo.cmake"
+  "CMakeFiles/test_dcm_orthonormalize.dir/DependInfo.cmake"
+  "CMakeFiles/test_dcm_unchecked.dir/DependInfo.cmake"
+  "CMakeFiles/test_euler.dir/DependInfo.cmake"
+  "CMakeFiles/test_euler_from_quaternion.dir/DependInfo.cmake"
+  "CMakeFiles/test_euler_orders.dir/DependInfo.cmake"
+  "CMakeFiles/test_euler_random.dir/DependInfo.cmake"
+  "CMakeFiles/test_fixed_point.dir/DependInfo.cmake"
+  "CMakeFiles/test_float_api.dir/DependInfo.cmake"
+  "CMakeFiles/test_inline.dir/DependInfo.cmake"
+  "CMakeFiles/test_kinematics.dir/DependInfo.cmake"
+  "CMakeFiles/test_mekf.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_average.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_codec.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_exp_log.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_inverse_axis.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_relative.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_rotate.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_rotate_batch.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_rotate_explicit_demo.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_slerp.dir/DependInfo.cmake"
+  "CMakeFiles/test_quaternion_soa.dir/DependInfo.cmake"
+  "CMakeFiles/test_renormalize.dir/DependInfo.cmake"
+  "CMakeFiles/test_rotation.dir/DependInfo.cmake"
+  "CMakeFiles/test_slerp_fast.dir/DependInfo.cmake"
+  "CMakeFiles/test_slerp_segment.dir/DependInfo.cmake"
+  "CMakeFiles/test_spline.dir/DependInfo.cmake"
+  "CMakeFiles/test_wahba.dir/DependInfo.cmake"
+  "CMakeFiles/test_attitude_hpp.dir/DependInfo.cmake"
+  "CMakeFiles/attitude_bench.dir/DependInfo.cmake"
+  "CMakeFiles/attitude_logconv.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attitude.dir/src/ahrs.c.o"
+  "CMakeFiles/attitude.dir/src/ahrs.c.o.d"
+  "CMakeFiles/attitude.dir/src/ahrsf.c.o"
+  "CMakeFiles/attitude.dir/src/ahrsf.c.o.d"
+  "CMakeFiles/attitude.dir/src/attitude_log.c.o"
+  "CMakeFiles/attitude.dir/src/attitude_log.c.o.d"
+  "CMakeFiles/attitude.dir/src/attitude_utils.c.o"
+  "CMakeFiles/attitude.dir/src/attitude_utils.c.o.d"
+  "CMakeFiles/attitude.dir/src/average.c.o"
+  "CMakeFiles/attitude.dir/src/average.c.o.d"
+  "CMakeFiles/attitude.dir/src/averagef.c.o"
+  "CMakeFiles/attitude.dir/src/averagef.c.o.d"
+  "CMakeFiles/attitude.dir/src/convert.c.o"
+  "CMakeFiles/attitude.dir/src/convert.c.o.d"
+  "CMakeFiles/attitude.dir/src/dcm.c.o"
+  "CMakeFiles/attitude.dir/src/dcm.c.o.d"
+  "CMakeFiles/attitude.dir/src/dcmf.c.o"
+  "CMakeFiles/attitude.dir/src/dcmf.c.o.d"
+  "CMakeFiles/attitude.dir/src/euler.c.o"
+  "CMakeFiles/attitude.dir/src/euler.c.o.d"
+  "CMakeFiles/attitude.dir/src/eulerf.c.o"
+  "CMakeFiles/attitude.dir/src/eulerf.c.o.d"
+  "CMakeFiles/attitude.dir/src/fixed_point.c.o"
+  "CMakeFiles/attitude.dir/src/fixed_point.c.o.d"
+  "CMakeFiles/attitude.dir/src/kinematics.c.o"
+  "CMakeFiles/attitude.dir/src/kinematics.c.o.d"
+  "CMakeFiles/attitude.dir/src/kinematicsf.c.o"
+  "CMakeFiles/attitude.dir/src/kinematicsf.c.o.d"
+  "CMakeFiles/attitude.dir/src/mekf.c.o"
+  "CMakeFiles/attitude.dir/src/mekf.c.o.d"
+  "CMakeFiles/attitude.dir/src/mekff.c.o"
+  "CMakeFiles/attitude.dir/src/mekff.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternion.c.o"
+  "CMakeFiles/attitude.dir/src/quaternion.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternion_codec.c.o"
+  "CMakeFiles/attitude.dir/src/quaternion_codec.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternion_soa.c.o"
+  "CMakeFiles/attitude.dir/src/quaternion_soa.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternion_soa_neon.c.o"
+  "CMakeFiles/attitude.dir/src/quaternion_soa_neon.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternion_soa_x86.c.o"
+  "CMakeFiles/attitude.dir/src/quaternion_soa_x86.c.o.d"
+  "CMakeFiles/attitude.dir/src/quaternionf.c.o"
+  "CMakeFiles/attitude.dir/src/quaternionf.c.o.d"
+  "CMakeFiles/attitude.dir/src/slerp.c.o"
+  "CMakeFiles/attitude.dir/src/slerp.c.o.d"
+  "CMakeFiles/attitude.dir/src/slerpf.c.o"
+  "CMakeFiles/attitude.dir/src/slerpf.c.o.d"
+  "CMakeFiles/attitude.dir/src/spline.c.o"
+  "CMakeFiles/attitude.dir/src/spline.c.o.d"
+  "CMakeFiles/attitude.dir/src/splinef.c.o"
+  "CMakeFiles/attitude.dir/src/splinef.c.o.d"
+  "CMakeFiles/attitude.dir/src/validation.c.o"
+  "CMakeFiles/attitude.dir/src/validation.c.o.d"
+  "CMakeFiles/attitude.dir/src/validation_fixed.c.o"
+  "CMakeFiles/attitude.dir/src/validation_fixed.c.o.d"
+  "CMakeFiles/attitude.dir/src/validationf.c.o"
+  "CMakeFiles/attitude.dir/src/validationf.c.o.d"
+  "CMakeFiles/attitude.dir/src/vector3.c.o"
+  "CMakeFiles/attitude.dir/src/vector3.c.o.d"
+  "CMakeFiles/attitude.dir/src/vector3f.c.o"
+  "CMakeFiles/attitude.dir/src/vector3f.c.o.d"
+  "CMakeFiles/attitude.dir/src/wahba.c.o"
+  "CMakeFiles/attitude.dir/src/wahba.c.o.d"
+  "CMakeFiles/attitude.dir/src/wahbaf.c.o"
+  "CMakeFiles/attitude.dir/src/wahbaf.c.o.d"
+  "libattitude.a"
+  "libattitude.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/attitude.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/bench_ahrs.c" "CMakeFiles/attitude_bench.dir/bench/bench_ahrs.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_ahrs.c.o.d"
+  "/root/repo/bench/bench_attitude_log.c" "CMakeFiles/attitude_bench.dir/bench/bench_attitude_log.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_attitude_log.c.o.d"
+  "/root/repo/bench/bench_batch.c" "CMakeFiles/attitude_bench.dir/bench/bench_batch.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_batch.c.o.d"
+  "/root/repo/bench/bench_convert.c" "CMakeFiles/attitude_bench.dir/bench/bench_convert.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_convert.c.o.d"
+  "/root/repo/bench/bench_core.c" "CMakeFiles/attitude_bench.dir/bench/bench_core.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_core.c.o.d"
+  "/root/repo/bench/bench_fixed.c" "CMakeFiles/attitude_bench.dir/bench/bench_fixed.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_fixed.c.o.d"
+  "/root/repo/bench/bench_float.c" "CMakeFiles/attitude_bench.dir/bench/bench_float.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_float.c.o.d"
+  "/root/repo/bench/bench_inline.c" "CMakeFiles/attitude_bench.dir/bench/bench_inline.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_inline.c.o.d"
+  "/root/repo/bench/bench_interpolation.c" "CMakeFiles/attitude_bench.dir/bench/bench_interpolation.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_interpolation.c.o.d"
+  "/root/repo/bench/bench_kinematics.c" "CMakeFiles/attitude_bench.dir/bench/bench_kinematics.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_kinematics.c.o.d"
+  "/root/repo/bench/bench_main.c" "CMakeFiles/attitude_bench.dir/bench/bench_main.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_main.c.o.d"
+  "/root/repo/bench/bench_mekf.c" "CMakeFiles/attitude_bench.dir/bench/bench_mekf.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_mekf.c.o.d"
+  "/root/repo/bench/bench_quaternion_codec.c" "CMakeFiles/attitude_bench.dir/bench/bench_quaternion_codec.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_quaternion_codec.c.o.d"
+  "/root/repo/bench/bench_wahba.c" "CMakeFiles/attitude_bench.dir/bench/bench_wahba.c.o" "gcc" "CMakeFiles/attitude_bench.dir/bench/bench_wahba.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build_bench/CMakeFiles/attitude.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
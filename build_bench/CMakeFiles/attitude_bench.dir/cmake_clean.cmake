@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attitude_bench.dir/bench/bench_ahrs.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_ahrs.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_attitude_log.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_attitude_log.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_batch.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_batch.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_convert.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_convert.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_core.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_core.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_fixed.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_fixed.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_float.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_float.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_inline.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_inline.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_interpolation.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_interpolation.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_kinematics.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_kinematics.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_main.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_main.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_mekf.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_mekf.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_quaternion_codec.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_quaternion_codec.c.o.d"
+  "CMakeFiles/attitude_bench.dir/bench/bench_wahba.c.o"
+  "CMakeFiles/attitude_bench.dir/bench/bench_wahba.c.o.d"
+  "attitude_bench"
+  "attitude_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/attitude_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
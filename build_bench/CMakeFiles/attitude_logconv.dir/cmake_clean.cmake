@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attitude_logconv.dir/tools/attitude_logconv.c.o"
+  "CMakeFiles/attitude_logconv.dir/tools/attitude_logconv.c.o.d"
+  "attitude_logconv"
+  "attitude_logconv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/attitude_logconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
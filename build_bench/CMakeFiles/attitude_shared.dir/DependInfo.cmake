@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ahrs.c" "CMakeFiles/attitude_shared.dir/src/ahrs.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/ahrs.c.o.d"
+  "/root/repo/src/ahrsf.c" "CMakeFiles/attitude_shared.dir/src/ahrsf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/ahrsf.c.o.d"
+  "/root/repo/src/attitude_log.c" "CMakeFiles/attitude_shared.dir/src/attitude_log.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/attitude_log.c.o.d"
+  "/root/repo/src/attitude_utils.c" "CMakeFiles/attitude_shared.dir/src/attitude_utils.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/attitude_utils.c.o.d"
+  "/root/repo/src/average.c" "CMakeFiles/attitude_shared.dir/src/average.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/average.c.o.d"
+  "/root/repo/src/averagef.c" "CMakeFiles/attitude_shared.dir/src/averagef.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/averagef.c.o.d"
+  "/root/repo/src/convert.c" "CMakeFiles/attitude_shared.dir/src/convert.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/convert.c.o.d"
+  "/root/repo/src/dcm.c" "CMakeFiles/attitude_shared.dir/src/dcm.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/dcm.c.o.d"
+  "/root/repo/src/dcmf.c" "CMakeFiles/attitude_shared.dir/src/dcmf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/dcmf.c.o.d"
+  "/root/repo/src/euler.c" "CMakeFiles/attitude_shared.dir/src/euler.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/euler.c.o.d"
+  "/root/repo/src/eulerf.c" "CMakeFiles/attitude_shared.dir/src/eulerf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/eulerf.c.o.d"
+  "/root/repo/src/fixed_point.c" "CMakeFiles/attitude_shared.dir/src/fixed_point.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/fixed_point.c.o.d"
+  "/root/repo/src/kinematics.c" "CMakeFiles/attitude_shared.dir/src/kinematics.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/kinematics.c.o.d"
+  "/root/repo/src/kinematicsf.c" "CMakeFiles/attitude_shared.dir/src/kinematicsf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/kinematicsf.c.o.d"
+  "/root/repo/src/mekf.c" "CMakeFiles/attitude_shared.dir/src/mekf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/mekf.c.o.d"
+  "/root/repo/src/mekff.c" "CMakeFiles/attitude_shared.dir/src/mekff.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/mekff.c.o.d"
+  "/root/repo/src/quaternion.c" "CMakeFiles/attitude_shared.dir/src/quaternion.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternion.c.o.d"
+  "/root/repo/src/quaternion_codec.c" "CMakeFiles/attitude_shared.dir/src/quaternion_codec.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternion_codec.c.o.d"
+  "/root/repo/src/quaternion_soa.c" "CMakeFiles/attitude_shared.dir/src/quaternion_soa.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternion_soa.c.o.d"
+  "/root/repo/src/quaternion_soa_neon.c" "CMakeFiles/attitude_shared.dir/src/quaternion_soa_neon.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternion_soa_neon.c.o.d"
+  "/root/repo/src/quaternion_soa_x86.c" "CMakeFiles/attitude_shared.dir/src/quaternion_soa_x86.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternion_soa_x86.c.o.d"
+  "/root/repo/src/quaternionf.c" "CMakeFiles/attitude_shared.dir/src/quaternionf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/quaternionf.c.o.d"
+  "/root/repo/src/slerp.c" "CMakeFiles/attitude_shared.dir/src/slerp.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/slerp.c.o.d"
+  "/root/repo/src/slerpf.c" "CMakeFiles/attitude_shared.dir/src/slerpf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/slerpf.c.o.d"
+  "/root/repo/src/spline.c" "CMakeFiles/attitude_shared.dir/src/spline.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/spline.c.o.d"
+  "/root/repo/src/splinef.c" "CMakeFiles/attitude_shared.dir/src/splinef.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/splinef.c.o.d"
+  "/root/repo/src/validation.c" "CMakeFiles/attitude_shared.dir/src/validation.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/validation.c.o.d"
+  "/root/repo/src/validation_fixed.c" "CMakeFiles/attitude_shared.dir/src/validation_fixed.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/validation_fixed.c.o.d"
+  "/root/repo/src/validationf.c" "CMakeFiles/attitude_shared.dir/src/validationf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/validationf.c.o.d"
+  "/root/repo/src/vector3.c" "CMakeFiles/attitude_shared.dir/src/vector3.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/vector3.c.o.d"
+  "/root/repo/src/vector3f.c" "CMakeFiles/attitude_shared.dir/src/vector3f.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/vector3f.c.o.d"
+  "/root/repo/src/wahba.c" "CMakeFiles/attitude_shared.dir/src/wahba.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/wahba.c.o.d"
+  "/root/repo/src/wahbaf.c" "CMakeFiles/attitude_shared.dir/src/wahbaf.c.o" "gcc" "CMakeFiles/attitude_shared.dir/src/wahbaf.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attitude_shared.dir/src/ahrs.c.o"
+  "CMakeFiles/attitude_shared.dir/src/ahrs.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/ahrsf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/ahrsf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/attitude_log.c.o"
+  "CMakeFiles/attitude_shared.dir/src/attitude_log.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/attitude_utils.c.o"
+  "CMakeFiles/attitude_shared.dir/src/attitude_utils.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/average.c.o"
+  "CMakeFiles/attitude_shared.dir/src/average.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/averagef.c.o"
+  "CMakeFiles/attitude_shared.dir/src/averagef.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/convert.c.o"
+  "CMakeFiles/attitude_shared.dir/src/convert.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/dcm.c.o"
+  "CMakeFiles/attitude_shared.dir/src/dcm.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/dcmf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/dcmf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/euler.c.o"
+  "CMakeFiles/attitude_shared.dir/src/euler.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/eulerf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/eulerf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/fixed_point.c.o"
+  "CMakeFiles/attitude_shared.dir/src/fixed_point.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/kinematics.c.o"
+  "CMakeFiles/attitude_shared.dir/src/kinematics.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/kinematicsf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/kinematicsf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/mekf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/mekf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/mekff.c.o"
+  "CMakeFiles/attitude_shared.dir/src/mekff.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternion.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternion.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_codec.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_codec.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa_neon.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa_neon.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa_x86.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternion_soa_x86.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/quaternionf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/quaternionf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/slerp.c.o"
+  "CMakeFiles/attitude_shared.dir/src/slerp.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/slerpf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/slerpf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/spline.c.o"
+  "CMakeFiles/attitude_shared.dir/src/spline.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/splinef.c.o"
+  "CMakeFiles/attitude_shared.dir/src/splinef.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/validation.c.o"
+  "CMakeFiles/attitude_shared.dir/src/validation.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/validation_fixed.c.o"
+  "CMakeFiles/attitude_shared.dir/src/validation_fixed.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/validationf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/validationf.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/vector3.c.o"
+  "CMakeFiles/attitude_shared.dir/src/vector3.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/vector3f.c.o"
+  "CMakeFiles/attitude_shared.dir/src/vector3f.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/wahba.c.o"
+  "CMakeFiles/attitude_shared.dir/src/wahba.c.o.d"
+  "CMakeFiles/attitude_shared.dir/src/wahbaf.c.o"
+  "CMakeFiles/attitude_shared.dir/src/wahbaf.c.o.d"
+  "libattitude.pdb"
+  "libattitude.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/attitude_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
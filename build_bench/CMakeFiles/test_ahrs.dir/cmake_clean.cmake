@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ahrs.dir/tests/test_ahrs.c.o"
+  "CMakeFiles/test_ahrs.dir/tests/test_ahrs.c.o.d"
+  "test_ahrs"
+  "test_ahrs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_ahrs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_attitude.dir/tests/test_attitude.c.o"
+  "CMakeFiles/test_attitude.dir/tests/test_attitude.c.o.d"
+  "test_attitude"
+  "test_attitude.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_attitude.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
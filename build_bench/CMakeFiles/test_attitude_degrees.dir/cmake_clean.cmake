@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_attitude_degrees.dir/tests/test_attitude_degrees.c.o"
+  "CMakeFiles/test_attitude_degrees.dir/tests/test_attitude_degrees.c.o.d"
+  "test_attitude_degrees"
+  "test_attitude_degrees.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_attitude_degrees.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
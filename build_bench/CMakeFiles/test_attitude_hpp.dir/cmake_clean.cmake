@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_attitude_hpp.dir/tests/test_attitude_hpp.cpp.o"
+  "CMakeFiles/test_attitude_hpp.dir/tests/test_attitude_hpp.cpp.o.d"
+  "test_attitude_hpp"
+  "test_attitude_hpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_attitude_hpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_attitude_log.dir/tests/test_attitude_log.c.o"
+  "CMakeFiles/test_attitude_log.dir/tests/test_attitude_log.c.o.d"
+  "test_attitude_log"
+  "test_attitude_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_attitude_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
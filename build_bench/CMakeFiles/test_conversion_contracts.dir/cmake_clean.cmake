@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_conversion_contracts.dir/tests/test_conversion_contracts.c.o"
+  "CMakeFiles/test_conversion_contracts.dir/tests/test_conversion_contracts.c.o.d"
+  "test_conversion_contracts"
+  "test_conversion_contracts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_conversion_contracts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
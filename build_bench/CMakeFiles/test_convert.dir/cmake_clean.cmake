@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convert.dir/tests/test_convert.c.o"
+  "CMakeFiles/test_convert.dir/tests/test_convert.c.o.d"
+  "test_convert"
+  "test_convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
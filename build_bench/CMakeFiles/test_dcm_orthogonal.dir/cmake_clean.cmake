@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dcm_orthogonal.dir/tests/test_dcm_orthogonal.c.o"
+  "CMakeFiles/test_dcm_orthogonal.dir/tests/test_dcm_orthogonal.c.o.d"
+  "test_dcm_orthogonal"
+  "test_dcm_orthogonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dcm_orthogonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dcm_orthonormalize.dir/tests/test_dcm_orthonormalize.c.o"
+  "CMakeFiles/test_dcm_orthonormalize.dir/tests/test_dcm_orthonormalize.c.o.d"
+  "test_dcm_orthonormalize"
+  "test_dcm_orthonormalize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dcm_orthonormalize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dcm_unchecked.dir/tests/test_dcm_unchecked.c.o"
+  "CMakeFiles/test_dcm_unchecked.dir/tests/test_dcm_unchecked.c.o.d"
+  "test_dcm_unchecked"
+  "test_dcm_unchecked.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dcm_unchecked.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_euler.dir/tests/test_euler.c.o"
+  "CMakeFiles/test_euler.dir/tests/test_euler.c.o.d"
+  "test_euler"
+  "test_euler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_euler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
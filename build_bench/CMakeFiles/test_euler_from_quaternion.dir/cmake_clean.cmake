@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_euler_from_quaternion.dir/tests/test_euler_from_quaternion.c.o"
+  "CMakeFiles/test_euler_from_quaternion.dir/tests/test_euler_from_quaternion.c.o.d"
+  "test_euler_from_quaternion"
+  "test_euler_from_quaternion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_euler_from_quaternion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
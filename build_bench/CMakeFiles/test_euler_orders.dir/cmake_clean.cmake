@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_euler_orders.dir/tests/test_euler_orders.c.o"
+  "CMakeFiles/test_euler_orders.dir/tests/test_euler_orders.c.o.d"
+  "test_euler_orders"
+  "test_euler_orders.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_euler_orders.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
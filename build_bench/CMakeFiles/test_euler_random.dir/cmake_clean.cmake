@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_euler_random.dir/tests/test_euler_random.c.o"
+  "CMakeFiles/test_euler_random.dir/tests/test_euler_random.c.o.d"
+  "test_euler_random"
+  "test_euler_random.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_euler_random.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_float_api.dir/tests/test_float_api.c.o"
+  "CMakeFiles/test_float_api.dir/tests/test_float_api.c.o.d"
+  "test_float_api"
+  "test_float_api.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_float_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inline.dir/tests/test_inline.c.o"
+  "CMakeFiles/test_inline.dir/tests/test_inline.c.o.d"
+  "test_inline"
+  "test_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
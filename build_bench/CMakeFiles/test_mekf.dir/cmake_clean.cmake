@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mekf.dir/tests/test_mekf.c.o"
+  "CMakeFiles/test_mekf.dir/tests/test_mekf.c.o.d"
+  "test_mekf"
+  "test_mekf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_mekf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
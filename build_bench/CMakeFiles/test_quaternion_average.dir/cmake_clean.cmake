@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_average.dir/tests/test_quaternion_average.c.o"
+  "CMakeFiles/test_quaternion_average.dir/tests/test_quaternion_average.c.o.d"
+  "test_quaternion_average"
+  "test_quaternion_average.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_average.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
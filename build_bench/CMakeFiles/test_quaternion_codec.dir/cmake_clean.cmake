@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_codec.dir/tests/test_quaternion_codec.c.o"
+  "CMakeFiles/test_quaternion_codec.dir/tests/test_quaternion_codec.c.o.d"
+  "test_quaternion_codec"
+  "test_quaternion_codec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_codec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
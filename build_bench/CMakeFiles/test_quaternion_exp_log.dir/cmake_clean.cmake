@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_exp_log.dir/tests/test_quaternion_exp_log.c.o"
+  "CMakeFiles/test_quaternion_exp_log.dir/tests/test_quaternion_exp_log.c.o.d"
+  "test_quaternion_exp_log"
+  "test_quaternion_exp_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_exp_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_inverse_axis.dir/tests/test_quaternion_inverse_axis.c.o"
+  "CMakeFiles/test_quaternion_inverse_axis.dir/tests/test_quaternion_inverse_axis.c.o.d"
+  "test_quaternion_inverse_axis"
+  "test_quaternion_inverse_axis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_inverse_axis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_relative.dir/tests/test_quaternion_relative.c.o"
+  "CMakeFiles/test_quaternion_relative.dir/tests/test_quaternion_relative.c.o.d"
+  "test_quaternion_relative"
+  "test_quaternion_relative.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_relative.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_rotate.dir/tests/test_quaternion_rotate.c.o"
+  "CMakeFiles/test_quaternion_rotate.dir/tests/test_quaternion_rotate.c.o.d"
+  "test_quaternion_rotate"
+  "test_quaternion_rotate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_rotate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
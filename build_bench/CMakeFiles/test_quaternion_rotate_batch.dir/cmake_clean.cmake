@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_rotate_batch.dir/tests/test_quaternion_rotate_batch.c.o"
+  "CMakeFiles/test_quaternion_rotate_batch.dir/tests/test_quaternion_rotate_batch.c.o.d"
+  "test_quaternion_rotate_batch"
+  "test_quaternion_rotate_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_rotate_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_rotate_explicit_demo.dir/tests/test_quaternion_rotate_explicit_demo.c.o"
+  "CMakeFiles/test_quaternion_rotate_explicit_demo.dir/tests/test_quaternion_rotate_explicit_demo.c.o.d"
+  "test_quaternion_rotate_explicit_demo"
+  "test_quaternion_rotate_explicit_demo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_rotate_explicit_demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_slerp.dir/tests/test_quaternion_slerp.c.o"
+  "CMakeFiles/test_quaternion_slerp.dir/tests/test_quaternion_slerp.c.o.d"
+  "test_quaternion_slerp"
+  "test_quaternion_slerp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_slerp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
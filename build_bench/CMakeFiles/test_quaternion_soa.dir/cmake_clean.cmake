@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quaternion_soa.dir/tests/test_quaternion_soa.c.o"
+  "CMakeFiles/test_quaternion_soa.dir/tests/test_quaternion_soa.c.o.d"
+  "test_quaternion_soa"
+  "test_quaternion_soa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quaternion_soa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
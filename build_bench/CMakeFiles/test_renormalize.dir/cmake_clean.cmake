@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_renormalize.dir/tests/test_renormalize.c.o"
+  "CMakeFiles/test_renormalize.dir/tests/test_renormalize.c.o.d"
+  "test_renormalize"
+  "test_renormalize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_renormalize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_slerp_fast.dir/tests/test_slerp_fast.c.o"
+  "CMakeFiles/test_slerp_fast.dir/tests/test_slerp_fast.c.o.d"
+  "test_slerp_fast"
+  "test_slerp_fast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_slerp_fast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_slerp_segment.dir/tests/test_slerp_segment.c.o"
+  "CMakeFiles/test_slerp_segment.dir/tests/test_slerp_segment.c.o.d"
+  "test_slerp_segment"
+  "test_slerp_segment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_slerp_segment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_spline.dir/tests/test_spline.c.o"
+  "CMakeFiles/test_spline.dir/tests/test_spline.c.o.d"
+  "test_spline"
+  "test_spline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_spline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
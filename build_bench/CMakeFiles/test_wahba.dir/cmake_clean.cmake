@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wahba.dir/tests/test_wahba.c.o"
+  "CMakeFiles/test_wahba.dir/tests/test_wahba.c.o.d"
+  "test_wahba"
+  "test_wahba.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wahba.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
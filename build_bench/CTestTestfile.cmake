@@ -0,0 +1,94 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/build_bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_ahrs "/root/repo/build_bench/test_ahrs")
+set_tests_properties(test_ahrs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_attitude "/root/repo/build_bench/test_attitude")
+set_tests_properties(test_attitude PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_attitude_degrees "/root/repo/build_bench/test_attitude_degrees")
+set_tests_properties(test_attitude_degrees PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_attitude_log "/root/repo/build_bench/test_attitude_log")
+set_tests_properties(test_attitude_log PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_conversion_contracts "/root/repo/build_bench/test_conversion_contracts")
+set_tests_properties(test_conversion_contracts PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_convert "/root/repo/build_bench/test_convert")
+set_tests_properties(test_convert PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_dcm_orthogonal "/root/repo/build_bench/test_dcm_orthogonal")
+set_tests_properties(test_dcm_orthogonal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_dcm_orthonormalize "/root/repo/build_bench/test_dcm_orthonormalize")
+set_tests_properties(test_dcm_orthonormalize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_dcm_unchecked "/root/repo/build_bench/test_dcm_unchecked")
+set_tests_properties(test_dcm_unchecked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_euler "/root/repo/build_bench/test_euler")
+set_tests_properties(test_euler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_euler_from_quaternion "/root/repo/build_bench/test_euler_from_quaternion")
+set_tests_properties(test_euler_from_quaternion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_euler_orders "/root/repo/build_bench/test_euler_orders")
+set_tests_properties(test_euler_orders PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_euler_random "/root/repo/build_bench/test_euler_random")
+set_tests_properties(test_euler_random PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_fixed_point "/root/repo/build_bench/test_fixed_point")
+set_tests_properties(test_fixed_point PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_float_api "/root/repo/build_bench/test_float_api")
+set_tests_properties(test_float_api PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_inline "/root/repo/build_bench/test_inline")
+set_tests_properties(test_inline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_kinematics "/root/repo/build_bench/test_kinematics")
+set_tests_properties(test_kinematics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_mekf "/root/repo/build_bench/test_mekf")
+set_tests_properties(test_mekf PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion "/root/repo/build_bench/test_quaternion")
+set_tests_properties(test_quaternion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_average "/root/repo/build_bench/test_quaternion_average")
+set_tests_properties(test_quaternion_average PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_codec "/root/repo/build_bench/test_quaternion_codec")
+set_tests_properties(test_quaternion_codec PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_exp_log "/root/repo/build_bench/test_quaternion_exp_log")
+set_tests_properties(test_quaternion_exp_log PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_inverse_axis "/root/repo/build_bench/test_quaternion_inverse_axis")
+set_tests_properties(test_quaternion_inverse_axis PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_relative "/root/repo/build_bench/test_quaternion_relative")
+set_tests_properties(test_quaternion_relative PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_rotate "/root/repo/build_bench/test_quaternion_rotate")
+set_tests_properties(test_quaternion_rotate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_rotate_batch "/root/repo/build_bench/test_quaternion_rotate_batch")
+set_tests_properties(test_quaternion_rotate_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_rotate_explicit_demo "/root/repo/build_bench/test_quaternion_rotate_explicit_demo")
+set_tests_properties(test_quaternion_rotate_explicit_demo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_slerp "/root/repo/build_bench/test_quaternion_slerp")
+set_tests_properties(test_quaternion_slerp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quaternion_soa "/root/repo/build_bench/test_quaternion_soa")
+set_tests_properties(test_quaternion_soa PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_renormalize "/root/repo/build_bench/test_renormalize")
+set_tests_properties(test_renormalize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rotation "/root/repo/build_bench/test_rotation")
+set_tests_properties(test_rotation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_slerp_fast "/root/repo/build_bench/test_slerp_fast")
+set_tests_properties(test_slerp_fast PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_slerp_segment "/root/repo/build_bench/test_slerp_segment")
+set_tests_properties(test_slerp_segment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spline "/root/repo/build_bench/test_spline")
+set_tests_properties(test_spline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_wahba "/root/repo/build_bench/test_wahba")
+set_tests_properties(test_wahba PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;130;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_attitude_hpp "/root/repo/build_bench/test_attitude_hpp")
+set_tests_properties(test_attitude_hpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;145;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_bench_smoke "/root/repo/build_bench/attitude_bench" "--format" "json" "--warmup" "0" "--reps" "1" "--sample-us" "1")
+set_tests_properties(test_bench_smoke PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;158;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_to_bin "/root/repo/build_bench/attitude_logconv" "to-bin" "/root/repo/tests/data/attitude_log.csv" "attitude_log.alog")
+set_tests_properties(test_logconv_attitude_log_to_bin PROPERTIES  FIXTURES_SETUP "attitude_log_bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;165;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_to_csv "/root/repo/build_bench/attitude_logconv" "to-csv" "attitude_log.alog" "attitude_log.csv")
+set_tests_properties(test_logconv_attitude_log_to_csv PROPERTIES  FIXTURES_REQUIRED "attitude_log_bin" FIXTURES_SETUP "attitude_log_csv" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;168;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_roundtrip "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/data/attitude_log.csv" "attitude_log.csv")
+set_tests_properties(test_logconv_attitude_log_roundtrip PROPERTIES  FIXTURES_REQUIRED "attitude_log_csv" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;170;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_rate_to_bin "/root/repo/build_bench/attitude_logconv" "to-bin" "/root/repo/tests/data/attitude_log_rate.csv" "attitude_log_rate.alog")
+set_tests_properties(test_logconv_attitude_log_rate_to_bin PROPERTIES  FIXTURES_SETUP "attitude_log_rate_bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;165;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_rate_to_csv "/root/repo/build_bench/attitude_logconv" "to-csv" "attitude_log_rate.alog" "attitude_log_rate.csv")
+set_tests_properties(test_logconv_attitude_log_rate_to_csv PROPERTIES  FIXTURES_REQUIRED "attitude_log_rate_bin" FIXTURES_SETUP "attitude_log_rate_csv" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;168;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_logconv_attitude_log_rate_roundtrip "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/data/attitude_log_rate.csv" "attitude_log_rate.csv")
+set_tests_properties(test_logconv_attitude_log_rate_roundtrip PROPERTIES  FIXTURES_REQUIRED "attitude_log_rate_csv" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;170;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_scipy_quaternion_parity "/root/.pyenv/shims/python3" "/root/repo/tests/reference/test_scipy_quaternion_parity.py" "--library" "/root/repo/build_bench/libattitude.so")
+set_tests_properties(test_scipy_quaternion_parity PROPERTIES  SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;200;add_test;/root/repo/CMakeLists.txt;0;")
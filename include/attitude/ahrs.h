@@ -0,0 +1,229 @@
+#ifndef ATTITUDE_AHRS_H
+#define ATTITUDE_AHRS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file ahrs.h
+ * @brief Mahony and Madgwick complementary attitude filters (AHRS).
+ *
+ * Both filters keep a body-to-world quaternion @f$q = [w, x, y, z]@f$, propagate it with the
+ * gyro and pull it towards the attitude implied by the accelerometer (IMU variant) or the
+ * accelerometer and magnetometer (MARG variant). The world frame has @f$z@f$ up, so a
+ * stationary accelerometer reads @f$R^T [0, 0, 1]@f$ after normalisation, and @f$x@f$ along
+ * the horizontal component of the magnetic field (magnetic north for a north-east-up
+ * convention with @f$y@f$ pointing west). Only the directions of the accelerometer and
+ * magnetometer readings are used, so their units do not matter.
+ *
+ * Filters are plain structs updated in place; nothing is allocated. The rotation matrix of
+ * @f$q@f$ is formed once per update and the accelerometer and magnetometer are normalised once
+ * each. A zero accelerometer (free fall) skips the correction and a zero magnetometer falls
+ * back to the IMU update.
+ *
+ * - Mahony (Mahony, Hamel and Pflimlin 2008): the cross product between measured and
+ *   predicted directions is fed back into the gyro rate through a PI controller, so the
+ *   integral term converges to minus the gyro bias. The corrected rate is integrated with the
+ *   exponential map, exactly as kinematics_integrate_exp().
+ * - Madgwick (2010): one normalised gradient-descent step on the measurement error of size
+ *   @f$\beta\,dt@f$ is subtracted from the gyro quaternion derivative, which is then
+ *   integrated to first order.
+ *
+ * Both renormalise the result as quaternion_renormalize() does. Mahony's exponential-map step
+ * keeps the norm within rounding of one, so it always takes the division-free series instead
+ * of a second square root; its only other branch is the exponential map's fallback to sqrt,
+ * sin and cos for steps above about 0.15 rad (1 rad in single precision), as in
+ * kinematics_propagate(). Madgwick's first-order step moves the squared norm by about
+ * @f$(|\omega|\,dt/2)^2@f$ plus the gradient step, @f$2.5\times10^{-5}@f$ at 1 rad/s and
+ * 100 Hz, so its correction uses a square root unless the step is small: @f$|\omega|\,dt@f$
+ * below about @f$4\times10^{-3}@f$ rad in double precision, @f$0.1@f$ rad in single precision.
+ */
+
+/**
+ * @brief Mahony filter state; initialise with ahrs_mahony_init().
+ *
+ * All fields may be read or adjusted between updates (for example to re-seed @c q).
+ */
+typedef struct {
+    double q[4];         ///< Body-to-world attitude @f$[w, x, y, z]@f$.
+    double integral[3];  ///< Integral feedback (rad/s); converges to minus the gyro bias.
+    double kp;           ///< Proportional gain (rad/s per unit error).
+    double ki;           ///< Integral gain (rad/s^2 per unit error); 0 disables bias estimation.
+} MahonyFilter;
+
+/**
+ * @brief Madgwick filter state; initialise with ahrs_madgwick_init().
+ */
+typedef struct {
+    double q[4];  ///< Body-to-world attitude @f$[w, x, y, z]@f$.
+    double beta;  ///< Gradient step rate (rad/s); roughly the gyro error it can correct.
+} MadgwickFilter;
+
+/** @brief Single-precision Mahony state, used by the @c ahrsf_mahony_* functions. */
+typedef struct {
+    float q[4];         ///< Body-to-world attitude @f$[w, x, y, z]@f$.
+    float integral[3];  ///< Integral feedback (rad/s); converges to minus the gyro bias.
+    float kp;           ///< Proportional gain.
+    float ki;           ///< Integral gain.
+} MahonyFilterf;
+
+/** @brief Single-precision Madgwick state, used by the @c ahrsf_madgwick_* functions. */
+typedef struct {
+    float q[4];  ///< Body-to-world attitude @f$[w, x, y, z]@f$.
+    float beta;  ///< Gradient step rate (rad/s).
+} MadgwickFilterf;
+
+/**
+ * @brief Reset a Mahony filter.
+ *
+ * @param filter  Filter to initialise.
+ * @param q0      Initial attitude, normalised on the way in; NULL for the identity.
+ * @param kp      Proportional gain, e.g. 1.0; must be finite and non-negative.
+ * @param ki      Integral gain, e.g. 0.05; must be finite and non-negative.
+ * @return 1 on success; 0 (filter unchanged) for a NULL filter, a zero or non-finite
+ *         @p q0, or an invalid gain.
+ */
+int ahrs_mahony_init(MahonyFilter *filter, const double q0[4], double kp, double ki);
+
+/**
+ * @brief One Mahony update from gyro and accelerometer.
+ *
+ * @param filter  Filter state, updated in place.
+ * @param gyro    Body angular rate (rad/s).
+ * @param accel   Accelerometer reading, any scale; all zeros skips the correction.
+ * @param dt      Step length (s).
+ * @return 1 on success; 0 (filter unchanged) for null pointers or non-finite inputs.
+ */
+int ahrs_mahony_update_imu(MahonyFilter *filter, const double gyro[3], const double accel[3], double dt);
+
+/**
+ * @brief One Mahony update from gyro, accelerometer and magnetometer.
+ *
+ * Same as ahrs_mahony_update_imu() with a heading correction from @p mag, which is taken
+ * relative to its own horizontal projection so the magnetic dip does not need to be known.
+ * All-zero @p mag falls back to the IMU update.
+ */
+int ahrs_mahony_update_marg(MahonyFilter *filter,
+                            const double gyro[3],
+                            const double accel[3],
+                            const double mag[3],
+                            double dt);
+
+/**
+ * @brief Replay a recorded sensor buffer through a Mahony filter.
+ *
+ * Runs the updates back to back, bit-identical to calling ahrs_mahony_update_marg() (or
+ * ahrs_mahony_update_imu() when @p mag is NULL) once per sample. A sample that is rejected
+ * leaves the state as it was and the replay continues with the next one.
+ *
+ * @param filter  Filter state, updated in place.
+ * @param gyro    @p count rates packed as @c [count][3] (rad/s).
+ * @param accel   @p count accelerometer readings packed as @c [count][3].
+ * @param mag     @p count magnetometer readings packed as @c [count][3], or NULL for IMU.
+ * @param count   Number of samples.
+ * @param dt      Sample period (s).
+ * @param q_out   Attitude after every sample, packed as @c [count][4]; may be NULL when only
+ *                the final state is wanted.
+ * @return 1 if every sample was accepted; 0 if any was rejected, or (nothing processed) for a
+ *         NULL filter, NULL required buffers with @p count > 0, or a non-finite @p dt.
+ */
+int ahrs_mahony_replay(MahonyFilter *filter,
+                       const double *gyro,
+                       const double *accel,
+                       const double *mag,
+                       size_t count,
+                       double dt,
+                       double *q_out);
+
+/**
+ * @brief Reset a Madgwick filter.
+ *
+ * @param filter  Filter to initialise.
+ * @param q0      Initial attitude, normalised on the way in; NULL for the identity.
+ * @param beta    Gradient step rate, e.g. 0.1 rad/s; must be finite and non-negative.
+ * @return 1 on success; 0 (filter unchanged) for a NULL filter, a zero or non-finite
+ *         @p q0, or an invalid @p beta.
+ */
+int ahrs_madgwick_init(MadgwickFilter *filter, const double q0[4], double beta);
+
+/** @brief One Madgwick update from gyro and accelerometer; see ahrs_mahony_update_imu(). */
+int ahrs_madgwick_update_imu(MadgwickFilter *filter, const double gyro[3], const double accel[3], double dt);
+
+/** @brief One Madgwick update from gyro, accelerometer and magnetometer; see ahrs_mahony_update_marg(). */
+int ahrs_madgwick_update_marg(MadgwickFilter *filter,
+                              const double gyro[3],
+                              const double accel[3],
+                              const double mag[3],
+                              double dt);
+
+/** @brief Replay a recorded sensor buffer through a Madgwick filter; see ahrs_mahony_replay(). */
+int ahrs_madgwick_replay(MadgwickFilter *filter,
+                         const double *gyro,
+                         const double *accel,
+                         const double *mag,
+                         size_t count,
+                         double dt,
+                         double *q_out);
+
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision AHRS API
+ *
+ * Float counterparts of the functions above, generated from the same source.
+ * @{
+ */
+/** @brief Single-precision variant of ahrs_mahony_init(). */
+int ahrsf_mahony_init(MahonyFilterf *filter, const float q0[4], float kp, float ki);
+
+/** @brief Single-precision variant of ahrs_mahony_update_imu(). */
+int ahrsf_mahony_update_imu(MahonyFilterf *filter, const float gyro[3], const float accel[3], float dt);
+
+/** @brief Single-precision variant of ahrs_mahony_update_marg(). */
+int ahrsf_mahony_update_marg(MahonyFilterf *filter,
+                             const float gyro[3],
+                             const float accel[3],
+                             const float mag[3],
+                             float dt);
+
+/** @brief Single-precision variant of ahrs_mahony_replay(). */
+int ahrsf_mahony_replay(MahonyFilterf *filter,
+                        const float *gyro,
+                        const float *accel,
+                        const float *mag,
+                        size_t count,
+                        float dt,
+                        float *q_out);
+
+/** @brief Single-precision variant of ahrs_madgwick_init(). */
+int ahrsf_madgwick_init(MadgwickFilterf *filter, const float q0[4], float beta);
+
+/** @brief Single-precision variant of ahrs_madgwick_update_imu(). */
+int ahrsf_madgwick_update_imu(MadgwickFilterf *filter, const float gyro[3], const float accel[3], float dt);
+
+/** @brief Single-precision variant of ahrs_madgwick_update_marg(). */
+int ahrsf_madgwick_update_marg(MadgwickFilterf *filter,
+                               const float gyro[3],
+                               const float accel[3],
+                               const float mag[3],
+                               float dt);
+
+/** @brief Single-precision variant of ahrs_madgwick_replay(). */
+int ahrsf_madgwick_replay(MadgwickFilterf *filter,
+                          const float *gyro,
+                          const float *accel,
+                          const float *mag,
+                          size_t count,
+                          float dt,
+                          float *q_out);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_AHRS_H
@@ -0,0 +1,387 @@
+#ifndef ATTITUDE_ATTITUDE_HPP
+#define ATTITUDE_ATTITUDE_HPP
+
+/**
+ * @file attitude.hpp
+ * @brief Header-only C++17 value types over the C array layout.
+ *
+ * attitude::Quaternion<T>, attitude::Dcm<T> and attitude::Vec3<T> are standard-layout
+ * aggregates holding exactly a @c T[4], @c T[3][3] and @c T[3], so data() hands the C
+ * functions the same pointer they would get from a plain array and no copy is made in either
+ * direction.
+ *
+ * Construction from Euler angles, axis/angle and matrices, composition, rotation and the
+ * quaternion/DCM conversions are @c constexpr. A fixed mounting rotation declared as
+ * @code
+ * constexpr auto q_imu_to_body = attitude::Quaterniond::from_euler(0.0, 0.0, M_PI / 2.0);
+ * @endcode
+ * is therefore evaluated by the compiler instead of calling euler_to_quaternion() at
+ * startup. The conventions (Hamilton product, @f$[w, x, y, z]@f$ order, row-major active
+ * rotation matrices, the EulerOrder field layout) are those of the C API, and the formulas
+ * are the library's own; the only difference is that the trigonometric functions and square
+ * root are evaluated by the series below, which agree with libm to a few ULP.
+ *
+ * Only euler.h is included (for ::EulerOrder), so the header needs no library to link.
+ */
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "attitude/euler.h"
+
+namespace attitude {
+
+namespace detail {
+
+template <typename T>
+struct SinCos {
+    T s;
+    T c;
+};
+
+/*
+ * Constant-expression sin/cos: Cody-Waite reduction by pi/2 with a two-part constant, then
+ * Taylor series on |r| <= pi/4, where the truncation term is below 2^-60. Intended for angles
+ * of a few turns, which is what mounting transforms use.
+ */
+template <typename T>
+constexpr SinCos<T> sin_cos(T angle) {
+    constexpr double two_over_pi = 0.636619772367581343075535053490057448;
+    constexpr double pio2_hi = 1.57079632673412561417e+00;
+    constexpr double pio2_lo = 6.07710050650619224932e-11;
+
+    const double x = static_cast<double>(angle);
+    if (!(x - x == 0.0)) {
+        const T nan = std::numeric_limits<T>::quiet_NaN();
+        return {nan, nan};
+    }
+    const double scaled = x * two_over_pi;
+    const long long n = static_cast<long long>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+    const double r = (x - static_cast<double>(n) * pio2_hi) - static_cast<double>(n) * pio2_lo;
+    const double r2 = r * r;
+
+    double s = 0.0;
+    double c = 0.0;
+    for (int k = 11; k >= 1; --k) {
+        s = 1.0 - s * r2 / static_cast<double>((2 * k) * (2 * k + 1));
+        c = 1.0 - c * r2 / static_cast<double>((2 * k - 1) * (2 * k));
+    }
+    s *= r;
+
+    switch (static_cast<int>(n & 3)) {
+    case 0:
+        return {static_cast<T>(s), static_cast<T>(c)};
+    case 1:
+        return {static_cast<T>(c), static_cast<T>(-s)};
+    case 2:
+        return {static_cast<T>(-s), static_cast<T>(-c)};
+    default:
+        return {static_cast<T>(-c), static_cast<T>(s)};
+    }
+}
+
+/* Constant-expression square root: scale into [1, 4) by powers of 4, then Newton from a linear
+ * start. Returns 0 for non-positive input and the input itself for infinity or NaN. */
+template <typename T>
+constexpr T sqrt(T value) {
+    if (!(value > T(0)) || value > std::numeric_limits<T>::max()) {
+        return value > T(0) || value != value ? value : T(0);
+    }
+    double x = static_cast<double>(value);
+    double scale = 1.0;
+    while (x >= 4.0) {
+        x *= 0.25;
+        scale *= 2.0;
+    }
+    while (x < 1.0) {
+        x *= 4.0;
+        scale *= 0.5;
+    }
+    double y = 0.5 + 0.5 * x;
+    for (int iteration = 0; iteration < 6; ++iteration) {
+        y = 0.5 * (y + x / y);
+    }
+    return static_cast<T>(y * scale);
+}
+
+/* Axis table for EulerOrder: R = R_i(a) R_j(b) R_k(c); see src/euler_sequence.h. */
+struct EulerAxes {
+    int i;
+    int j;
+    int k;
+    bool extrinsic;
+    bool valid;
+};
+
+constexpr EulerAxes euler_axes(EulerOrder order) {
+    switch (order) {
+    case EULER_XYZ: return {0, 1, 2, false, true};
+    case EULER_XZY: return {0, 2, 1, false, true};
+    case EULER_YXZ: return {1, 0, 2, false, true};
+    case EULER_YZX: return {1, 2, 0, false, true};
+    case EULER_ZXY: return {2, 0, 1, false, true};
+    case EULER_ZYX: return {2, 1, 0, false, true};
+    case EULER_XYX: return {0, 1, 0, false, true};
+    case EULER_XZX: return {0, 2, 0, false, true};
+    case EULER_YXY: return {1, 0, 1, false, true};
+    case EULER_YZY: return {1, 2, 1, false, true};
+    case EULER_ZXZ: return {2, 0, 2, false, true};
+    case EULER_ZYZ: return {2, 1, 2, false, true};
+    case EULER_EXTRINSIC_XYZ: return {2, 1, 0, true, true};
+    case EULER_EXTRINSIC_XZY: return {1, 2, 0, true, true};
+    case EULER_EXTRINSIC_YXZ: return {2, 0, 1, true, true};
+    case EULER_EXTRINSIC_YZX: return {0, 2, 1, true, true};
+    case EULER_EXTRINSIC_ZXY: return {1, 0, 2, true, true};
+    case EULER_EXTRINSIC_ZYX: return {0, 1, 2, true, true};
+    case EULER_EXTRINSIC_XYX: return {0, 1, 0, true, true};
+    case EULER_EXTRINSIC_XZX: return {0, 2, 0, true, true};
+    case EULER_EXTRINSIC_YXY: return {1, 0, 1, true, true};
+    case EULER_EXTRINSIC_YZY: return {1, 2, 1, true, true};
+    case EULER_EXTRINSIC_ZXZ: return {2, 0, 2, true, true};
+    case EULER_EXTRINSIC_ZYZ: return {2, 1, 2, true, true};
+    default: return {0, 0, 0, false, false};
+    }
+}
+
+}  // namespace detail
+
+/** @brief Three-vector; layout-identical to @c T[3]. */
+template <typename T>
+struct Vec3 {
+    T v[3];
+
+    static constexpr Vec3 from_array(const T (&a)[3]) { return {{a[0], a[1], a[2]}}; }
+
+    constexpr T &operator[](std::size_t index) { return v[index]; }
+    constexpr const T &operator[](std::size_t index) const { return v[index]; }
+
+    /** @brief Pointer for the C API, e.g. @c vector3_normalize(v.data()). */
+    constexpr T *data() { return v; }
+    constexpr const T *data() const { return v; }
+
+    constexpr Vec3 operator+(const Vec3 &o) const { return {{v[0] + o.v[0], v[1] + o.v[1], v[2] + o.v[2]}}; }
+    constexpr Vec3 operator-(const Vec3 &o) const { return {{v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2]}}; }
+    constexpr Vec3 operator*(T s) const { return {{v[0] * s, v[1] * s, v[2] * s}}; }
+
+    constexpr T dot(const Vec3 &o) const { return v[0] * o.v[0] + v[1] * o.v[1] + v[2] * o.v[2]; }
+    constexpr Vec3 cross(const Vec3 &o) const {
+        return {{v[1] * o.v[2] - v[2] * o.v[1], v[2] * o.v[0] - v[0] * o.v[2], v[0] * o.v[1] - v[1] * o.v[0]}};
+    }
+    constexpr T norm() const { return detail::sqrt(dot(*this)); }
+};
+
+template <typename T>
+struct Dcm;
+
+/** @brief Unit quaternion @f$[w, x, y, z]@f$; layout-identical to @c T[4]. */
+template <typename T>
+struct Quaternion {
+    T q[4];
+
+    static constexpr Quaternion identity() { return {{T(1), T(0), T(0), T(0)}}; }
+
+    static constexpr Quaternion from_array(const T (&a)[4]) { return {{a[0], a[1], a[2], a[3]}}; }
+
+    /** @brief Rotation by @p angle radians about @p axis (normalised here; zero gives identity). */
+    static constexpr Quaternion from_axis_angle(const Vec3<T> &axis, T angle) {
+        const T length = axis.norm();
+        if (!(length > T(0))) {
+            return identity();
+        }
+        const detail::SinCos<T> half = detail::sin_cos(angle / T(2));
+        const T s = half.s / length;
+        return {{half.c, axis.v[0] * s, axis.v[1] * s, axis.v[2] * s}};
+    }
+
+    /**
+     * @brief Same result as euler_to_quaternion() for an EulerAngles with these fields.
+     *
+     * The field meaning follows euler.h: Tait-Bryan orders keep roll/pitch/yaw on x/y/z,
+     * proper-Euler orders put yaw on the first axis, pitch on the middle and roll on the last.
+     * An invalid order gives NaN, as the C function does.
+     */
+    static constexpr Quaternion from_euler(T roll, T pitch, T yaw, EulerOrder order = EULER_ZYX) {
+        const detail::EulerAxes axes = detail::euler_axes(order);
+        if (!axes.valid) {
+            const T nan = std::numeric_limits<T>::quiet_NaN();
+            return {{nan, nan, nan, nan}};
+        }
+        const T by_axis[3] = {roll, pitch, yaw};
+        T angle[3] = {by_axis[axes.i], by_axis[axes.j], by_axis[axes.k]};
+        if (axes.i == axes.k) {
+            angle[0] = axes.extrinsic ? roll : yaw;
+            angle[1] = pitch;
+            angle[2] = axes.extrinsic ? yaw : roll;
+        }
+
+        const T e = (axes.j - axes.i + 3) % 3 == 1 ? T(1) : T(-1);
+        const detail::SinCos<T> a = detail::sin_cos(angle[0] / T(2));
+        const detail::SinCos<T> b = detail::sin_cos(angle[1] / T(2));
+        const detail::SinCos<T> c = detail::sin_cos(angle[2] / T(2));
+
+        Quaternion out{};
+        if (axes.i != axes.k) {
+            out.q[0] = a.c*b.c*c.c - e*a.s*b.s*c.s;
+            out.q[1 + axes.i] = a.s*b.c*c.c + e*a.c*b.s*c.s;
+            out.q[1 + axes.j] = a.c*b.s*c.c - e*a.s*b.c*c.s;
+            out.q[1 + axes.k] = a.c*b.c*c.s + e*a.s*b.s*c.c;
+        } else {
+            const int m = 3 - axes.i - axes.j;
+            out.q[0] = b.c*(a.c*c.c - a.s*c.s);
+            out.q[1 + axes.i] = b.c*(a.s*c.c + a.c*c.s);
+            out.q[1 + axes.j] = b.s*(a.c*c.c + a.s*c.s);
+            out.q[1 + m] = e*b.s*(a.s*c.c - a.c*c.s);
+        }
+        return out;
+    }
+
+    /** @brief Shepperd's method as in dcm_to_quaternion(); @f$w \ge 0@f$. No orthonormality check. */
+    static constexpr Quaternion from_dcm(const Dcm<T> &r) {
+        const auto &m = r.m;
+        const T trace = m[0][0] + m[1][1] + m[2][2];
+        Quaternion out{};
+        if (trace > T(0)) {
+            const T scale = T(2) * detail::sqrt(trace + T(1));
+            out = {{T(0.25) * scale, (m[2][1] - m[1][2]) / scale, (m[0][2] - m[2][0]) / scale,
+                    (m[1][0] - m[0][1]) / scale}};
+        } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+            const T scale = T(2) * detail::sqrt(T(1) + m[0][0] - m[1][1] - m[2][2]);
+            out = {{(m[2][1] - m[1][2]) / scale, T(0.25) * scale, (m[0][1] + m[1][0]) / scale,
+                    (m[0][2] + m[2][0]) / scale}};
+        } else if (m[1][1] > m[2][2]) {
+            const T scale = T(2) * detail::sqrt(T(1) + m[1][1] - m[0][0] - m[2][2]);
+            out = {{(m[0][2] - m[2][0]) / scale, (m[0][1] + m[1][0]) / scale, T(0.25) * scale,
+                    (m[1][2] + m[2][1]) / scale}};
+        } else {
+            const T scale = T(2) * detail::sqrt(T(1) + m[2][2] - m[0][0] - m[1][1]);
+            out = {{(m[1][0] - m[0][1]) / scale, (m[0][2] + m[2][0]) / scale, (m[1][2] + m[2][1]) / scale,
+                    T(0.25) * scale}};
+        }
+        out = out.normalized();
+        return out.q[0] < T(0) ? out * T(-1) : out;
+    }
+
+    constexpr T &operator[](std::size_t index) { return q[index]; }
+    constexpr const T &operator[](std::size_t index) const { return q[index]; }
+
+    /** @brief Pointer for the C API, e.g. @c quaternion_slerp(a.data(), b.data(), t, out.data()). */
+    constexpr T *data() { return q; }
+    constexpr const T *data() const { return q; }
+
+    /** @brief Hamilton product, as quaternion_multiply(). */
+    constexpr Quaternion operator*(const Quaternion &o) const {
+        const T w1 = q[0], x1 = q[1], y1 = q[2], z1 = q[3];
+        const T w2 = o.q[0], x2 = o.q[1], y2 = o.q[2], z2 = o.q[3];
+        return {{w1*w2 - x1*x2 - y1*y2 - z1*z2,
+                 w1*x2 + x1*w2 + y1*z2 - z1*y2,
+                 w1*y2 - x1*z2 + y1*w2 + z1*x2,
+                 w1*z2 + x1*y2 - y1*x2 + z1*w2}};
+    }
+
+    constexpr Quaternion operator*(T s) const { return {{q[0] * s, q[1] * s, q[2] * s, q[3] * s}}; }
+
+    constexpr Quaternion conjugate() const { return {{q[0], -q[1], -q[2], -q[3]}}; }
+
+    constexpr T norm() const { return detail::sqrt(q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]); }
+
+    /** @brief Unit copy; a zero quaternion is returned unchanged. */
+    constexpr Quaternion normalized() const {
+        const T n = norm();
+        return n > T(0) ? Quaternion{{q[0] / n, q[1] / n, q[2] / n, q[3] / n}} : *this;
+    }
+
+    /** @brief Active rotation, same arithmetic as quaternion_rotate_vector(). */
+    constexpr Vec3<T> rotate(const Vec3<T> &v) const {
+        const T q0q0 = q[0] * q[0], q1q1 = q[1] * q[1], q2q2 = q[2] * q[2], q3q3 = q[3] * q[3];
+        const T q0q1 = q[0] * q[1], q0q2 = q[0] * q[2], q0q3 = q[0] * q[3];
+        const T q1q2 = q[1] * q[2], q1q3 = q[1] * q[3], q2q3 = q[2] * q[3];
+        const T x = v.v[0], y = v.v[1], z = v.v[2];
+        return {{(q0q0 + q1q1 - q2q2 - q3q3) * x + T(2) * (q1q2 - q0q3) * y + T(2) * (q1q3 + q0q2) * z,
+                 T(2) * (q1q2 + q0q3) * x + (q0q0 - q1q1 + q2q2 - q3q3) * y + T(2) * (q2q3 - q0q1) * z,
+                 T(2) * (q1q3 - q0q2) * x + T(2) * (q2q3 + q0q1) * y + (q0q0 - q1q1 - q2q2 + q3q3) * z}};
+    }
+
+    constexpr Dcm<T> to_dcm() const { return Dcm<T>::from_quaternion(*this); }
+};
+
+/** @brief Row-major rotation matrix; layout-identical to @c T[3][3]. */
+template <typename T>
+struct Dcm {
+    T m[3][3];
+
+    static constexpr Dcm identity() { return {{{T(1), T(0), T(0)}, {T(0), T(1), T(0)}, {T(0), T(0), T(1)}}}; }
+
+    static constexpr Dcm from_array(const T (&a)[3][3]) {
+        return {{{a[0][0], a[0][1], a[0][2]}, {a[1][0], a[1][1], a[1][2]}, {a[2][0], a[2][1], a[2][2]}}};
+    }
+
+    /** @brief Same formula as quaternion_to_dcm(). */
+    static constexpr Dcm from_quaternion(const Quaternion<T> &quat) {
+        const T w = quat.q[0], x = quat.q[1], y = quat.q[2], z = quat.q[3];
+        const T xx = x*x, yy = y*y, zz = z*z;
+        const T xy = x*y, xz = x*z, yz = y*z;
+        const T wx = w*x, wy = w*y, wz = w*z;
+        return {{{T(1) - T(2)*(yy + zz), T(2)*(xy - wz), T(2)*(xz + wy)},
+                 {T(2)*(xy + wz), T(1) - T(2)*(xx + zz), T(2)*(yz - wx)},
+                 {T(2)*(xz - wy), T(2)*(yz + wx), T(1) - T(2)*(xx + yy)}}};
+    }
+
+    /** @brief Matches euler_to_dcm() to rounding; built through the quaternion. */
+    static constexpr Dcm from_euler(T roll, T pitch, T yaw, EulerOrder order = EULER_ZYX) {
+        return from_quaternion(Quaternion<T>::from_euler(roll, pitch, yaw, order));
+    }
+
+    constexpr T (&operator[](std::size_t row))[3] { return m[row]; }
+    constexpr const T (&operator[](std::size_t row) const)[3] { return m[row]; }
+
+    /** @brief Row pointer for the C API, e.g. @c dcm_to_quaternion(r.data(), q.data()). */
+    constexpr T (*data())[3] { return m; }
+    constexpr const T (*data() const)[3] { return m; }
+
+    constexpr Dcm operator*(const Dcm &o) const {
+        Dcm out{};
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                out.m[row][col] = m[row][0] * o.m[0][col] + m[row][1] * o.m[1][col] + m[row][2] * o.m[2][col];
+            }
+        }
+        return out;
+    }
+
+    /** @brief As dcm_apply(). */
+    constexpr Vec3<T> operator*(const Vec3<T> &v) const {
+        return {{m[0][0]*v.v[0] + m[0][1]*v.v[1] + m[0][2]*v.v[2],
+                 m[1][0]*v.v[0] + m[1][1]*v.v[1] + m[1][2]*v.v[2],
+                 m[2][0]*v.v[0] + m[2][1]*v.v[1] + m[2][2]*v.v[2]}};
+    }
+
+    constexpr Dcm transpose() const {
+        return {{{m[0][0], m[1][0], m[2][0]}, {m[0][1], m[1][1], m[2][1]}, {m[0][2], m[1][2], m[2][2]}}};
+    }
+
+    constexpr Quaternion<T> to_quaternion() const { return Quaternion<T>::from_dcm(*this); }
+};
+
+using Vec3d = Vec3<double>;
+using Vec3f = Vec3<float>;
+using Quaterniond = Quaternion<double>;
+using Quaternionf = Quaternion<float>;
+using Dcmd = Dcm<double>;
+using Dcmf = Dcm<float>;
+
+// The zero-overhead interop relies on these: data() is the address of the object itself.
+static_assert(std::is_standard_layout<Quaterniond>::value && sizeof(Quaterniond) == sizeof(double[4]),
+              "Quaternion<double> must have the layout of double[4]");
+static_assert(std::is_standard_layout<Dcmd>::value && sizeof(Dcmd) == sizeof(double[3][3]),
+              "Dcm<double> must have the layout of double[3][3]");
+static_assert(std::is_standard_layout<Vec3d>::value && sizeof(Vec3d) == sizeof(double[3]),
+              "Vec3<double> must have the layout of double[3]");
+static_assert(std::is_trivially_copyable<Quaternionf>::value && sizeof(Quaternionf) == sizeof(float[4]),
+              "Quaternion<float> must have the layout of float[4]");
+static_assert(std::is_trivially_copyable<Dcmf>::value && sizeof(Dcmf) == sizeof(float[3][3]),
+              "Dcm<float> must have the layout of float[3][3]");
+
+}  // namespace attitude
+
+#endif // ATTITUDE_ATTITUDE_HPP
@@ -0,0 +1,203 @@
+#ifndef ATTITUDE_ATTITUDE_LOG_H
+#define ATTITUDE_ATTITUDE_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file attitude_log.h
+ * @brief Binary attitude log: streaming writer and zero-copy (memory-mapped) reader.
+ *
+ * File layout, all integers and doubles little-endian:
+ *
+ * | Offset | Size | Field                                                        |
+ * |--------|------|--------------------------------------------------------------|
+ * | 0      | 8    | Magic @c "ATTITLOG"                                          |
+ * | 8      | 2    | Format version, ::ATTITUDE_LOG_VERSION                       |
+ * | 10     | 2    | Header size in bytes (64 for version 1; readers skip extra)  |
+ * | 12     | 4    | Flags, ::ATTITUDE_LOG_HAS_RATE                               |
+ * | 16     | 48   | Reserved, zero                                               |
+ *
+ * The header is followed by blocks, each a 16-byte block header (magic @c "ABLK", a 32-bit
+ * record count @c n and 8 reserved bytes) and then the records of the block stored by column:
+ * @c n timestamps (double, seconds), @c n quaternions (4 doubles each, body-to-world
+ * @f$[w, x, y, z]@f$) and, with ::ATTITUDE_LOG_HAS_RATE, @c n body rates (3 doubles, rad/s).
+ *
+ * Storing columns is what makes the reader zero-copy: a block's quaternions are one contiguous
+ * @c double array, so an ::AttitudeLogBlock can be handed straight to quaternion_log_batch(),
+ * euler_from_quaternions(), attitude_convert() and the other batch functions. Every block is
+ * complete on its own, so a log cut short by a reset loses at most the block being written.
+ *
+ * The writer buffers one block in caller-supplied memory and emits it through a sink callback
+ * (or a stdio file); it never allocates. The reader needs a little-endian host.
+ */
+
+/** @brief Format version written by this library; readers accept versions up to this one. */
+#define ATTITUDE_LOG_VERSION 1u
+/** @brief Size of the version 1 file header. */
+#define ATTITUDE_LOG_HEADER_BYTES 64u
+/** @brief Size of a block header. */
+#define ATTITUDE_LOG_BLOCK_HEADER_BYTES 16u
+/** @brief Flag: every record carries a body rate. */
+#define ATTITUDE_LOG_HAS_RATE 0x1u
+
+/** @brief Bytes of one record with the given flags (40, or 64 with a rate). */
+#define ATTITUDE_LOG_RECORD_BYTES(flags) (((flags) & ATTITUDE_LOG_HAS_RATE) ? 64u : 40u)
+
+/**
+ * @brief Write callback of an ::AttitudeLogWriter.
+ *
+ * @return 1 when all @p size bytes were written, 0 on failure.
+ */
+typedef int (*AttitudeLogSink)(void *context, const void *data, size_t size);
+
+/** @brief Streaming, append-only writer; see attitude_log_writer_init(). */
+typedef struct {
+    AttitudeLogSink sink;     ///< Output callback.
+    void *context;            ///< Passed to @c sink.
+    unsigned char *buffer;    ///< Caller storage for one block, by column.
+    size_t capacity;          ///< Records per block.
+    size_t count;             ///< Records buffered in the current block.
+    uint64_t written;         ///< Records handed to the sink so far.
+    uint32_t flags;           ///< File flags.
+    int error;                ///< Sticky: set once the sink fails; later calls return 0.
+    void *file;               ///< stdio stream owned by attitude_log_writer_open_file(), else NULL.
+} AttitudeLogWriter;
+
+/** @brief One block of records, pointing into the reader's mapping. */
+typedef struct {
+    size_t count;              ///< Records in the block.
+    const double *timestamps;  ///< @c count timestamps (s).
+    const double *quaternions; ///< @c 4 * count quaternion components, record after record.
+    const double *rates;       ///< @c 3 * count body rates (rad/s), or NULL without ::ATTITUDE_LOG_HAS_RATE.
+} AttitudeLogBlock;
+
+/** @brief Reader over a log held in memory or mapped from a file. */
+typedef struct {
+    const unsigned char *data; ///< Start of the log.
+    size_t size;               ///< Bytes of the log.
+    size_t offset;             ///< Offset of the next block.
+    size_t header_bytes;       ///< Offset of the first block.
+    uint32_t flags;            ///< File flags.
+    uint16_t version;          ///< File format version.
+    int damaged;               ///< Set when iteration stopped at a truncated or corrupt block.
+    void *mapping;             ///< Mapping owned by attitude_log_reader_open_file(), else NULL.
+} AttitudeLogReader;
+
+/**
+ * @brief Start a log on @p sink: writes the file header and prepares to buffer records.
+ *
+ * @param writer        Writer to initialise.
+ * @param flags         ::ATTITUDE_LOG_HAS_RATE or 0.
+ * @param buffer        Storage for one block; @p buffer_bytes / ATTITUDE_LOG_RECORD_BYTES(flags)
+ *                      records are buffered before a block is written. This bounds both memory
+ *                      and the data lost if the vehicle resets.
+ * @param buffer_bytes  Size of @p buffer; at least one record.
+ * @param sink          Output callback.
+ * @param context       Passed to @p sink.
+ * @return 1 on success; 0 for null pointers, unknown flags, a buffer smaller than one record,
+ *         or a failing sink.
+ */
+int attitude_log_writer_init(AttitudeLogWriter *writer,
+                             uint32_t flags,
+                             void *buffer,
+                             size_t buffer_bytes,
+                             AttitudeLogSink sink,
+                             void *context);
+
+/**
+ * @brief attitude_log_writer_init() on a new file at @p path (truncated if it exists).
+ *
+ * Finish with attitude_log_writer_close(), which also closes the file.
+ */
+int attitude_log_writer_open_file(AttitudeLogWriter *writer,
+                                  const char *path,
+                                  uint32_t flags,
+                                  void *buffer,
+                                  size_t buffer_bytes);
+
+/**
+ * @brief Append one record, writing the block out when the buffer is full.
+ *
+ * Values are stored as given, NaN included.
+ *
+ * @param writer     Initialised writer.
+ * @param timestamp  Sample time (s).
+ * @param q          Attitude quaternion.
+ * @param rate       Body rate; required with ::ATTITUDE_LOG_HAS_RATE, ignored (may be NULL)
+ *                   without.
+ * @return 1 on success; 0 for null pointers or once the sink has failed.
+ */
+int attitude_log_writer_append(AttitudeLogWriter *writer, double timestamp, const double q[4], const double rate[3]);
+
+/**
+ * @brief Write out the buffered records as a (possibly short) block.
+ *
+ * Call at points where losing buffered data would matter; each call costs a block header.
+ *
+ * @return 1 on success or with nothing buffered; 0 for a NULL writer or a failing sink.
+ */
+int attitude_log_writer_flush(AttitudeLogWriter *writer);
+
+/**
+ * @brief Flush and, for attitude_log_writer_open_file(), close the file.
+ *
+ * @return 1 when everything reached the sink; 0 otherwise.
+ */
+int attitude_log_writer_close(AttitudeLogWriter *writer);
+
+/**
+ * @brief Read a log already in memory.
+ *
+ * The memory must stay valid and unchanged while the reader and its blocks are in use.
+ *
+ * @param reader  Reader to initialise.
+ * @param data    Start of the log; 8-byte aligned so the columns can be read as doubles.
+ * @param size    Bytes available.
+ * @return 1 on success; 0 for null pointers, misaligned data, a big-endian host, a bad magic,
+ *         a newer version, unknown flags or a short header.
+ */
+int attitude_log_reader_open_memory(AttitudeLogReader *reader, const void *data, size_t size);
+
+/**
+ * @brief Map a log file read-only and read it in place.
+ *
+ * Available where the library was built with @c mmap (POSIX); returns 0 elsewhere.
+ * Release with attitude_log_reader_close().
+ *
+ * @return 1 on success; 0 if the file cannot be opened or mapped, or for the conditions of
+ *         attitude_log_reader_open_memory().
+ */
+int attitude_log_reader_open_file(AttitudeLogReader *reader, const char *path);
+
+/** @brief Unmap a file opened by attitude_log_reader_open_file(); a no-op for memory readers. */
+void attitude_log_reader_close(AttitudeLogReader *reader);
+
+/**
+ * @brief Next block of records.
+ *
+ * @return 1 with @p block filled; 0 at the end of the log. If iteration ended at a truncated
+ *         or corrupt block rather than at the end of the data, @c reader->damaged is set.
+ */
+int attitude_log_reader_next(AttitudeLogReader *reader, AttitudeLogBlock *block);
+
+/** @brief Restart iteration at the first block. */
+void attitude_log_reader_rewind(AttitudeLogReader *reader);
+
+/**
+ * @brief Total records in the log, walking the block headers only.
+ *
+ * Does not change the iteration position. Stops, like attitude_log_reader_next(), at the
+ * first damaged block.
+ */
+uint64_t attitude_log_reader_count(const AttitudeLogReader *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_ATTITUDE_LOG_H
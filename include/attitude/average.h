@@ -0,0 +1,154 @@
+#ifndef ATTITUDE_AVERAGE_H
+#define ATTITUDE_AVERAGE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file average.h
+ * @brief Weighted mean attitude of large quaternion sample sets, streamed.
+ *
+ * Averaging the components of @c q[4] directly is wrong: @f$q@f$ and @f$-q@f$ are the same
+ * attitude, so a cloud of samples straddling the hemisphere boundary cancels out. The mean
+ * computed here is Markley's: the unit quaternion maximising
+ * @f[ \sum_i a_i \,(q^T q_i)^2 , @f]
+ * which is the eigenvector of the largest eigenvalue of the 4x4 matrix
+ * @f$M = \sum_i a_i\, q_i q_i^T@f$. Every term is unchanged by @f$q_i \to -q_i@f$, so no
+ * sign alignment is needed. The result is also the chordal L2 mean, the rotation minimising
+ * @f$\sum_i a_i \|R - R_i\|_F^2@f$, and for concentrated samples it agrees with the
+ * geodesic (Karcher) mean to second order in the spread.
+ *
+ * Samples are pushed one at a time, or in batches, into a ::QuaternionAverage, which holds
+ * only @f$M@f$ and the totals, so nothing is stored and the cost is ten multiply-adds per
+ * sample. Accumulators over disjoint subsets merge by addition with
+ * quaternion_average_merge(), so threads can each fill their own and combine at the end. The
+ * mean is read out with one of:
+ * - quaternion_average_eigen(): full Jacobi eigendecomposition of @f$M@f$; the reference.
+ * - quaternion_average_fast(): power iteration on @f$M@f$, an iterated chordal mean in which
+ *   each sample is weighted by its agreement with the current estimate. Converges in a
+ *   handful of steps when the samples are concentrated (the ratio of the two largest
+ *   eigenvalues is about the sample variance in rad@f$^2@f$ over four) and falls back to the
+ *   eigendecomposition when they are not.
+ *
+ * Reading the mean does not modify the accumulator, so more samples can follow.
+ */
+
+/**
+ * @brief Streaming accumulator for the average; initialise with quaternion_average_init().
+ *
+ * Fields are maintained by the functions below; treat them as read-only.
+ */
+typedef struct {
+    double m[4][4];     ///< Upper triangle of @f$\sum_i a_i q_i q_i^T@f$ with unit @f$q_i@f$; lower part unused.
+    double weight_sum;  ///< @f$\sum_i a_i@f$.
+    size_t count;       ///< Number of samples accepted.
+} QuaternionAverage;
+
+/**
+ * @brief Single-precision accumulator, used by the @c quaternionf_average_* functions.
+ */
+typedef struct {
+    float m[4][4];      ///< Upper triangle of @f$\sum_i a_i q_i q_i^T@f$ with unit @f$q_i@f$; lower part unused.
+    float weight_sum;   ///< @f$\sum_i a_i@f$.
+    size_t count;       ///< Number of samples accepted.
+} QuaternionAveragef;
+
+/**
+ * @brief Reset an accumulator to the empty set.
+ * @return 1 on success; 0 if @p acc is NULL.
+ */
+int quaternion_average_init(QuaternionAverage *acc);
+
+/**
+ * @brief Add one sample.
+ *
+ * @param acc     Accumulator.
+ * @param q       Sample @c [w, x, y, z]; need not be unit (it is normalised) and either sign
+ *                may be used.
+ * @param weight  Positive weight (for example a particle weight or inverse variance).
+ * @return 1 on success; 0 (accumulator unchanged) for null pointers, a zero-length or
+ *         non-finite quaternion, or a non-positive or non-finite weight.
+ */
+int quaternion_average_push(QuaternionAverage *acc, const double q[4], double weight);
+
+/**
+ * @brief Add @p count samples packed as @c [count][4].
+ *
+ * Equivalent to quaternion_average_push() on each sample, but sums the batch in registers
+ * before touching the accumulator.
+ *
+ * @param acc      Accumulator.
+ * @param q        Samples.
+ * @param weights  @p count positive weights, or NULL for equal weights of 1.
+ * @param count    Number of samples.
+ * @return 1 if every sample was accepted; 0 for null pointers (nothing added) or if any sample
+ *         was rejected as in quaternion_average_push() (the others are still added).
+ */
+int quaternion_average_push_batch(QuaternionAverage *acc, const double *q, const double *weights, size_t count);
+
+/**
+ * @brief Fold @p other into @p acc, as if its samples had been pushed into @p acc.
+ *
+ * Addition is exact up to rounding and order-independent, so per-thread accumulators can be
+ * merged in any order.
+ *
+ * @return 1 on success; 0 for null pointers.
+ */
+int quaternion_average_merge(QuaternionAverage *acc, const QuaternionAverage *other);
+
+/**
+ * @brief Mean attitude by Jacobi eigendecomposition of the accumulated matrix.
+ *
+ * @param acc    Accumulator.
+ * @param q_out  Unit mean attitude, @c w >= 0.
+ * @return 1 on success; 0 (output unwritten) for null pointers or an empty accumulator.
+ */
+int quaternion_average_eigen(const QuaternionAverage *acc, double q_out[4]);
+
+/**
+ * @brief Mean attitude by power iteration. Arguments and result as quaternion_average_eigen().
+ *
+ * Agrees with quaternion_average_eigen() to a few ulps whenever the mean is well defined.
+ * The converged vector is accepted only if its eigenvalue provably dominates (its square is at
+ * least half the squared Frobenius norm of @f$M@f$); otherwise, and when the samples are
+ * spread so evenly that two eigenvalues nearly coincide, the eigendecomposition decides.
+ */
+int quaternion_average_fast(const QuaternionAverage *acc, double q_out[4]);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision averaging API
+ *
+ * Float counterparts of the functions above, generated from the same source. Sums are kept in
+ * float, so the relative accuracy of the mean degrades slowly (as rounding in the sums) with
+ * the number of samples; split very long streams over several accumulators and merge them.
+ * @{
+ */
+/** @brief Single-precision variant of quaternion_average_init(). */
+int quaternionf_average_init(QuaternionAveragef *acc);
+
+/** @brief Single-precision variant of quaternion_average_push(). */
+int quaternionf_average_push(QuaternionAveragef *acc, const float q[4], float weight);
+
+/** @brief Single-precision variant of quaternion_average_push_batch(). */
+int quaternionf_average_push_batch(QuaternionAveragef *acc, const float *q, const float *weights, size_t count);
+
+/** @brief Single-precision variant of quaternion_average_merge(). */
+int quaternionf_average_merge(QuaternionAveragef *acc, const QuaternionAveragef *other);
+
+/** @brief Single-precision variant of quaternion_average_eigen(). */
+int quaternionf_average_eigen(const QuaternionAveragef *acc, float q_out[4]);
+
+/** @brief Single-precision variant of quaternion_average_fast(). */
+int quaternionf_average_fast(const QuaternionAveragef *acc, float q_out[4]);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_AVERAGE_H
@@ -0,0 +1,165 @@
+#ifndef ATTITUDE_CONVERT_H
+#define ATTITUDE_CONVERT_H
+
+#include <stddef.h>
+
+#include "attitude/euler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file convert.h
+ * @brief Chunked, optionally multi-threaded conversion of large attitude buffers.
+ *
+ * attitude_convert() runs one of the quaternion / DCM / Euler conversions over a whole buffer.
+ * The buffer is cut into chunks sized to stay in cache (::ATTITUDE_CONVERT_CHUNK_BYTES of
+ * source plus destination data) and the chunks are handed to an executor: NULL runs them in
+ * the calling thread, attitude_thread_pool_executor() spreads them over a pthread pool, and
+ * any other scheduler can be plugged in through ::AttitudeExecutor.
+ *
+ * Each element goes through the checked conversion of the scalar API. An element that is
+ * rejected gets NaN output and a set bit in the optional failure mask; the rest of the buffer
+ * is still converted. Results do not depend on the executor or the chunk size.
+ *
+ * Conversions never allocate. The thread pool allocates once, in attitude_thread_pool_create().
+ */
+
+/**
+ * @brief Target working-set size of one chunk, in bytes of source plus destination data.
+ *
+ * The default is half of a typical 512 KiB-1 MiB per-core L2, so a chunk's input and output
+ * stay resident while it is converted. Define before building the library to retune.
+ */
+#ifndef ATTITUDE_CONVERT_CHUNK_BYTES
+#define ATTITUDE_CONVERT_CHUNK_BYTES (256u * 1024u)
+#endif
+
+/**
+ * @brief Chunks are a multiple of this many elements, so every chunk starts on a byte of the
+ *        failure mask and on a 64-byte boundary of the (64-byte aligned) buffers.
+ */
+#define ATTITUDE_CONVERT_CHUNK_ALIGN 64u
+
+/** @brief Bytes needed for the failure mask of @p count elements. */
+#define ATTITUDE_CONVERT_MASK_BYTES(count) ((((size_t)(count)) + 7u) / 8u)
+
+/**
+ * @brief Conversion performed by attitude_convert().
+ *
+ * Element layouts: quaternions are @c double[4] @f$[w, x, y, z]@f$, DCMs are row-major
+ * @c double[3][3], Euler angles are ::EulerAngles.
+ */
+typedef enum {
+    ATTITUDE_CONVERT_QUATERNION_TO_DCM,   ///< As quaternion_to_dcm(); rejects zero or non-finite input.
+    ATTITUDE_CONVERT_QUATERNION_TO_EULER, ///< As euler_from_quaternion_checked() in @c order.
+    ATTITUDE_CONVERT_DCM_TO_QUATERNION,   ///< As dcm_to_quaternion_checked().
+    ATTITUDE_CONVERT_DCM_TO_EULER,        ///< As euler_from_dcm_checked() in @c order.
+    ATTITUDE_CONVERT_EULER_TO_QUATERNION, ///< As euler_to_quaternion_checked(); each element's own order.
+    ATTITUDE_CONVERT_EULER_TO_DCM,        ///< As euler_to_dcm_checked(); each element's own order.
+    ATTITUDE_CONVERT_KIND_COUNT           ///< Number of kinds; not a valid kind.
+} AttitudeConversionKind;
+
+/**
+ * @brief One buffer conversion.
+ *
+ * @c src and @c dst hold @c count elements of the types implied by @c kind and must not
+ * overlap.
+ */
+typedef struct {
+    AttitudeConversionKind kind; ///< Conversion to run.
+    EulerOrder order;            ///< Output order for the @c *_TO_EULER kinds; ignored otherwise.
+    const void *src;             ///< Source elements.
+    void *dst;                   ///< Destination elements.
+    size_t count;                ///< Number of elements; 0 is allowed with null buffers.
+    unsigned char *failures;     ///< Optional mask, ATTITUDE_CONVERT_MASK_BYTES(count) bytes: bit
+                                 ///< @c i%8 of byte @c i/8 is set when element @c i was rejected.
+    size_t chunk;                ///< Elements per chunk, 0 for the cache-sized default. Rounded
+                                 ///< up to a multiple of ::ATTITUDE_CONVERT_CHUNK_ALIGN; at least
+                                 ///< @c count (e.g. @c SIZE_MAX) runs everything as one chunk.
+} AttitudeConversion;
+
+/**
+ * @brief Unit of work handed to an executor.
+ *
+ * @return 1 when every element of task @p index converted, 0 otherwise.
+ */
+typedef int (*AttitudeTaskFn)(void *arg, size_t index);
+
+/**
+ * @brief Scheduler used by attitude_convert().
+ *
+ * @c run must call @c task(arg, i) exactly once for every @c i in @c [0, count), in any order
+ * and on any threads, return only after all calls have finished, and return the AND of their
+ * results. Tasks touch disjoint memory, so they need no synchronisation between themselves.
+ */
+typedef struct {
+    int (*run)(void *context, AttitudeTaskFn task, void *arg, size_t count); ///< Scheduling hook.
+    void *context;                                                           ///< Passed to @c run.
+} AttitudeExecutor;
+
+/**
+ * @brief Convert a buffer, chunk by chunk, on @p executor.
+ *
+ * A buffer that fits in one chunk is converted in the calling thread without involving the
+ * executor.
+ *
+ * @param conversion  Buffers and conversion kind.
+ * @param executor    Scheduler for the chunks; NULL (or a NULL @c run) runs them in the calling
+ *                    thread.
+ * @return 1 when every element converted; 0 if any element was rejected (see @c failures), or
+ *         for a null @p conversion, an invalid kind or order, or null buffers with a non-zero
+ *         count (in which case nothing is written).
+ */
+int attitude_convert(const AttitudeConversion *conversion, const AttitudeExecutor *executor);
+
+/**
+ * @brief Chunk length attitude_convert() uses for @p kind when @c chunk is 0.
+ *
+ * ::ATTITUDE_CONVERT_CHUNK_BYTES divided by the bytes of one source plus one destination
+ * element, rounded down to a multiple of ::ATTITUDE_CONVERT_CHUNK_ALIGN (at least one
+ * multiple). 0 for an invalid kind.
+ */
+size_t attitude_convert_default_chunk(AttitudeConversionKind kind);
+
+/**
+ * @brief Fixed-size pool of worker threads for attitude_convert().
+ *
+ * Opaque; only available when the library is built with threads (the default where pthreads
+ * exist, see the @c ATTITUDE_THREADS CMake option).
+ */
+typedef struct AttitudeThreadPool AttitudeThreadPool;
+
+/**
+ * @brief Start a pool.
+ *
+ * The thread calling the executor works on chunks too, so a pool of @p threads runs
+ * @p threads - 1 background workers.
+ *
+ * @param threads  Total threads including the caller; 0 for the number of online CPUs.
+ * @return The pool, or NULL if threads are unavailable or could not be started.
+ */
+AttitudeThreadPool *attitude_thread_pool_create(unsigned threads);
+
+/** @brief Stop the workers and free the pool. NULL is ignored. */
+void attitude_thread_pool_destroy(AttitudeThreadPool *pool);
+
+/** @brief Total threads of the pool, including the calling thread; 0 for NULL. */
+unsigned attitude_thread_pool_size(const AttitudeThreadPool *pool);
+
+/**
+ * @brief Executor that runs tasks on @p pool.
+ *
+ * Concurrent attitude_convert() calls on the same pool are serialised; a task must not call
+ * back into the same pool. For a NULL pool the executor has no @c run hook, which
+ * attitude_convert() treats like a NULL executor, so callers can fall back to one thread
+ * without a separate code path.
+ */
+AttitudeExecutor attitude_thread_pool_executor(AttitudeThreadPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_CONVERT_H
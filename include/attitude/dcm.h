@@ -1,10 +1,25 @@
 #ifndef ATTITUDE_DCM_H
 #define ATTITUDE_DCM_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Orthonormality tolerance used by the double-precision checked DCM conversions.
+ */
+#define ATTITUDE_DCM_ORTHONORMAL_TOL 1e-9
+
+/**
+ * @brief Orthonormality tolerance used by the single-precision checked DCM conversions.
+ *
+ * A matrix built in float from an exact rotation carries entry errors of a few ULP
+ * (~1e-7), so the double tolerance would reject valid float input.
+ */
+#define ATTITUDE_DCMF_ORTHONORMAL_TOL 1e-5f
+
 /**
  * @brief Convert a direction cosine matrix to intrinsic ZYX Euler angles.
  *
@@ -23,13 +38,24 @@ void dcm_to_euler(const double dcm[3][3], double *roll, double *pitch, double *y
  * Gimbal-lock inputs use the canonical solution roll = 0 while preserving the
  * represented orientation.
  *
- * @return 1 on success, 0 for null pointers or a non-orthonormal matrix.
+ * @return 1 on success, 0 for null pointers or a matrix that fails
+ *         dcm_is_orthonormal() at ::ATTITUDE_DCM_ORTHONORMAL_TOL.
  */
 int dcm_to_euler_checked(const double dcm[3][3],
                          double *roll,
                          double *pitch,
                          double *yaw);
 
+/**
+ * @brief DCM-to-Euler conversion for input that is a rotation by construction.
+ *
+ * Same result as dcm_to_euler_checked() but without the orthonormality scan or null
+ * checks, for matrices produced by quaternion_to_dcm(), euler_to_dcm() and the like.
+ * Non-rotation input gives meaningless angles. Builds with ATTITUDE_CHECK_TRUSTED_INPUTS
+ * defined validate with dcm_is_rotation_fast() and write NaN on failure.
+ */
+void dcm_to_euler_unchecked(const double dcm[3][3], double *roll, double *pitch, double *yaw);
+
 /**
  * @brief Check whether a DCM is orthonormal within a tolerance.
  *
@@ -39,6 +65,72 @@ int dcm_to_euler_checked(const double dcm[3][3],
  */
 int dcm_is_orthonormal(const double dcm[3][3], double tol);
 
+/**
+ * @brief Cheap rotation test intended for debug assertions on trusted input.
+ *
+ * Checks that rows 0 and 1 are unit length and orthogonal and that row 2 equals their
+ * cross product, each within @p tol. This accepts the same proper rotations as
+ * dcm_is_orthonormal() at roughly a third of the cost, but the bound is per check rather
+ * than on every row/column product, so borderline matrices may be classified differently.
+ *
+ * @param dcm Input rotation matrix.
+ * @param tol Acceptable deviation per check.
+ * @return 1 if the matrix is a proper rotation within @p tol, 0 otherwise (including NaN).
+ */
+int dcm_is_rotation_fast(const double dcm[3][3], double tol);
+
+/**
+ * @brief Pull a slowly drifting DCM back towards a rotation (Premerlani and Bizard).
+ *
+ * Splits the error in the orthogonality of rows 0 and 1 equally between them, replaces row 2
+ * by their cross product and rescales each row with the first-order expansion of
+ * @f$1/\sqrt{n}@f$. For a matrix within @f$\epsilon@f$ of a rotation the result is within
+ * @f$O(\epsilon^2)@f$, so calling it every integration step keeps a DCM propagated by
+ * @f$C \leftarrow C (I + [\omega\,dt]_\times)@f$ within about the square of the per-step drift
+ * of orthonormal (and repeated calls on a fixed matrix converge to rounding), for about 70
+ * flops. It does not find the nearest rotation: each call may also turn the matrix by an angle
+ * of the order of the error it removes, which over many steps exceeds the error of first-order
+ * integration. Use dcm_orthonormalize() where that matters, or to repair larger errors.
+ *
+ * @param dcm  Input matrix.
+ * @param out  Corrected matrix; may be the same array as @p dcm.
+ * @return 1 on success; 0 for null pointers, or (with @p out set to NaN) non-finite entries.
+ */
+int dcm_orthonormalize_fast(const double dcm[3][3], double out[3][3]);
+
+/**
+ * @brief Replace a matrix by the nearest rotation (orthogonal polar factor).
+ *
+ * Returns the rotation @f$R@f$ minimising @f$\|R - M\|_F@f$, the orthogonal factor of the
+ * polar decomposition @f$M = R\,S@f$ (equivalently @f$U V^T@f$ from the SVD of @f$M@f$). It
+ * is computed by Higham's scaled Newton iteration, three or four 3x3 inversions for a drifted
+ * DCM, and is exact to rounding however far @p dcm has drifted.
+ *
+ * @param dcm  Input matrix with positive determinant.
+ * @param out  Nearest rotation; may be the same array as @p dcm.
+ * @return 1 on success; 0 for null pointers, or (with @p out set to NaN) non-finite entries
+ *         or a determinant that is not positive (a reflection is not near any rotation).
+ */
+int dcm_orthonormalize(const double dcm[3][3], double out[3][3]);
+
+/**
+ * @brief dcm_orthonormalize_fast() over @p count matrices packed as @c [count][3][3].
+ *
+ * @param dcm    Input matrices.
+ * @param count  Number of matrices; 0 is allowed with null pointers.
+ * @param out    Output matrices; may be the same buffer as @p dcm.
+ * @return 1 when every matrix was corrected, 0 for null pointers (nothing written) or if any
+ *         element had non-finite entries (its output is NaN; the others are still corrected).
+ */
+int dcm_orthonormalize_fast_batch(const double *dcm, size_t count, double *out);
+
+/**
+ * @brief dcm_orthonormalize() over @p count matrices packed as @c [count][3][3]. Arguments and
+ * result as dcm_orthonormalize_fast_batch(); rejected elements are those dcm_orthonormalize()
+ * rejects.
+ */
+int dcm_orthonormalize_batch(const double *dcm, size_t count, double *out);
+
 /**
  * @brief Convert a DCM to a quaternion.
  *
@@ -50,10 +142,19 @@ void dcm_to_quaternion(const double dcm[3][3], double q[4]);
 /**
  * @brief Checked DCM-to-quaternion conversion.
  *
- * @return 1 on success, 0 for null pointers or a non-orthonormal matrix.
+ * @return 1 on success, 0 for null pointers or a matrix that fails
+ *         dcm_is_orthonormal() at ::ATTITUDE_DCM_ORTHONORMAL_TOL.
  */
 int dcm_to_quaternion_checked(const double dcm[3][3], double q[4]);
 
+/**
+ * @brief DCM-to-quaternion conversion for input that is a rotation by construction.
+ *
+ * Same result as dcm_to_quaternion_checked() without validation; see
+ * dcm_to_euler_unchecked() for the contract and the ATTITUDE_CHECK_TRUSTED_INPUTS mode.
+ */
+void dcm_to_quaternion_unchecked(const double dcm[3][3], double q[4]);
+
 /**
  * @brief Apply a DCM to a vector.
  *
@@ -65,8 +166,68 @@ int dcm_to_quaternion_checked(const double dcm[3][3], double q[4]);
  */
 void dcm_apply(const double dcm[3][3], const double vin[3], double vout[3]);
 
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision DCM API
+ *
+ * Float counterparts of the functions above, generated from the same source. The checked
+ * conversions validate against ::ATTITUDE_DCMF_ORTHONORMAL_TOL.
+ * @{
+ */
+/** @brief Single-precision variant of dcm_to_euler(). */
+void dcmf_to_euler(const float dcm[3][3], float *roll, float *pitch, float *yaw);
+
+/** @brief Single-precision variant of dcm_to_euler_checked(). */
+int dcmf_to_euler_checked(const float dcm[3][3], float *roll, float *pitch, float *yaw);
+
+/** @brief Single-precision variant of dcm_to_euler_unchecked(). */
+void dcmf_to_euler_unchecked(const float dcm[3][3], float *roll, float *pitch, float *yaw);
+
+/** @brief Single-precision variant of dcm_is_orthonormal(). */
+int dcmf_is_orthonormal(const float dcm[3][3], float tol);
+
+/** @brief Single-precision variant of dcm_is_rotation_fast(). */
+int dcmf_is_rotation_fast(const float dcm[3][3], float tol);
+
+/** @brief Single-precision variant of dcm_orthonormalize_fast(). */
+int dcmf_orthonormalize_fast(const float dcm[3][3], float out[3][3]);
+
+/** @brief Single-precision variant of dcm_orthonormalize(). */
+int dcmf_orthonormalize(const float dcm[3][3], float out[3][3]);
+
+/** @brief Single-precision variant of dcm_orthonormalize_fast_batch(). */
+int dcmf_orthonormalize_fast_batch(const float *dcm, size_t count, float *out);
+
+/** @brief Single-precision variant of dcm_orthonormalize_batch(). */
+int dcmf_orthonormalize_batch(const float *dcm, size_t count, float *out);
+
+/** @brief Single-precision variant of dcm_to_quaternion(). */
+void dcmf_to_quaternion(const float dcm[3][3], float q[4]);
+
+/** @brief Single-precision variant of dcm_to_quaternion_checked(). */
+int dcmf_to_quaternion_checked(const float dcm[3][3], float q[4]);
+
+/** @brief Single-precision variant of dcm_to_quaternion_unchecked(). */
+void dcmf_to_quaternion_unchecked(const float dcm[3][3], float q[4]);
+
+/** @brief Single-precision variant of dcm_apply(). */
+void dcmf_apply(const float dcm[3][3], const float vin[3], float vout[3]);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
 
+/*
+ * Opt-in header-only hot path: with ATTITUDE_INLINE defined before this header, calls to
+ * dcm_apply() and dcmf_apply() expand to the static inline bodies in dcm_inline.h. See
+ * quaternion.h.
+ */
+#ifdef ATTITUDE_INLINE
+#include "attitude/dcm_inline.h"
+#define dcm_apply(dcm, vin, vout) dcm_apply_inline((dcm), (vin), (vout))
+#define dcmf_apply(dcm, vin, vout) dcmf_apply_inline((dcm), (vin), (vout))
+#endif
+
 #endif // ATTITUDE_DCM_H
@@ -0,0 +1,35 @@
+#ifndef ATTITUDE_DCM_INLINE_H
+#define ATTITUDE_DCM_INLINE_H
+
+/**
+ * @file dcm_inline.h
+ * @brief Header-only definition of dcm_apply().
+ *
+ * The body the library's dcm_apply() and dcmf_apply() are built from. Use it directly, or
+ * define @c ATTITUDE_INLINE before including dcm.h; see quaternion_inline.h for the rationale
+ * and the FMA caveat.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Inline body of dcm_apply(). @p vout must not alias @p vin. */
+static inline void dcm_apply_inline(const double dcm[3][3], const double vin[3], double vout[3]) {
+    vout[0] = dcm[0][0]*vin[0] + dcm[0][1]*vin[1] + dcm[0][2]*vin[2];
+    vout[1] = dcm[1][0]*vin[0] + dcm[1][1]*vin[1] + dcm[1][2]*vin[2];
+    vout[2] = dcm[2][0]*vin[0] + dcm[2][1]*vin[1] + dcm[2][2]*vin[2];
+}
+
+/** @brief Inline body of dcmf_apply(). */
+static inline void dcmf_apply_inline(const float dcm[3][3], const float vin[3], float vout[3]) {
+    vout[0] = dcm[0][0]*vin[0] + dcm[0][1]*vin[1] + dcm[0][2]*vin[2];
+    vout[1] = dcm[1][0]*vin[0] + dcm[1][1]*vin[1] + dcm[1][2]*vin[2];
+    vout[2] = dcm[2][0]*vin[0] + dcm[2][1]*vin[1] + dcm[2][2]*vin[2];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_DCM_INLINE_H
@@ -1,6 +1,8 @@
 #ifndef ATTITUDE_EULER_H
 #define ATTITUDE_EULER_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -8,14 +10,44 @@ extern "C" {
 /**
  * @brief Enumeration of supported Euler rotation orders.
  *
- * The library currently implements intrinsic ZYX rotations. The other values are
- * reserved so callers can reject unsupported inputs through the checked API.
+ * All six Tait-Bryan and six proper-Euler sequences are available, intrinsic (rotations
+ * about the moving body axes, applied left to right) and extrinsic (rotations about the
+ * fixed axes, applied left to right). Extrinsic ABC describes the same rotation as
+ * intrinsic CBA.
+ *
+ * How the EulerAngles fields map onto a sequence:
+ * - Tait-Bryan orders: roll, pitch and yaw are always the angles about x, y and z.
+ * - Proper-Euler orders: yaw is the angle about the first axis of the name, pitch about the
+ *   middle axis, and roll about the last axis (so ZYZ is yaw-pitch-roll like ZYX).
+ *
+ * The first three values keep their original numbering for ABI compatibility.
  */
 typedef enum {
     EULER_ZYX, ///< Standard aerospace yaw → pitch → roll sequence.
     EULER_ZYZ, ///< Useful for certain satellite pointing laws and robotics arms.
     EULER_XYZ, ///< Roll → pitch → yaw intrinsic sequence.
-    // Extend with other orders as needed.
+    EULER_XZY, ///< Intrinsic x → z → y.
+    EULER_YXZ, ///< Intrinsic y → x → z (common camera pan/tilt/roll).
+    EULER_YZX, ///< Intrinsic y → z → x.
+    EULER_ZXY, ///< Intrinsic z → x → y.
+    EULER_XYX, ///< Proper Euler, intrinsic x → y → x.
+    EULER_XZX, ///< Proper Euler, intrinsic x → z → x.
+    EULER_YXY, ///< Proper Euler, intrinsic y → x → y.
+    EULER_YZY, ///< Proper Euler, intrinsic y → z → y.
+    EULER_ZXZ, ///< Proper Euler, intrinsic z → x → z (classical orbital elements).
+    EULER_EXTRINSIC_XYZ, ///< Fixed-axis x → y → z; same rotation as ::EULER_ZYX.
+    EULER_EXTRINSIC_XZY, ///< Fixed-axis x → z → y.
+    EULER_EXTRINSIC_YXZ, ///< Fixed-axis y → x → z.
+    EULER_EXTRINSIC_YZX, ///< Fixed-axis y → z → x.
+    EULER_EXTRINSIC_ZXY, ///< Fixed-axis z → x → y.
+    EULER_EXTRINSIC_ZYX, ///< Fixed-axis z → y → x; same rotation as ::EULER_XYZ.
+    EULER_EXTRINSIC_XYX, ///< Proper Euler, fixed-axis x → y → x.
+    EULER_EXTRINSIC_XZX, ///< Proper Euler, fixed-axis x → z → x.
+    EULER_EXTRINSIC_YXY, ///< Proper Euler, fixed-axis y → x → y.
+    EULER_EXTRINSIC_YZY, ///< Proper Euler, fixed-axis y → z → y.
+    EULER_EXTRINSIC_ZXZ, ///< Proper Euler, fixed-axis z → x → z.
+    EULER_EXTRINSIC_ZYZ, ///< Proper Euler, fixed-axis z → y → z.
+    EULER_ORDER_COUNT    ///< Number of orders; not a valid order.
 } EulerOrder;
 
 /**
@@ -24,12 +56,22 @@ typedef enum {
  * Angles are expressed in radians.
  */
 typedef struct {
-    double roll;   ///< Rotation about x-axis.
-    double pitch;  ///< Rotation about y-axis.
-    double yaw;    ///< Rotation about z-axis.
-    EulerOrder order; ///< Intrinsic rotation order.
+    double roll;   ///< Rotation about x-axis (last axis for proper-Euler orders).
+    double pitch;  ///< Rotation about y-axis (middle axis for proper-Euler orders).
+    double yaw;    ///< Rotation about z-axis (first axis for proper-Euler orders).
+    EulerOrder order; ///< Rotation order.
 } EulerAngles;
 
+/**
+ * @brief Single-precision Euler angle storage, used by the @c eulerf_* functions.
+ */
+typedef struct {
+    float roll;   ///< Rotation about x-axis (last axis for proper-Euler orders).
+    float pitch;  ///< Rotation about y-axis (middle axis for proper-Euler orders).
+    float yaw;    ///< Rotation about z-axis (first axis for proper-Euler orders).
+    EulerOrder order; ///< Rotation order.
+} EulerAnglesf;
+
 
 /**
  * @brief Convert Euler angles to a direction cosine matrix.
@@ -42,7 +84,7 @@ void euler_to_dcm(const EulerAngles *e, double dcm[3][3]);
 /**
  * @brief Checked Euler-to-DCM conversion.
  *
- * @return 1 on success, 0 for null pointers, non-finite angles, or an unsupported order.
+ * @return 1 on success, 0 for null pointers, non-finite angles, or an invalid order.
  */
 int euler_to_dcm_checked(const EulerAngles *e, double dcm[3][3]);
 
@@ -57,10 +99,101 @@ void euler_to_quaternion(const EulerAngles *e, double q[4]);
 /**
  * @brief Checked Euler-to-quaternion conversion.
  *
- * @return 1 on success, 0 for null pointers, non-finite angles, or an unsupported order.
+ * @return 1 on success, 0 for null pointers, non-finite angles, or an invalid order.
  */
 int euler_to_quaternion_checked(const EulerAngles *e, double q[4]);
 
+/**
+ * @brief Extract Euler angles in any supported order from a DCM.
+ *
+ * The middle angle lies in @f$[-\pi/2, \pi/2]@f$ for Tait-Bryan orders and in
+ * @f$[0, \pi]@f$ for proper-Euler orders; the other two lie in @f$(-\pi, \pi]@f$. At gimbal
+ * lock the angle of the last intrinsic rotation is set to zero and the first absorbs the
+ * combined rotation, so for ::EULER_ZYX this matches dcm_to_euler_checked() (roll = 0).
+ *
+ * @param dcm   Input rotation matrix (row-major).
+ * @param order Requested rotation order.
+ * @param e     Output angles; @c e->order is set to @p order.
+ * @return 1 on success, 0 for null pointers, an invalid order, or a matrix that fails
+ *         dcm_is_orthonormal() at ::ATTITUDE_DCM_ORTHONORMAL_TOL.
+ */
+int euler_from_dcm_checked(const double dcm[3][3], EulerOrder order, EulerAngles *e);
+
+/**
+ * @brief Unchecked wrapper for euler_from_dcm_checked(); writes NaN angles on failure.
+ */
+void euler_from_dcm(const double dcm[3][3], EulerOrder order, EulerAngles *e);
+
+/**
+ * @brief Extract Euler angles in any supported order directly from a quaternion.
+ *
+ * Uses the Bernardes–Viollet closed form rather than building a DCM. The quaternion need
+ * not be unit length and @p q / @c -q give the same angles. Angle ranges and gimbal-lock
+ * handling are those of euler_from_dcm_checked().
+ *
+ * @param q     Input quaternion in @f$[w, x, y, z]@f$ order.
+ * @param order Requested rotation order.
+ * @param e     Output angles; @c e->order is set to @p order.
+ * @return 1 on success, 0 for null pointers, an invalid order, or a zero/non-finite quaternion.
+ */
+int euler_from_quaternion_checked(const double q[4], EulerOrder order, EulerAngles *e);
+
+/**
+ * @brief Unchecked wrapper for euler_from_quaternion_checked(); writes NaN angles on failure.
+ */
+void euler_from_quaternion(const double q[4], EulerOrder order, EulerAngles *e);
+
+/**
+ * @brief Convert an array of quaternions to Euler angles in one order.
+ *
+ * Equivalent to calling euler_from_quaternion() on each element, with the order dispatch
+ * hoisted out of the loop. Elements that are zero or non-finite get NaN angles.
+ *
+ * @param q     @p count quaternions stored contiguously as @f$[w, x, y, z]@f$.
+ * @param count Number of quaternions; 0 is allowed with null pointers.
+ * @param order Requested rotation order.
+ * @param out   @p count output angle sets.
+ * @return 1 when every element converted, 0 if any element was rejected or for null
+ *         pointers / an invalid order (in which case nothing is written).
+ */
+int euler_from_quaternions(const double *q, size_t count, EulerOrder order, EulerAngles *out);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision Euler API
+ *
+ * Float counterparts of the functions above, generated from the same source.
+ * @{
+ */
+/** @brief Single-precision variant of euler_to_dcm(). */
+void eulerf_to_dcm(const EulerAnglesf *e, float dcm[3][3]);
+
+/** @brief Single-precision variant of euler_to_dcm_checked(). */
+int eulerf_to_dcm_checked(const EulerAnglesf *e, float dcm[3][3]);
+
+/** @brief Single-precision variant of euler_to_quaternion(). */
+void eulerf_to_quaternion(const EulerAnglesf *e, float q[4]);
+
+/** @brief Single-precision variant of euler_to_quaternion_checked(). */
+int eulerf_to_quaternion_checked(const EulerAnglesf *e, float q[4]);
+
+/** @brief Single-precision variant of euler_from_dcm_checked(). */
+int eulerf_from_dcm_checked(const float dcm[3][3], EulerOrder order, EulerAnglesf *e);
+
+/** @brief Single-precision variant of euler_from_dcm(). */
+void eulerf_from_dcm(const float dcm[3][3], EulerOrder order, EulerAnglesf *e);
+
+/** @brief Single-precision variant of euler_from_quaternion_checked(). */
+int eulerf_from_quaternion_checked(const float q[4], EulerOrder order, EulerAnglesf *e);
+
+/** @brief Single-precision variant of euler_from_quaternion(). */
+void eulerf_from_quaternion(const float q[4], EulerOrder order, EulerAnglesf *e);
+
+/** @brief Single-precision variant of euler_from_quaternions(). */
+int eulerf_from_quaternions(const float *q, size_t count, EulerOrder order, EulerAnglesf *out);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
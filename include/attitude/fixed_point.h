@@ -0,0 +1,102 @@
+#ifndef ATTITUDE_FIXED_POINT_H
+#define ATTITUDE_FIXED_POINT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file fixed_point.h
+ * @brief Integer quaternion API for targets without a floating-point unit.
+ *
+ * On cores such as the Cortex-M0+ every @c double (and @c float) operation is a library call,
+ * so one quaternion_multiply() costs hundreds of cycles. The functions here use only 32x32->64
+ * integer multiplies, adds and shifts.
+ *
+ * Formats:
+ * - Quaternions and DCM entries are Q1.30: @c int32_t with 30 fraction bits, so 1.0 is
+ *   ::ATTITUDE_Q30_ONE and the representable range is [-2, 2). Unit quaternions and rotation
+ *   matrices use half of it; the headroom absorbs drift between renormalisations.
+ * - Vectors may be in any Qm.n format (for example Q2.29 unit vectors, or raw sensor counts
+ *   as Q31.0); quaternion_q30_rotate_vector() preserves the format.
+ *
+ * Every result is rounded to nearest and saturates to the @c int32_t range instead of
+ * wrapping. Intermediate sums keep at least 58 fraction bits, so for unit inputs each output
+ * is within a couple of units in the last place (2^-30, about 9.3e-10) of the exact value;
+ * attitude_validation_run() checks this against the double API on the target itself.
+ *
+ * Right shifts of negative values are assumed to be arithmetic, as on every GCC and Clang
+ * target.
+ */
+
+/** @brief 1.0 in Q1.30. */
+#define ATTITUDE_Q30_ONE ((int32_t)1 << 30)
+
+/**
+ * @brief Convert a quaternion to Q1.30, rounding to nearest and saturating.
+ *
+ * Intended for set-up and host tooling; uses floating point.
+ *
+ * @return 1 on success; 0 (output unwritten) for null pointers or non-finite components.
+ */
+int quaternion_q30_from_double(const double q[4], int32_t q_out[4]);
+
+/**
+ * @brief Convert a Q1.30 quaternion to double. Exact.
+ */
+void quaternion_q30_to_double(const int32_t q[4], double q_out[4]);
+
+/**
+ * @brief Hamilton product @f$ a \otimes b @f$ in Q1.30, same convention as quaternion_multiply().
+ *
+ * @p out may alias @p a or @p b.
+ */
+void quaternion_q30_multiply(const int32_t a[4], const int32_t b[4], int32_t out[4]);
+
+/**
+ * @brief Scale a Q1.30 quaternion to unit norm in place.
+ *
+ * The reciprocal square root of the squared norm is found by Newton iteration on integers
+ * from a normalised starting point, so there is no division and the cost does not depend on
+ * how far @p q has drifted. Unlike quaternion_normalize() there is no skip for norms already
+ * close to one; the result is always within a couple of LSB of unit.
+ *
+ * @return 1 on success; 0 (unchanged) for a null pointer or the zero quaternion.
+ */
+int quaternion_q30_normalize(int32_t q[4]);
+
+/**
+ * @brief Rotation matrix of a Q1.30 quaternion in Q1.30, same convention as quaternion_to_dcm().
+ *
+ * The quaternion is assumed to be unit; otherwise the matrix is scaled by its squared norm
+ * exactly as in the floating-point formula (and saturates if that exceeds the range).
+ */
+void quaternion_q30_to_dcm(const int32_t q[4], int32_t dcm[3][3]);
+
+/**
+ * @brief Rotate a vector by a Q1.30 quaternion, same convention as quaternion_rotate_vector().
+ *
+ * Builds the rotation matrix once, so rotating several vectors by one quaternion is cheaper
+ * with quaternion_q30_to_dcm() followed by dcm_q30_apply().
+ *
+ * @param q      Unit rotation in Q1.30.
+ * @param v_in   Vector in any Qm.n format.
+ * @param v_out  Rotated vector in the same format; saturates if a component leaves the range.
+ *               May alias @p v_in.
+ */
+void quaternion_q30_rotate_vector(const int32_t q[4], const int32_t v_in[3], int32_t v_out[3]);
+
+/**
+ * @brief Apply a Q1.30 rotation matrix to a vector in any Qm.n format, like dcm_apply().
+ *
+ * @p v_out may alias @p v_in.
+ */
+void dcm_q30_apply(const int32_t dcm[3][3], const int32_t v_in[3], int32_t v_out[3]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_FIXED_POINT_H
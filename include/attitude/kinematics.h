@@ -0,0 +1,160 @@
+#ifndef ATTITUDE_KINEMATICS_H
+#define ATTITUDE_KINEMATICS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file kinematics.h
+ * @brief Attitude propagation from body angular rate (gyro integration).
+ *
+ * All functions integrate @f$ \dot q = \tfrac12\, q \otimes [0, \omega] @f$ for a body-to-world
+ * quaternion @f$q = [w, x, y, z]@f$ and body-frame angular rate @f$\omega@f$ in rad/s, i.e. a
+ * gyro reading. None of them allocate, and each step keeps @f$q@f$ at unit norm.
+ */
+
+/** @brief Largest number of gyro increments kinematics_integrate_coning() combines per update. */
+#define KINEMATICS_MAX_CONING_SAMPLES 4u
+
+/**
+ * @brief Advance an attitude by one gyro sample using the exact exponential map.
+ *
+ * Computes @f$ q_{\text{out}} = q \otimes \exp(\tfrac12\, \omega\, dt) @f$, which is exact when
+ * the rate is constant over the step. Small rotations (every realistic IMU step) use a Taylor
+ * series instead of sin/cos, and the result is pulled back to unit norm with a first-order
+ * correction instead of a square root.
+ *
+ * @param q      Current attitude (unit norm expected).
+ * @param omega  Body angular rate (rad/s).
+ * @param dt     Step length (s); may be negative to propagate backwards.
+ * @param q_out  Propagated attitude; may alias @p q.
+ * @return 1 on success, 0 for null pointers or a non-finite @p dt.
+ */
+int kinematics_integrate_exp(const double q[4], const double omega[3], double dt, double q_out[4]);
+
+/**
+ * @brief Advance an attitude by one step with classical fourth-order Runge-Kutta.
+ *
+ * The rate is taken to vary linearly from @p omega0 to @p omega1 across the step, so two
+ * consecutive gyro samples give a fourth-order accurate step. The result is normalised.
+ *
+ * @param q       Current attitude.
+ * @param omega0  Body rate at the start of the step (rad/s).
+ * @param omega1  Body rate at the end of the step (rad/s).
+ * @param dt      Step length (s).
+ * @param q_out   Propagated attitude; may alias @p q.
+ * @return 1 on success, 0 for null pointers, a non-finite @p dt, or a zero result.
+ */
+int kinematics_integrate_rk4(const double q[4],
+                             const double omega0[3],
+                             const double omega1[3],
+                             double dt,
+                             double q_out[4]);
+
+/**
+ * @brief Advance an attitude by one coning-compensated multi-sample update.
+ *
+ * Combines @p samples consecutive gyro increments @f$\Delta\theta_i = \int \omega\, dt@f$ (what
+ * most IMUs output; for rate samples use @f$\omega_i\, dt@f$) into one rotation vector
+ * @f$ \phi = \sum \Delta\theta_i + \delta\phi @f$ and applies it with the exponential map.
+ * The coning term @f$\delta\phi@f$ recovers the attitude change that a plain sum misses when
+ * the rate vector rotates within the update:
+ * - 2 samples: @f$ \tfrac23\, \Delta\theta_1 \times \Delta\theta_2 @f$
+ * - 3 samples: @f$ \tfrac{33}{80}\, \Delta\theta_1 \times \Delta\theta_3
+ *   + \tfrac{57}{80}\, \Delta\theta_2 \times (\Delta\theta_3 - \Delta\theta_1) @f$
+ * - 4 samples: the Lee et al. coefficients 736, 334, 526, 654 over 945.
+ *
+ * One sample reduces to kinematics_integrate_exp() with @f$\omega\, dt = \Delta\theta_1@f$.
+ *
+ * @param q            Current attitude (unit norm expected).
+ * @param delta_theta  @p samples increments packed as @c [samples][3] (rad).
+ * @param samples      Number of increments, 1 to #KINEMATICS_MAX_CONING_SAMPLES.
+ * @param q_out        Propagated attitude; may alias @p q.
+ * @return 1 on success, 0 for null pointers or an unsupported @p samples.
+ */
+int kinematics_integrate_coning(const double q[4],
+                                const double *delta_theta,
+                                size_t samples,
+                                double q_out[4]);
+
+/**
+ * @brief Propagate an attitude through a buffer of gyro samples.
+ *
+ * Writes the attitude after every sample: @c q_out[4*i] is the result of chaining
+ * kinematics_integrate_exp() over samples @c 0..i, bit-identical to doing so one call at a
+ * time. This is the hot path for high-rate IMUs: while each sample rotates by less than
+ * about 0.15 rad (1 rad for kinematicsf_propagate()), it costs one quaternion product and a
+ * short polynomial, with no sqrt, sin or cos. Larger steps fall back to those calls.
+ *
+ * @param q0     Attitude before the first sample (unit norm expected).
+ * @param omega  @p count body rates packed as @c [count][3] (rad/s).
+ * @param count  Number of samples.
+ * @param dt     Sample period (s).
+ * @param q_out  @p count attitudes packed as @c [count][4]; must not overlap @p omega.
+ * @return 1 on success, 0 for null pointers or a non-finite @p dt (nothing is written).
+ */
+int kinematics_propagate(const double q0[4], const double *omega, size_t count, double dt, double *q_out);
+
+/**
+ * @brief Propagate an attitude through a buffer of gyro increments with coning compensation.
+ *
+ * Consumes the increments in groups of @p samples_per_update and writes one attitude per
+ * group, each bit-identical to chaining kinematics_integrate_coning().
+ *
+ * @param q0                  Attitude before the first increment (unit norm expected).
+ * @param delta_theta         @p count increments packed as @c [count][3] (rad).
+ * @param count               Number of increments; a multiple of @p samples_per_update.
+ * @param samples_per_update  Group size, 1 to #KINEMATICS_MAX_CONING_SAMPLES.
+ * @param q_out               @p count / @p samples_per_update attitudes packed as @c [n][4].
+ * @return 1 on success, 0 for null pointers or an invalid group size (nothing is written).
+ */
+int kinematics_propagate_coning(const double q0[4],
+                                const double *delta_theta,
+                                size_t count,
+                                size_t samples_per_update,
+                                double *q_out);
+
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision kinematics API
+ *
+ * Float counterparts of the functions above, generated from the same source.
+ * @{
+ */
+/** @brief Single-precision variant of kinematics_integrate_exp(). */
+int kinematicsf_integrate_exp(const float q[4], const float omega[3], float dt, float q_out[4]);
+
+/** @brief Single-precision variant of kinematics_integrate_rk4(). */
+int kinematicsf_integrate_rk4(const float q[4],
+                              const float omega0[3],
+                              const float omega1[3],
+                              float dt,
+                              float q_out[4]);
+
+/** @brief Single-precision variant of kinematics_integrate_coning(). */
+int kinematicsf_integrate_coning(const float q[4],
+                                 const float *delta_theta,
+                                 size_t samples,
+                                 float q_out[4]);
+
+/** @brief Single-precision variant of kinematics_propagate(). */
+int kinematicsf_propagate(const float q0[4], const float *omega, size_t count, float dt, float *q_out);
+
+/** @brief Single-precision variant of kinematics_propagate_coning(). */
+int kinematicsf_propagate_coning(const float q0[4],
+                                 const float *delta_theta,
+                                 size_t count,
+                                 size_t samples_per_update,
+                                 float *q_out);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_KINEMATICS_H
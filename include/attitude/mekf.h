@@ -0,0 +1,170 @@
+#ifndef ATTITUDE_MEKF_H
+#define ATTITUDE_MEKF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file mekf.h
+ * @brief Multiplicative extended Kalman filter (MEKF) for attitude and gyro bias.
+ *
+ * The estimate is a body-to-world quaternion @f$\hat q@f$ and a gyro bias @f$\hat b@f$; the
+ * filter state is the six-element error
+ * @f$\delta x = [\delta\theta, \delta b]@f$ with
+ * @f$q = \hat q \otimes [1, \delta\theta / 2]@f$ (body-frame attitude error) and
+ * @f$b = \hat b + \delta b@f$. The gyro is modelled as
+ * @f$\omega_m = \omega + b + \eta_v@f$ with the bias a random walk driven by @f$\eta_u@f$
+ * (Lefferts, Markley and Shuster 1982; Markley and Crassidis 2014, ch. 6).
+ *
+ * The kernels are written for this structure rather than for a general 6x6 EKF:
+ * - The covariance is stored as its upper triangle (21 values) and every operation keeps it
+ *   exactly symmetric.
+ * - Prediction uses the block form of @f$\Phi P \Phi^T + Q@f$ with
+ *   @f$\Phi = [[\Theta, -I\,dt], [0, I]]@f$, where @f$\Theta@f$ is the exact step rotation,
+ *   so the 6x6 products reduce to two 3x3 products and a few scaled additions.
+ * - Measurements are processed one scalar component at a time, so the gain is a vector
+ *   divided by a scalar: no matrix is inverted, and each component costs one symmetric
+ *   rank-one downdate of the triangle. This is exact for measurement noise that is
+ *   uncorrelated between components, which is what the update functions assume.
+ *
+ * After each update the error is folded into @f$\hat q@f$ and @f$\hat b@f$ and reset to zero;
+ * the second-order covariance reset term is neglected, as is usual.
+ */
+
+/** @brief Dimension of the error state: three attitude and three bias components. */
+#define MEKF_STATE_DIM 6
+/** @brief Number of stored covariance entries, the upper triangle of the 6x6 matrix. */
+#define MEKF_COVARIANCE_SIZE 21
+
+/**
+ * @brief Filter state; initialise with mekf_init().
+ *
+ * @c p holds the upper triangle of the error covariance packed row by row:
+ * @f$P_{00}, P_{01}, \dots, P_{05}, P_{11}, \dots, P_{15}, P_{22}, \dots, P_{55}@f$. Use
+ * mekf_covariance() to expand it.
+ */
+typedef struct {
+    double q[4];                        ///< Body-to-world attitude estimate @f$[w, x, y, z]@f$.
+    double bias[3];                     ///< Gyro bias estimate (rad/s), subtracted from readings.
+    double p[MEKF_COVARIANCE_SIZE];     ///< Packed upper triangle of the error covariance.
+    double gyro_noise;                  ///< Angle random walk PSD @f$\sigma_v^2@f$ (rad^2/s).
+    double bias_noise;                  ///< Bias random walk PSD @f$\sigma_u^2@f$ (rad^2/s^3).
+} MekfFilter;
+
+/** @brief Single-precision filter state, used by the @c mekff_* functions. */
+typedef struct {
+    float q[4];                         ///< Body-to-world attitude estimate @f$[w, x, y, z]@f$.
+    float bias[3];                      ///< Gyro bias estimate (rad/s).
+    float p[MEKF_COVARIANCE_SIZE];      ///< Packed upper triangle of the error covariance.
+    float gyro_noise;                   ///< Angle random walk PSD (rad^2/s).
+    float bias_noise;                   ///< Bias random walk PSD (rad^2/s^3).
+} MekfFilterf;
+
+/**
+ * @brief Initialise the filter with a diagonal covariance.
+ *
+ * @param filter          Filter to initialise.
+ * @param q0              Initial attitude, normalised on the way in; NULL for the identity.
+ * @param attitude_sigma  Initial attitude uncertainty per axis (rad).
+ * @param bias_sigma      Initial bias uncertainty per axis (rad/s).
+ * @param gyro_noise      Gyro angle random walk density @f$\sigma_v@f$ (rad/s/sqrt(Hz)).
+ * @param bias_noise      Bias instability density @f$\sigma_u@f$ (rad/s^2/sqrt(Hz)).
+ * @return 1 on success; 0 (filter unchanged) for a NULL filter, a zero or non-finite @p q0,
+ *         or a negative or non-finite parameter.
+ */
+int mekf_init(MekfFilter *filter,
+              const double q0[4],
+              double attitude_sigma,
+              double bias_sigma,
+              double gyro_noise,
+              double bias_noise);
+
+/**
+ * @brief Propagate the estimate and covariance through one gyro sample.
+ *
+ * The bias-corrected rate @f$\omega_m - \hat b@f$ is applied with the exponential map (as in
+ * kinematics_integrate_exp()) and the covariance with the exact step rotation.
+ *
+ * @param filter  Filter state, updated in place.
+ * @param gyro    Measured body rate (rad/s).
+ * @param dt      Step length (s), non-negative.
+ * @return 1 on success; 0 (filter unchanged) for null pointers or non-finite or negative input.
+ */
+int mekf_predict(MekfFilter *filter, const double gyro[3], double dt);
+
+/**
+ * @brief Update with a direction measured in the body frame.
+ *
+ * For a known world-frame direction such as gravity (accelerometer at rest, @c {0, 0, 1} for a
+ * z-up world) or the magnetic field. Both vectors are normalised, so their units do not
+ * matter; @p variance is the per-component noise of the normalised measurement (rad^2).
+ *
+ * @param filter     Filter state, updated in place.
+ * @param measured   Direction measured in the body frame.
+ * @param reference  The same direction in the world frame.
+ * @param variance   Measurement noise variance per component, positive.
+ * @return 1 on success; 0 (filter unchanged) for null pointers, zero or non-finite vectors, or
+ *         a non-positive or non-finite variance.
+ */
+int mekf_update_vector(MekfFilter *filter, const double measured[3], const double reference[3], double variance);
+
+/**
+ * @brief Update with a full attitude measurement, e.g. from a star tracker.
+ *
+ * The measured quaternion may have either sign and need not be exactly unit.
+ *
+ * @param filter    Filter state, updated in place.
+ * @param q_meas    Measured body-to-world attitude.
+ * @param variance  Noise variance of each body-frame error angle (rad^2), positive.
+ * @return 1 on success; 0 (filter unchanged) for null pointers, a zero or non-finite
+ *         quaternion, or a non-positive or non-finite variance.
+ */
+int mekf_update_attitude(MekfFilter *filter, const double q_meas[4], double variance);
+
+/**
+ * @brief Expand the packed covariance into a full symmetric matrix.
+ *
+ * @param filter  Filter state.
+ * @param p       Output 6x6 covariance, error-state order @f$[\delta\theta, \delta b]@f$.
+ * @return 1 on success; 0 for null pointers.
+ */
+int mekf_covariance(const MekfFilter *filter, double p[MEKF_STATE_DIM][MEKF_STATE_DIM]);
+
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision MEKF API
+ *
+ * Float counterparts of the functions above, generated from the same source. The packed
+ * covariance stays symmetric by construction, but with float's 24-bit mantissa keep the
+ * measurement variances well above @c FLT_EPSILON times the prior variances.
+ * @{
+ */
+/** @brief Single-precision variant of mekf_init(). */
+int mekff_init(MekfFilterf *filter,
+               const float q0[4],
+               float attitude_sigma,
+               float bias_sigma,
+               float gyro_noise,
+               float bias_noise);
+
+/** @brief Single-precision variant of mekf_predict(). */
+int mekff_predict(MekfFilterf *filter, const float gyro[3], float dt);
+
+/** @brief Single-precision variant of mekf_update_vector(). */
+int mekff_update_vector(MekfFilterf *filter, const float measured[3], const float reference[3], float variance);
+
+/** @brief Single-precision variant of mekf_update_attitude(). */
+int mekff_update_attitude(MekfFilterf *filter, const float q_meas[4], float variance);
+
+/** @brief Single-precision variant of mekf_covariance(). */
+int mekff_covariance(const MekfFilterf *filter, float p[MEKF_STATE_DIM][MEKF_STATE_DIM]);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_MEKF_H
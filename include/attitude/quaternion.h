@@ -1,6 +1,8 @@
 #ifndef ATTITUDE_QUATERNION_H
 #define ATTITUDE_QUATERNION_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -31,12 +33,38 @@ void quaternion_to_euler(const double q[4], double *roll, double *pitch, double
 /**
  * @brief Normalise a quaternion in-place.
  *
- * If the quaternion norm is very small the vector is left unchanged.
+ * If the quaternion norm is very small the vector is left unchanged. Otherwise it is always
+ * divided by its norm, however close that already is to one. For per-step renormalisation of
+ * an integrated attitude, quaternion_renormalize() is cheaper.
  *
  * @param q Quaternion to normalise.
  */
 void quaternion_normalize(double q[4]);
 
+/**
+ * @brief Pull a nearly unit quaternion back to unit norm in place, cheaply.
+ *
+ * Meant for the renormalisation step of attitude integrators and filters, where the norm
+ * only drifts by rounding. When the squared norm is within about 4e-6 of one the inverse norm
+ * comes from the short series @f$1 - e/2 + 3e^2/8@f$ in @f$e = \|q\|^2 - 1@f$, with no square
+ * root or division; otherwise the exact @f$1/\|q\|@f$ is used. Either way the result is unit
+ * to rounding, and there is no "already close enough" skip, so drift cannot accumulate
+ * across calls.
+ *
+ * @param q Quaternion to renormalise.
+ * @return 1 on success; 0 (quaternion unchanged) for a null pointer, the zero quaternion, or a
+ *         non-finite (or overflowing) norm.
+ */
+int quaternion_renormalize(double q[4]);
+
+/**
+ * @brief quaternion_renormalize() on @p count quaternions packed as @c [count][4], in place.
+ *
+ * @return 1 if every quaternion was renormalised; 0 for a null pointer with @p count > 0, or if
+ *         any quaternion was rejected (it is left unchanged and the rest are still processed).
+ */
+int quaternion_renormalize_batch(double *q, size_t count);
+
 /**
  * @brief Multiply two quaternions using Hamilton product.
  *
@@ -104,6 +132,75 @@ int quaternion_orientation_error_axis_angle(const double q_current[4],
  */
 int quaternion_to_axis_angle(const double q[4], double axis[3], double *angle);
 
+/**
+ * @brief Exponential map: rotation vector to unit quaternion.
+ *
+ * Returns @f$ q = [\cos\tfrac{\theta}{2},\ \sin\tfrac{\theta}{2}\, \hat r] @f$ for the rotation
+ * vector @f$ r = \theta \hat r @f$ (axis times angle in radians). Small angles use a Taylor
+ * series, so the result is exact to rounding all the way down to zero with no special case.
+ *
+ * @param rotvec  Rotation vector (rad).
+ * @param q_out   Output unit quaternion.
+ */
+void quaternion_exp(const double rotvec[3], double q_out[4]);
+
+/**
+ * @brief Logarithm map: quaternion to rotation vector.
+ *
+ * Inverse of quaternion_exp(). The result is the shortest rotation vector (angle in
+ * @f$[0, \pi]@f$), so @p q and @f$-q@f$ give the same answer. The input need not be unit.
+ * Uses @c atan2 (or its series near identity) rather than @c acos, which keeps full relative
+ * precision for tiny rotations.
+ *
+ * @param q       Input quaternion.
+ * @param rotvec  Output rotation vector (rad); NaN on failure.
+ * @return 1 on success, 0 when @p q is zero or non-finite.
+ */
+int quaternion_log(const double q[4], double rotvec[3]);
+
+/**
+ * @brief Convert a rotation vector directly to a direction cosine matrix.
+ *
+ * Rodrigues' formula with small-angle series; equals quaternion_to_dcm() of
+ * quaternion_exp() to rounding, without forming the quaternion.
+ *
+ * @param rotvec  Rotation vector (rad).
+ * @param dcm     Output @f$3\times3@f$ rotation matrix (body to world, row-major).
+ */
+void rotvec_to_dcm(const double rotvec[3], double dcm[3][3]);
+
+/**
+ * @brief quaternion_exp() over a packed array.
+ *
+ * @param rotvecs  @p count rotation vectors packed as @c [count][3].
+ * @param count    Number of elements.
+ * @param q_out    @p count quaternions packed as @c [count][4].
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_exp_batch(const double *rotvecs, size_t count, double *q_out);
+
+/**
+ * @brief quaternion_log() over a packed array.
+ *
+ * Elements that cannot be converted are set to NaN; the others are still written.
+ *
+ * @param q        @p count quaternions packed as @c [count][4].
+ * @param count    Number of elements.
+ * @param rotvecs  @p count rotation vectors packed as @c [count][3].
+ * @return 1 when every element converted, 0 for null pointers or any invalid element.
+ */
+int quaternion_log_batch(const double *q, size_t count, double *rotvecs);
+
+/**
+ * @brief rotvec_to_dcm() over a packed array.
+ *
+ * @param rotvecs  @p count rotation vectors packed as @c [count][3].
+ * @param count    Number of elements.
+ * @param dcm_out  @p count output matrices.
+ * @return 1 on success, 0 for null pointers.
+ */
+int rotvec_to_dcm_batch(const double *rotvecs, size_t count, double dcm_out[][3][3]);
+
 /**
  * @brief Interpolate two quaternions using spherical linear interpolation (SLERP).
  *
@@ -138,6 +235,32 @@ void axis_angle_rotate(const double axis[3], double angle, const double v_in[3],
  */
 void quaternion_rotate_vector(const double q[4], const double v_in[3], double v_out[3]);
 
+/**
+ * @brief Rotate a contiguous array of vectors by a single quaternion.
+ *
+ * The rotation matrix is derived from @p q once and then streamed over the buffer, so this is
+ * the preferred entry point for point clouds and other large vector sets. Each result is
+ * bit-identical to calling quaternion_rotate_vector() on the same element.
+ *
+ * Vector @c i starts at @c v_in[i * stride] and is written to @c v_out[i * stride]. Padding
+ * between vectors (e.g. an intensity channel with @p stride = 4) is neither read nor written.
+ *
+ * Aliasing: @p v_in and @p v_out may be the same pointer for in-place rotation. Any other
+ * overlap between the two buffers is undefined.
+ *
+ * @param q       Rotation quaternion (unit norm expected).
+ * @param v_in    First input vector.
+ * @param v_out   First output vector.
+ * @param count   Number of vectors to rotate.
+ * @param stride  Distance between consecutive vectors in doubles; at least 3.
+ * @return 1 on success, 0 for null pointers or @p stride < 3.
+ */
+int quaternion_rotate_vectors(const double q[4],
+                              const double *v_in,
+                              double *v_out,
+                              size_t count,
+                              size_t stride);
+
 /**
  * @brief Rotate a vector using the explicit @f$q v q^\* @f$ formulation.
  *
@@ -159,8 +282,104 @@ void quaternion_rotate_vector_explicit(const double q[4], const double v_in[3],
 void quaternion_set_explicit_debug(int enabled);
 
 
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision quaternion API
+ *
+ * Float counterparts of the functions above, generated from the same source. They follow the
+ * same conventions and return codes and never promote to double, so they run on
+ * single-precision FPUs such as the Cortex-M4F without soft-float calls.
+ * @{
+ */
+/** @brief Single-precision variant of quaternion_to_dcm(). */
+void quaternionf_to_dcm(const float q[4], float dcm[3][3]);
+
+/** @brief Single-precision variant of quaternion_to_euler(). */
+void quaternionf_to_euler(const float q[4], float *roll, float *pitch, float *yaw);
+
+/** @brief Single-precision variant of quaternion_normalize(). */
+void quaternionf_normalize(float q[4]);
+
+/** @brief Single-precision variant of quaternion_renormalize(); the series covers squared norms within about 4e-3 of one. */
+int quaternionf_renormalize(float q[4]);
+
+/** @brief Single-precision variant of quaternion_renormalize_batch(). */
+int quaternionf_renormalize_batch(float *q, size_t count);
+
+/** @brief Single-precision variant of quaternion_multiply(). */
+void quaternionf_multiply(const float q1[4], const float q2[4], float q_out[4]);
+
+/** @brief Single-precision variant of quaternion_inverse(). */
+int quaternionf_inverse(const float q[4], float q_inv[4]);
+
+/** @brief Single-precision variant of quaternion_relative(). */
+int quaternionf_relative(const float q_current[4], const float q_target[4], float q_error[4]);
+
+/** @brief Single-precision variant of quaternion_orientation_error_axis_angle(). */
+int quaternionf_orientation_error_axis_angle(const float q_current[4],
+                                             const float q_target[4],
+                                             float axis[3],
+                                             float *angle);
+
+/** @brief Single-precision variant of quaternion_to_axis_angle(). */
+int quaternionf_to_axis_angle(const float q[4], float axis[3], float *angle);
+
+/** @brief Single-precision variant of quaternion_exp(). */
+void quaternionf_exp(const float rotvec[3], float q_out[4]);
+
+/** @brief Single-precision variant of quaternion_log(). */
+int quaternionf_log(const float q[4], float rotvec[3]);
+
+/** @brief Single-precision variant of rotvec_to_dcm(). */
+void rotvecf_to_dcm(const float rotvec[3], float dcm[3][3]);
+
+/** @brief Single-precision variant of quaternion_exp_batch(). */
+int quaternionf_exp_batch(const float *rotvecs, size_t count, float *q_out);
+
+/** @brief Single-precision variant of quaternion_log_batch(). */
+int quaternionf_log_batch(const float *q, size_t count, float *rotvecs);
+
+/** @brief Single-precision variant of rotvec_to_dcm_batch(). */
+int rotvecf_to_dcm_batch(const float *rotvecs, size_t count, float dcm_out[][3][3]);
+
+/** @brief Single-precision variant of quaternion_slerp(). */
+void quaternionf_slerp(const float q1[4], const float q2[4], float t, float q_out[4]);
+
+/** @brief Single-precision variant of axis_angle_rotate(). */
+void axis_anglef_rotate(const float axis[3], float angle, const float v_in[3], float v_out[3]);
+
+/** @brief Single-precision variant of quaternion_rotate_vector(). */
+void quaternionf_rotate_vector(const float q[4], const float v_in[3], float v_out[3]);
+
+/** @brief Single-precision variant of quaternion_rotate_vectors(); @p stride is in floats. */
+int quaternionf_rotate_vectors(const float q[4],
+                               const float *v_in,
+                               float *v_out,
+                               size_t count,
+                               size_t stride);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
 
+/*
+ * Opt-in header-only hot path: with ATTITUDE_INLINE defined before this header, calls to
+ * quaternion_multiply(), quaternion_to_dcm(), quaternion_rotate_vector() and their float
+ * variants expand to the static inline bodies in quaternion_inline.h, so loops over them can
+ * be inlined and vectorised without LTO. The exported symbols and the shared-library ABI are
+ * unchanged; (name)(...) or &name still reach the library function. Define it for consumers
+ * only, never when building the library itself.
+ */
+#ifdef ATTITUDE_INLINE
+#include "attitude/quaternion_inline.h"
+#define quaternion_multiply(q1, q2, q_out) quaternion_multiply_inline((q1), (q2), (q_out))
+#define quaternion_to_dcm(q, dcm) quaternion_to_dcm_inline((q), (dcm))
+#define quaternion_rotate_vector(q, v_in, v_out) quaternion_rotate_vector_inline((q), (v_in), (v_out))
+#define quaternionf_multiply(q1, q2, q_out) quaternionf_multiply_inline((q1), (q2), (q_out))
+#define quaternionf_to_dcm(q, dcm) quaternionf_to_dcm_inline((q), (dcm))
+#define quaternionf_rotate_vector(q, v_in, v_out) quaternionf_rotate_vector_inline((q), (v_in), (v_out))
+#endif
+
 #endif // ATTITUDE_QUATERNION_H
@@ -0,0 +1,189 @@
+#ifndef ATTITUDE_QUATERNION_CODEC_H
+#define ATTITUDE_QUATERNION_CODEC_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file quaternion_codec.h
+ * @brief Compressed quaternion encodings for telemetry and logs.
+ *
+ * Two formats, both quantising to a bit depth @c b between ::QUATERNION_CODEC_MIN_BITS and
+ * ::QUATERNION_CODEC_MAX_BITS:
+ *
+ * - **Smallest-three packing** (quaternion_pack()): every quaternion becomes one fixed-width
+ *   record of @c 2 + 3b bits, the index of its largest-magnitude component followed by the other
+ *   three components. The largest component is made positive (q and -q are the same rotation)
+ *   and recovered from the unit norm, and the other three lie in @f$[-1/\sqrt{2}, 1/\sqrt{2}]@f$,
+ *   which is quantised to @f$2^{b-1} - 1@f$ steps each side of zero. Records can be decoded in
+ *   any order.
+ * - **Delta / predictive streams** (quaternion_stream_encode()): every sample is coded as the
+ *   rotation from a prediction to the sample, computed with quaternion_relative(). The
+ *   prediction is the previous decoded sample (::QUATERNION_CODEC_DELTA) or that sample
+ *   advanced by the last decoded step (::QUATERNION_CODEC_PREDICTIVE, exact for a constant
+ *   rate). The residual's vector part is quantised with the step of the packed format and
+ *   stored with variable length, so smooth motion costs a few bits per sample. Samples the
+ *   residual cannot represent (more than 90 degrees off, or too large for the longest code)
+ *   become smallest-three keyframes, which also reset the predicted step. The encoder
+ *   predicts from its own decoded output, so quantisation errors never accumulate.
+ *
+ * Maximum angular error between a sample and its decoded value, both formats, from
+ * quaternion_codec_max_error():
+ *
+ * | Bits | Packed record | Max error (rad) | Max error (deg) |
+ * |------|---------------|-----------------|-----------------|
+ * | 4    | 14 bits       | 4.21e-1         | 24.1            |
+ * | 8    | 26 bits       | 1.95e-2         | 1.12            |
+ * | 10   | 32 bits       | 4.81e-3         | 0.275           |
+ * | 12   | 38 bits       | 1.20e-3         | 0.0686          |
+ * | 14   | 44 bits       | 2.99e-4         | 0.0171          |
+ * | 16   | 50 bits       | 7.48e-5         | 4.28e-3         |
+ * | 18   | 56 bits       | 1.87e-5         | 1.07e-3         |
+ *
+ * Decode throughput on one 2.1 GHz Xeon core at 16 bits (attitude_bench --filter
+ * quaternion_codec, a smooth 1 kHz trajectory):
+ *
+ * | Decoder                                | Samples/s   |
+ * |----------------------------------------|-------------|
+ * | quaternion_unpack()                    | 110M - 220M |
+ * | quaternion_stream_decode(), delta      | 50M - 90M   |
+ * | quaternion_stream_decode(), predictive | 35M - 60M   |
+ *
+ * Only packed records reach 100M samples/s. A stream sample cannot be reconstructed before the
+ * previous one, so stream decoding runs one sample after another: record parsing plus one
+ * quaternion product (two in predictive mode) per sample, without FMA so the results are
+ * reproducible. Ground tools that must decode faster should store packed records; those can
+ * also be split across threads.
+ *
+ * Bit streams are little-endian: record fields are stored least significant bit first, and
+ * records follow each other without padding. Encoded data is identical on every platform.
+ * The library builds this module without floating-point contraction, so a decoder on another
+ * machine reproduces the encoder's predictions bit for bit.
+ */
+
+/** @brief Smallest supported bit depth per component. */
+#define QUATERNION_CODEC_MIN_BITS 4u
+/** @brief Largest supported bit depth per component (a packed record then fills 56 bits). */
+#define QUATERNION_CODEC_MAX_BITS 18u
+
+/** @brief Bytes written by quaternion_pack() for @p count quaternions at @p bits. */
+#define QUATERNION_PACK_BYTES(count, bits) ((((size_t)(count)) * (2u + 3u * (size_t)(bits)) + 7u) / 8u)
+
+/**
+ * @brief Upper bound on the bytes written by quaternion_stream_encode().
+ *
+ * A sample costs at most 46 bits as a residual and @c 6 + 3b bits as a keyframe.
+ */
+#define QUATERNION_STREAM_MAX_BYTES(count, bits) \
+    ((((size_t)(count)) * ((bits) > 13u ? 6u + 3u * (size_t)(bits) : 46u) + 7u) / 8u)
+
+/** @brief Prediction used by quaternion_stream_encode(). */
+typedef enum {
+    QUATERNION_CODEC_DELTA,      ///< Code each sample relative to the previous one.
+    QUATERNION_CODEC_PREDICTIVE  ///< Code each sample relative to a constant-rate extrapolation.
+} QuaternionCodecMode;
+
+/** @brief Parameters of a quaternion stream; the decoder needs the same @c bits and @c mode. */
+typedef struct {
+    unsigned bits;            ///< Quantisation depth, as for quaternion_pack().
+    QuaternionCodecMode mode; ///< Prediction.
+    size_t keyframe_interval; ///< Force a keyframe every this many samples (0: only the first).
+                              ///< A keyframe restarts the prediction, so a corrupted residual
+                              ///< only spoils the samples up to the next one. A corrupted 4-bit
+                              ///< record tag shifts every later record boundary, which keyframes
+                              ///< cannot repair. Each costs a packed record plus 4 bits. Ignored
+                              ///< by the decoder.
+} QuaternionStreamConfig;
+
+/**
+ * @brief Largest angle between a unit quaternion and its decoded value at @p bits, in radians.
+ *
+ * For a quantisation step @f$s = (1/\sqrt{2}) / (2^{b-1} - 1)@f$ this is @f$2\sqrt{3}\,s@f$
+ * plus a second-order margin: each of the three stored components is off by at most
+ * @f$s/2@f$, and rebuilding the largest component from the unit norm at most doubles that.
+ * Residuals of a stream are within @f$\sqrt{6}\,s@f$.
+ *
+ * @return The bound, or 0 for an unsupported bit depth.
+ */
+double quaternion_codec_max_error(unsigned bits);
+
+/**
+ * @brief Pack quaternions into smallest-three records.
+ *
+ * Inputs need not be normalised. Zero or non-finite quaternions are stored as the identity.
+ *
+ * @param q      @p count quaternions stored contiguously as @f$[w, x, y, z]@f$.
+ * @param count  Number of quaternions; 0 is allowed with null pointers.
+ * @param bits   Bits per stored component.
+ * @param out    QUATERNION_PACK_BYTES(count, bits) bytes.
+ * @return 1 when every quaternion was stored; 0 if any was replaced by the identity, or for an
+ *         unsupported @p bits or null pointers (in which case nothing is written).
+ */
+int quaternion_pack(const double *q, size_t count, unsigned bits, unsigned char *out);
+
+/**
+ * @brief Decode smallest-three records.
+ *
+ * Outputs are unit quaternions; the component that was largest in magnitude when packing is
+ * non-negative.
+ *
+ * @param in     QUATERNION_PACK_BYTES(count, bits) bytes from quaternion_pack().
+ * @param count  Number of records; 0 is allowed with null pointers.
+ * @param bits   Bit depth used to pack.
+ * @param q_out  @p count output quaternions.
+ * @return 1 on success; 0 for an unsupported @p bits or null pointers.
+ */
+int quaternion_unpack(const unsigned char *in, size_t count, unsigned bits, double *q_out);
+
+/**
+ * @brief Encode a quaternion sequence as a delta or predictive stream.
+ *
+ * The first sample is always a keyframe, so every call produces a stream that decodes on its
+ * own. Zero or non-finite samples are coded as an exact hit on the prediction (the decoder
+ * repeats it); the first sample falls back to the identity.
+ *
+ * @param q         @p count quaternions stored contiguously as @f$[w, x, y, z]@f$.
+ * @param count     Number of samples; 0 is allowed with null pointers.
+ * @param config    Bit depth, prediction and keyframe interval.
+ * @param out       Output buffer.
+ * @param capacity  Size of @p out; at least QUATERNION_STREAM_MAX_BYTES(count, config->bits).
+ * @param size      Receives the bytes written.
+ * @return 1 when every sample was coded; 0 if a sample was replaced by its prediction, or for
+ *         null pointers, an unsupported configuration or a short buffer (in which case nothing
+ *         is written and @p size, when not NULL, is 0).
+ */
+int quaternion_stream_encode(const double *q,
+                             size_t count,
+                             const QuaternionStreamConfig *config,
+                             unsigned char *out,
+                             size_t capacity,
+                             size_t *size);
+
+/**
+ * @brief Decode a stream from quaternion_stream_encode().
+ *
+ * Sequential, and slower than quaternion_unpack(); see the throughput table above.
+ *
+ * @param in      Encoded bytes.
+ * @param size    Number of encoded bytes.
+ * @param count   Number of samples to decode.
+ * @param config  Bit depth and prediction used to encode (@c keyframe_interval is ignored).
+ * @param q_out   @p count output quaternions.
+ * @return 1 on success; 0 for null pointers, an unsupported configuration, a stream that does
+ *         not start with a keyframe, or one that ends before @p count samples (the samples
+ *         decoded past the end are not meaningful).
+ */
+int quaternion_stream_decode(const unsigned char *in,
+                             size_t size,
+                             size_t count,
+                             const QuaternionStreamConfig *config,
+                             double *q_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_QUATERNION_CODEC_H
@@ -0,0 +1,180 @@
+#ifndef ATTITUDE_QUATERNION_INLINE_H
+#define ATTITUDE_QUATERNION_INLINE_H
+
+/**
+ * @file quaternion_inline.h
+ * @brief Header-only definitions of the quaternion hot-path kernels.
+ *
+ * quaternion_multiply(), quaternion_to_dcm() and quaternion_rotate_vector() live in the
+ * library, so a loop calling them pays a call per element and cannot be unrolled or
+ * vectorised across iterations without link-time optimisation. The @c *_inline functions
+ * below are the bodies of those library functions (the library is built from them), so the
+ * compiler sees everything.
+ *
+ * Include this header to call the @c *_inline names directly, or define @c ATTITUDE_INLINE
+ * before including quaternion.h to have the ordinary names expand to them (see quaternion.h).
+ * Results are bit-identical to the library's unless the including translation unit lets the
+ * compiler contract multiply-adds into FMAs (the library is built with
+ * @c -ffp-contract=off), in which case they may differ in the last place.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Inline body of quaternion_multiply(). @p q_out may alias either input. */
+static inline void quaternion_multiply_inline(const double q1[4], const double q2[4], double q_out[4]) {
+    const double w1 = q1[0], x1 = q1[1], y1 = q1[2], z1 = q1[3];
+    const double w2 = q2[0], x2 = q2[1], y2 = q2[2], z2 = q2[3];
+
+    q_out[0] = w1*w2 - x1*x2 - y1*y2 - z1*z2;
+    q_out[1] = w1*x2 + x1*w2 + y1*z2 - z1*y2;
+    q_out[2] = w1*y2 - x1*z2 + y1*w2 + z1*x2;
+    q_out[3] = w1*z2 + x1*y2 - y1*x2 + z1*w2;
+}
+
+/** @brief Inline body of quaternion_to_dcm(). */
+static inline void quaternion_to_dcm_inline(const double q[4], double dcm[3][3]) {
+    const double w = q[0], x = q[1], y = q[2], z = q[3];
+
+    const double xx = x*x, yy = y*y, zz = z*z;
+    const double xy = x*y, xz = x*z, yz = y*z;
+    const double wx = w*x, wy = w*y, wz = w*z;
+
+    dcm[0][0] = 1.0 - 2.0*(yy + zz);
+    dcm[0][1] = 2.0*(xy - wz);
+    dcm[0][2] = 2.0*(xz + wy);
+    dcm[1][0] = 2.0*(xy + wz);
+    dcm[1][1] = 1.0 - 2.0*(xx + zz);
+    dcm[1][2] = 2.0*(yz - wx);
+    dcm[2][0] = 2.0*(xz - wy);
+    dcm[2][1] = 2.0*(yz + wx);
+    dcm[2][2] = 1.0 - 2.0*(xx + yy);
+}
+
+/**
+ * @brief Rotation matrix applied by quaternion_rotate_vector() and quaternion_rotate_vectors().
+ *
+ * Uses the homogeneous form of the diagonal (@f$w^2 + x^2 - y^2 - z^2@f$), so it differs from
+ * quaternion_to_dcm() by rounding.
+ */
+static inline void quaternion_rotation_matrix_inline(const double q[4], double r[3][3]) {
+    const double q0q0 = q[0] * q[0];
+    const double q1q1 = q[1] * q[1];
+    const double q2q2 = q[2] * q[2];
+    const double q3q3 = q[3] * q[3];
+
+    const double q0q1 = q[0] * q[1];
+    const double q0q2 = q[0] * q[2];
+    const double q0q3 = q[0] * q[3];
+    const double q1q2 = q[1] * q[2];
+    const double q1q3 = q[1] * q[3];
+    const double q2q3 = q[2] * q[3];
+
+    r[0][0] = q0q0 + q1q1 - q2q2 - q3q3;
+    r[0][1] = 2.0 * (q1q2 - q0q3);
+    r[0][2] = 2.0 * (q1q3 + q0q2);
+
+    r[1][0] = 2.0 * (q1q2 + q0q3);
+    r[1][1] = q0q0 - q1q1 + q2q2 - q3q3;
+    r[1][2] = 2.0 * (q2q3 - q0q1);
+
+    r[2][0] = 2.0 * (q1q3 - q0q2);
+    r[2][1] = 2.0 * (q2q3 + q0q1);
+    r[2][2] = q0q0 - q1q1 - q2q2 + q3q3;
+}
+
+/** @brief Inline body of quaternion_rotate_vector(). @p v_out may alias @p v_in. */
+static inline void quaternion_rotate_vector_inline(const double q[4], const double v_in[3], double v_out[3]) {
+    double r[3][3];
+    quaternion_rotation_matrix_inline(q, r);
+
+    // Read the whole input before writing so v_in and v_out may alias.
+    const double x = v_in[0], y = v_in[1], z = v_in[2];
+    v_out[0] = r[0][0] * x + r[0][1] * y + r[0][2] * z;
+    v_out[1] = r[1][0] * x + r[1][1] * y + r[1][2] * z;
+    v_out[2] = r[2][0] * x + r[2][1] * y + r[2][2] * z;
+}
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision inline kernels
+ *
+ * Float counterparts of the functions above; the bodies of the @c quaternionf_* functions.
+ * @{
+ */
+/** @brief Inline body of quaternionf_multiply(). */
+static inline void quaternionf_multiply_inline(const float q1[4], const float q2[4], float q_out[4]) {
+    const float w1 = q1[0], x1 = q1[1], y1 = q1[2], z1 = q1[3];
+    const float w2 = q2[0], x2 = q2[1], y2 = q2[2], z2 = q2[3];
+
+    q_out[0] = w1*w2 - x1*x2 - y1*y2 - z1*z2;
+    q_out[1] = w1*x2 + x1*w2 + y1*z2 - z1*y2;
+    q_out[2] = w1*y2 - x1*z2 + y1*w2 + z1*x2;
+    q_out[3] = w1*z2 + x1*y2 - y1*x2 + z1*w2;
+}
+
+/** @brief Inline body of quaternionf_to_dcm(). */
+static inline void quaternionf_to_dcm_inline(const float q[4], float dcm[3][3]) {
+    const float w = q[0], x = q[1], y = q[2], z = q[3];
+
+    const float xx = x*x, yy = y*y, zz = z*z;
+    const float xy = x*y, xz = x*z, yz = y*z;
+    const float wx = w*x, wy = w*y, wz = w*z;
+
+    dcm[0][0] = 1.0f - 2.0f*(yy + zz);
+    dcm[0][1] = 2.0f*(xy - wz);
+    dcm[0][2] = 2.0f*(xz + wy);
+    dcm[1][0] = 2.0f*(xy + wz);
+    dcm[1][1] = 1.0f - 2.0f*(xx + zz);
+    dcm[1][2] = 2.0f*(yz - wx);
+    dcm[2][0] = 2.0f*(xz - wy);
+    dcm[2][1] = 2.0f*(yz + wx);
+    dcm[2][2] = 1.0f - 2.0f*(xx + yy);
+}
+
+/** @brief Single-precision variant of quaternion_rotation_matrix_inline(). */
+static inline void quaternionf_rotation_matrix_inline(const float q[4], float r[3][3]) {
+    const float q0q0 = q[0] * q[0];
+    const float q1q1 = q[1] * q[1];
+    const float q2q2 = q[2] * q[2];
+    const float q3q3 = q[3] * q[3];
+
+    const float q0q1 = q[0] * q[1];
+    const float q0q2 = q[0] * q[2];
+    const float q0q3 = q[0] * q[3];
+    const float q1q2 = q[1] * q[2];
+    const float q1q3 = q[1] * q[3];
+    const float q2q3 = q[2] * q[3];
+
+    r[0][0] = q0q0 + q1q1 - q2q2 - q3q3;
+    r[0][1] = 2.0f * (q1q2 - q0q3);
+    r[0][2] = 2.0f * (q1q3 + q0q2);
+
+    r[1][0] = 2.0f * (q1q2 + q0q3);
+    r[1][1] = q0q0 - q1q1 + q2q2 - q3q3;
+    r[1][2] = 2.0f * (q2q3 - q0q1);
+
+    r[2][0] = 2.0f * (q1q3 - q0q2);
+    r[2][1] = 2.0f * (q2q3 + q0q1);
+    r[2][2] = q0q0 - q1q1 - q2q2 + q3q3;
+}
+
+/** @brief Inline body of quaternionf_rotate_vector(). */
+static inline void quaternionf_rotate_vector_inline(const float q[4], const float v_in[3], float v_out[3]) {
+    float r[3][3];
+    quaternionf_rotation_matrix_inline(q, r);
+
+    const float x = v_in[0], y = v_in[1], z = v_in[2];
+    v_out[0] = r[0][0] * x + r[0][1] * y + r[0][2] * z;
+    v_out[1] = r[1][0] * x + r[1][1] * y + r[1][2] * z;
+    v_out[2] = r[2][0] * x + r[2][1] * y + r[2][2] * z;
+}
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_QUATERNION_INLINE_H
@@ -0,0 +1,181 @@
+#ifndef ATTITUDE_QUATERNION_SOA_H
+#define ATTITUDE_QUATERNION_SOA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Alignment, in bytes, of every lane carved by quaternion_soa_init().
+ *
+ * 64 bytes covers a full AVX-512 register and a typical cache line.
+ */
+#define QUATERNION_SOA_ALIGNMENT 64u
+
+/**
+ * @brief Number of doubles of caller storage needed for @p capacity quaternions.
+ *
+ * Each of the four lanes is padded to a multiple of eight doubles and seven extra doubles
+ * allow the first lane to be shifted onto a ::QUATERNION_SOA_ALIGNMENT boundary. Usable for
+ * static buffers: @code static double storage[QUATERNION_SOA_STORAGE_DOUBLES(1024)]; @endcode
+ */
+#define QUATERNION_SOA_STORAGE_DOUBLES(capacity) (4u * ((((size_t)(capacity)) + 7u) & ~(size_t)7u) + 7u)
+
+/**
+ * @brief Structure-of-arrays batch of quaternions.
+ *
+ * Element @c i is the quaternion @f$[w_i, x_i, y_i, z_i]@f$ in the same convention as the
+ * scalar @c double q[4] API. The library never allocates: lanes either point into storage
+ * prepared by quaternion_soa_init() or are wired up by the caller directly. Kernels accept
+ * unaligned lanes, but aligned lanes avoid split loads on most targets.
+ */
+typedef struct {
+    double *w;      ///< Scalar lane.
+    double *x;      ///< First vector lane.
+    double *y;      ///< Second vector lane.
+    double *z;      ///< Third vector lane.
+    size_t count;   ///< Number of valid elements in every lane.
+} QuaternionSoA;
+
+/**
+ * @brief Instruction-set backends available to the batch kernels.
+ */
+typedef enum {
+    QUATERNION_SOA_BACKEND_AUTO,    ///< Select the widest backend supported by the running CPU.
+    QUATERNION_SOA_BACKEND_SCALAR,  ///< Portable per-element loop over the scalar API.
+    QUATERNION_SOA_BACKEND_SSE2,    ///< 2 lanes, x86/x86-64.
+    QUATERNION_SOA_BACKEND_AVX2,    ///< 4 lanes, x86-64 with AVX2.
+    QUATERNION_SOA_BACKEND_AVX512,  ///< 8 lanes, x86-64 with AVX-512F.
+    QUATERNION_SOA_BACKEND_NEON     ///< 2 lanes, AArch64 Advanced SIMD.
+} QuaternionSoaBackend;
+
+/**
+ * @brief Carve four aligned lanes out of caller-provided storage.
+ *
+ * @param soa              Batch to initialise.
+ * @param storage          Backing buffer of at least QUATERNION_SOA_STORAGE_DOUBLES(@p count) doubles.
+ * @param storage_doubles  Size of @p storage in doubles.
+ * @param count            Number of quaternions the batch holds.
+ * @return 1 on success, 0 for null pointers or insufficient storage.
+ */
+int quaternion_soa_init(QuaternionSoA *soa, double *storage, size_t storage_doubles, size_t count);
+
+/**
+ * @brief Scatter an array of @c double[4] quaternions into a batch.
+ *
+ * @param soa    Destination batch; @c soa->count elements are written.
+ * @param q_aos  Source quaternions, @c 4 * soa->count doubles in @f$[w, x, y, z]@f$ order.
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_soa_from_aos(QuaternionSoA *soa, const double *q_aos);
+
+/**
+ * @brief Gather a batch back into an array of @c double[4] quaternions.
+ *
+ * @param soa    Source batch.
+ * @param q_aos  Destination, @c 4 * soa->count doubles.
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_soa_to_aos(const QuaternionSoA *soa, double *q_aos);
+
+/**
+ * @brief Element-wise Hamilton product @f$ out_i = a_i \otimes b_i @f$.
+ *
+ * Every element is bit-identical to quaternion_multiply(). @p out may be the same batch as
+ * @p a or @p b.
+ *
+ * @return 1 on success, 0 for null pointers or mismatched counts.
+ */
+int quaternion_soa_multiply(const QuaternionSoA *a, const QuaternionSoA *b, QuaternionSoA *out);
+
+/**
+ * @brief Normalise every element in place.
+ *
+ * Every element is bit-identical to quaternion_normalize(), including its small-norm guard.
+ *
+ * @return 1 on success, 0 for a null batch.
+ */
+int quaternion_soa_normalize(QuaternionSoA *q);
+
+/**
+ * @brief Element-wise quaternion inverse.
+ *
+ * Every invertible element is bit-identical to quaternion_inverse(). As with the scalar API,
+ * elements whose norm is too small leave the corresponding output element unchanged.
+ *
+ * @return 1 when every element was inverted, 0 for invalid arguments or any non-invertible element.
+ */
+int quaternion_soa_inverse(const QuaternionSoA *q, QuaternionSoA *out);
+
+/**
+ * @brief Rotate one vector per element, @f$ v_{out,i} = q_i \, v_{in,i} \, q_i^{*} @f$.
+ *
+ * Vectors are also stored as lanes: @c v_in[0][i], @c v_in[1][i], @c v_in[2][i] are the
+ * x, y, z components of vector @c i. Results are bit-identical to quaternion_rotate_vector().
+ * The output lanes may be the input lanes.
+ *
+ * @param q      Rotation batch.
+ * @param v_in   Three input lanes of @c q->count doubles.
+ * @param v_out  Three output lanes of @c q->count doubles.
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_soa_rotate(const QuaternionSoA *q, const double *const v_in[3], double *const v_out[3]);
+
+/**
+ * @brief Convert every element to a DCM stored as nine lanes.
+ *
+ * Lane @c dcm[3 * row + column] receives element @c [row][column] of the matrix produced by
+ * quaternion_to_dcm() for each quaternion, bit for bit.
+ *
+ * @param q    Source batch.
+ * @param dcm  Nine output lanes of @c q->count doubles in row-major order.
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_soa_to_dcm(const QuaternionSoA *q, double *const dcm[9]);
+
+/**
+ * @brief Convert DCMs stored as nine lanes into a batch of quaternions.
+ *
+ * The inverse of quaternion_soa_to_dcm(): every element is bit-identical to
+ * dcm_to_quaternion_unchecked() on the matrix @c dcm[3 * row + column][i] (unit, @c w >= 0).
+ * The vector backends evaluate Shepperd's four-way case split with lane masks instead of
+ * branches, so throughput does not depend on how the orientations are distributed. As with the
+ * scalar unchecked conversion the matrices must be rotations; builds with
+ * ATTITUDE_CHECK_TRUSTED_INPUTS run the validating scalar path instead.
+ *
+ * @param dcm  Nine input lanes of @c out->count doubles in row-major order.
+ * @param out  Destination batch; @c out->count elements are written.
+ * @return 1 on success, 0 for null pointers.
+ */
+int quaternion_soa_from_dcm(const double *const dcm[9], QuaternionSoA *out);
+
+/**
+ * @brief Select the backend used by the batch kernels.
+ *
+ * The default is ::QUATERNION_SOA_BACKEND_AUTO. Forcing a specific backend is mainly useful for
+ * tests and benchmarks. This setting is process-wide and is not synchronised; configure it
+ * before launching worker threads. Resolving the automatic default on first use is thread-safe.
+ *
+ * @return 1 on success, 0 if the backend is not compiled in or not supported by the CPU.
+ */
+int quaternion_soa_set_backend(QuaternionSoaBackend backend);
+
+/**
+ * @brief Report the backend the batch kernels currently dispatch to.
+ *
+ * Never returns ::QUATERNION_SOA_BACKEND_AUTO; the automatic choice is resolved first.
+ */
+QuaternionSoaBackend quaternion_soa_backend(void);
+
+/**
+ * @brief Human-readable backend name such as @c "avx2".
+ */
+const char *quaternion_soa_backend_name(QuaternionSoaBackend backend);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_QUATERNION_SOA_H
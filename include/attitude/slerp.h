@@ -0,0 +1,233 @@
+#ifndef ATTITUDE_SLERP_H
+#define ATTITUDE_SLERP_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file slerp.h
+ * @brief High-throughput SLERP: precomputed segments and a trig-free approximation.
+ *
+ * quaternion_slerp() recovers the angle between its endpoints with @c acos and then needs three
+ * @c sin calls for every @p t. A ::SlerpSegment does the endpoint work once: it stores the
+ * start quaternion @f$q_0@f$, the unit quaternion @f$q_\perp@f$ orthogonal to it in the plane
+ * of the two endpoints, and the angle @f$\theta@f$ between them, so that
+ * @f[ \mathrm{slerp}(t) = \cos(t\theta)\, q_0 + \sin(t\theta)\, q_\perp . @f]
+ * Evenly spaced samples then advance @f$(\cos, \sin)@f$ with a rotation recurrence, which is
+ * multiply-adds only.
+ *
+ * slerp_fast() and the shorter slerp_fast_coarse() instead drop the trigonometry altogether
+ * for callers that can accept a documented, bounded error.
+ *
+ * Like quaternion_slerp(), the segment takes the shorter arc (the end quaternion is negated
+ * when the endpoints are more than a half-turn apart in 4D). Unlike it, the endpoints need not
+ * be unit and small angles are handled exactly instead of by NLERP.
+ */
+
+/**
+ * @brief Precomputed SLERP between two orientations. Fill with slerp_segment_init().
+ */
+typedef struct {
+    double q_start[4];  ///< Normalised start quaternion, the value at @f$t = 0@f$.
+    double q_end[4];    ///< Normalised, sign-adjusted end quaternion, the value at @f$t = 1@f$.
+    double q_perp[4];   ///< Unit quaternion orthogonal to @c q_start towards @c q_end; zero if they coincide.
+    double theta;       ///< Half the rotation angle between the endpoints, in @f$[0, \pi/2]@f$.
+} SlerpSegment;
+
+/**
+ * @brief Single-precision segment storage, used by the @c slerpf_* functions.
+ */
+typedef struct {
+    float q_start[4];  ///< Normalised start quaternion, the value at @f$t = 0@f$.
+    float q_end[4];    ///< Normalised, sign-adjusted end quaternion, the value at @f$t = 1@f$.
+    float q_perp[4];   ///< Unit quaternion orthogonal to @c q_start towards @c q_end; zero if they coincide.
+    float theta;       ///< Half the rotation angle between the endpoints, in @f$[0, \pi/2]@f$.
+} SlerpSegmentf;
+
+/**
+ * @brief Precompute the SLERP from @p q1 to @p q2.
+ *
+ * The angle comes from @f$ 2\,\mathrm{atan2}(\|q_2 - q_1\|, \|q_2 + q_1\|) @f$, which unlike
+ * @c acos keeps full precision for nearly equal endpoints.
+ *
+ * @param segment  Segment to fill.
+ * @param q1       Start orientation (any non-zero norm).
+ * @param q2       End orientation (any non-zero norm).
+ * @return 1 on success, 0 for null pointers or zero/non-finite endpoints.
+ */
+int slerp_segment_init(SlerpSegment *segment, const double q1[4], const double q2[4]);
+
+/**
+ * @brief Evaluate a segment at one parameter value.
+ *
+ * One @c sin/@c cos pair, no @c acos or division. @p t outside @f$[0, 1]@f$ extrapolates along
+ * the same great circle.
+ *
+ * @param segment  Segment from slerp_segment_init().
+ * @param t        Interpolation parameter.
+ * @param q_out    Unit output quaternion.
+ */
+void slerp_segment_eval(const SlerpSegment *segment, double t, double q_out[4]);
+
+/**
+ * @brief Evaluate a segment at @p count arbitrary parameter values.
+ *
+ * @param segment  Segment from slerp_segment_init().
+ * @param t        @p count parameter values.
+ * @param count    Number of samples.
+ * @param q_out    @p count quaternions packed as @c [count][4].
+ * @return 1 on success, 0 for null pointers.
+ */
+int slerp_segment_eval_batch(const SlerpSegment *segment, const double *t, size_t count, double *q_out);
+
+/**
+ * @brief Evaluate a segment at @p count evenly spaced parameter values.
+ *
+ * Sample @c k is taken at @f$t = t_{start} + k\, t_{step}@f$. The angle is advanced by a
+ * rotation recurrence, so most samples cost eight multiply-adds and no trig; the recurrence is
+ * reseeded with an exact @c sin/@c cos every few dozen samples so rounding cannot accumulate
+ * with @p count.
+ *
+ * @param segment  Segment from slerp_segment_init().
+ * @param t_start  Parameter of the first sample.
+ * @param t_step   Parameter increment between samples (e.g. @c 1.0/20 to upsample 20x).
+ * @param count    Number of samples.
+ * @param q_out    @p count quaternions packed as @c [count][4].
+ * @return 1 on success, 0 for null pointers or non-finite @p t_start / @p t_step.
+ */
+int slerp_segment_sample(const SlerpSegment *segment,
+                         double t_start,
+                         double t_step,
+                         size_t count,
+                         double *q_out);
+
+/**
+ * @brief Upsample a keyframe sequence by an integer factor.
+ *
+ * Writes @p factor evenly spaced samples from each keyframe towards the next, then the last
+ * keyframe, i.e. @f$(n - 1)\cdot factor + 1@f$ quaternions for @f$n@f$ keyframes. Each segment
+ * starts from the previous segment's sign-adjusted end, so the output never flips sign.
+ * Upsampling a 50 Hz log to 1 kHz is @c factor = 20.
+ *
+ * @param keys       @p key_count keyframes packed as @c [key_count][4].
+ * @param key_count  Number of keyframes.
+ * @param factor     Samples per keyframe interval (at least 1).
+ * @param q_out      Output buffer with room for @f$(key\_count - 1)\cdot factor + 1@f$ quaternions.
+ * @return 1 on success; 0 for null pointers, @p factor of 0, or a zero/non-finite keyframe, in
+ *         which case output after the offending keyframe is left unwritten.
+ */
+int slerp_upsample(const double *keys, size_t key_count, size_t factor, double *q_out);
+
+/**
+ * @brief Approximate SLERP without trigonometry (Eberly's polynomial form).
+ *
+ * Writes @f$ \mathrm{slerp}(t) = f(1 - t)\, q_1 + f(t)\, q_2 @f$ with
+ * @f$ f(t) = \sin(t\theta) / \sin\theta @f$ replaced by a degree-8 polynomial in @f$t^2@f$ and
+ * @f$\cos\theta - 1@f$ (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP"), then
+ * pulls the result back to unit norm with one Newton step. Everything is multiply-adds, with
+ * no branches, @c acos, @c sin or square root, so the batch loop vectorises.
+ *
+ * Worst-case rotation-angle error against exact SLERP (slerp_segment_eval()) for @p t in
+ * @f$[0, 1]@f$, by the rotation between the endpoints: below @f$10^{-12}@f$ rad up to 45
+ * degrees, @f$10^{-8}@f$ rad up to 90 degrees, and @f$2\times10^{-5}@f$ rad at the 180-degree
+ * maximum. The output norm is within @f$2\times10^{-9}@f$ of one. quaternion_slerp() switches to
+ * normalised linear interpolation for endpoints within about 3.6 degrees, which is itself up to
+ * @f$10^{-6}@f$ rad off exact SLERP, so against quaternion_slerp() the error is up to about
+ * @f$10^{-6}@f$ rad below 90 degrees, with the same bound at 180 degrees.
+ *
+ * Unlike quaternion_slerp() this expects unit endpoints, and nearly equal endpoints are not
+ * special-cased (the polynomial is exact there).
+ *
+ * Batch throughput against quaternion_slerp() per pair (attitude_bench --filter slerp, 256
+ * unrelated pairs, one 2.1 GHz Xeon core):
+ *
+ * | Function                  | Default flags (SSE2) | @c -mavx2     |
+ * |---------------------------|----------------------|---------------|
+ * | quaternion_slerp()        | 51 ns                | 51 ns         |
+ * | slerp_fast_batch()        | 14.5 ns (3.5x)       | 9.2 ns (5.5x) |
+ * | slerp_fast_coarse_batch() | 13.2 ns (3.9x)       | 8.3 ns (6.1x) |
+ *
+ * Only the @c -mavx2 build is more than 5x faster than quaternion_slerp(); with the default
+ * flags the gain is 3.5x (3.9x coarse). The float variants run about twice as fast again.
+ *
+ * @param q1     Start orientation (unit).
+ * @param q2     End orientation (unit); negated internally if that gives the shorter arc.
+ * @param t      Interpolation parameter in @f$[0, 1]@f$.
+ * @param q_out  Interpolated quaternion.
+ */
+void slerp_fast(const double q1[4], const double q2[4], double t, double q_out[4]);
+
+/**
+ * @brief slerp_fast() over packed arrays of endpoint pairs.
+ *
+ * @param q1     @p count start quaternions packed as @c [count][4].
+ * @param q2     @p count end quaternions packed as @c [count][4].
+ * @param t      @p count interpolation parameters.
+ * @param count  Number of elements.
+ * @param q_out  @p count quaternions packed as @c [count][4].
+ * @return 1 on success, 0 for null pointers.
+ */
+int slerp_fast_batch(const double *q1, const double *q2, const double *t, size_t count, double *q_out);
+
+/**
+ * @brief slerp_fast() truncated to six terms, for callers that need about @f$10^{-4}@f$ rad.
+ *
+ * Worst-case rotation-angle error against exact SLERP: below @f$10^{-10}@f$ rad up to 45
+ * degrees, @f$4\times10^{-7}@f$ rad up to 90 degrees, and @f$8\times10^{-5}@f$ rad at the
+ * 180-degree maximum; against quaternion_slerp(), up to about @f$10^{-6}@f$ rad below 90 degrees
+ * as for slerp_fast(). The output norm is within @f$5\times10^{-8}@f$ of one. Arguments as
+ * slerp_fast().
+ */
+void slerp_fast_coarse(const double q1[4], const double q2[4], double t, double q_out[4]);
+
+/** @brief slerp_fast_coarse() over packed arrays; arguments as slerp_fast_batch(). */
+int slerp_fast_coarse_batch(const double *q1, const double *q2, const double *t, size_t count, double *q_out);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision SLERP API
+ *
+ * Float counterparts of the functions above, generated from the same source.
+ * @{
+ */
+/** @brief Single-precision variant of slerp_segment_init(). */
+int slerpf_segment_init(SlerpSegmentf *segment, const float q1[4], const float q2[4]);
+
+/** @brief Single-precision variant of slerp_segment_eval(). */
+void slerpf_segment_eval(const SlerpSegmentf *segment, float t, float q_out[4]);
+
+/** @brief Single-precision variant of slerp_segment_eval_batch(). */
+int slerpf_segment_eval_batch(const SlerpSegmentf *segment, const float *t, size_t count, float *q_out);
+
+/** @brief Single-precision variant of slerp_segment_sample(). */
+int slerpf_segment_sample(const SlerpSegmentf *segment,
+                          float t_start,
+                          float t_step,
+                          size_t count,
+                          float *q_out);
+
+/** @brief Single-precision variant of slerp_upsample(). */
+int slerpf_upsample(const float *keys, size_t key_count, size_t factor, float *q_out);
+
+/** @brief Single-precision variant of slerp_fast(); rounding dominates below 90 degrees. */
+void slerpf_fast(const float q1[4], const float q2[4], float t, float q_out[4]);
+
+/** @brief Single-precision variant of slerp_fast_batch(). */
+int slerpf_fast_batch(const float *q1, const float *q2, const float *t, size_t count, float *q_out);
+
+/** @brief Single-precision variant of slerp_fast_coarse(). */
+void slerpf_fast_coarse(const float q1[4], const float q2[4], float t, float q_out[4]);
+
+/** @brief Single-precision variant of slerp_fast_coarse_batch(). */
+int slerpf_fast_coarse_batch(const float *q1, const float *q2, const float *t, size_t count, float *q_out);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_SLERP_H
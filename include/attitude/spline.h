@@ -0,0 +1,198 @@
+#ifndef ATTITUDE_SPLINE_H
+#define ATTITUDE_SPLINE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file spline.h
+ * @brief Smooth quaternion trajectories through timestamped keyframes.
+ *
+ * Pairwise SLERP has an angular-velocity jump at every keyframe. A ::QuaternionSpline is built
+ * once from a keyframe array and then evaluated at arbitrary timestamps, returning the
+ * orientation and optionally the body angular velocity and acceleration:
+ * - ::QUATERNION_SPLINE_SQUAD: Shoemake's spherical quadrangle interpolation. Interpolates the
+ *   keyframes; angular velocity is continuous for evenly spaced keyframes.
+ * - ::QUATERNION_SPLINE_HERMITE: cumulative cubic Hermite curve (Kim, Kim and Shin).
+ *   Interpolates the keyframes with the given (or Catmull-Rom estimated) body rates at each
+ *   keyframe, so angular velocity is continuous for any spacing.
+ * - ::QUATERNION_SPLINE_BSPLINE: cumulative cubic B-spline (Kim, Kim and Shin). Uses the
+ *   keyframes as control points, so it smooths rather than interpolates them; angular
+ *   acceleration is continuous for evenly spaced keyframes.
+ *
+ * Every @c log between keyframes is taken when the spline is built and cached per segment, so
+ * evaluation is a few exponentials and Hamilton products. Derivatives are analytic, not
+ * finite differences. Rates follow the kinematics.h convention
+ * @f$ \dot q = \tfrac12\, q \otimes [0, \omega] @f$ (body frame, rad/s and rad/s@f$^2@f$).
+ *
+ * The library never allocates: the caller supplies
+ * QUATERNION_SPLINE_STORAGE_DOUBLES(key_count) doubles, which hold the cached coefficients
+ * and a copy of the timestamps.
+ */
+
+/** @brief Doubles (or floats) of cached coefficients per keyframe interval. */
+#define QUATERNION_SPLINE_SEGMENT_DOUBLES 16u
+
+/**
+ * @brief Storage needed for a spline over @p key_count keyframes, in elements of the spline's
+ * precision. Usable for static buffers.
+ */
+#define QUATERNION_SPLINE_STORAGE_DOUBLES(key_count) \
+    (QUATERNION_SPLINE_SEGMENT_DOUBLES * ((size_t)(key_count) - 1u) + (size_t)(key_count))
+
+/** @brief Spline families supported by quaternion_spline_init(). */
+typedef enum {
+    QUATERNION_SPLINE_SQUAD,    ///< Spherical quadrangle interpolation (interpolating, C1 for even spacing).
+    QUATERNION_SPLINE_HERMITE,  ///< Cumulative cubic Hermite (interpolating, C1).
+    QUATERNION_SPLINE_BSPLINE   ///< Cumulative cubic B-spline (approximating, C2 for even spacing).
+} QuaternionSplineType;
+
+/**
+ * @brief Spline built by quaternion_spline_init(); all data lives in caller storage.
+ */
+typedef struct {
+    QuaternionSplineType type;  ///< Spline family.
+    size_t key_count;           ///< Number of keyframes (at least 2).
+    double *segments;           ///< @c key_count - 1 blocks of ::QUATERNION_SPLINE_SEGMENT_DOUBLES.
+    double *times;              ///< Copy of the @c key_count keyframe timestamps.
+} QuaternionSpline;
+
+/**
+ * @brief Single-precision spline, used by the @c quaternionf_spline_* functions.
+ */
+typedef struct {
+    QuaternionSplineType type;  ///< Spline family.
+    size_t key_count;           ///< Number of keyframes (at least 2).
+    float *segments;            ///< @c key_count - 1 blocks of ::QUATERNION_SPLINE_SEGMENT_DOUBLES.
+    float *times;               ///< Copy of the @c key_count keyframe timestamps.
+} QuaternionSplinef;
+
+/**
+ * @brief Build a spline through (or, for the B-spline, near) a keyframe array.
+ *
+ * Keyframes need not be unit and may switch hemisphere; each is normalised and sign-aligned
+ * with its predecessor. ::QUATERNION_SPLINE_HERMITE estimates the body rate at every keyframe
+ * from its neighbours (Catmull-Rom); use quaternion_spline_init_hermite() to supply them.
+ *
+ * @param spline           Spline to initialise.
+ * @param type             Spline family.
+ * @param times            @p key_count strictly increasing timestamps (s).
+ * @param keys             @p key_count keyframes packed as @c [key_count][4].
+ * @param key_count        Number of keyframes, at least 2.
+ * @param storage          Backing buffer; the spline points into it until it is rebuilt.
+ * @param storage_doubles  Size of @p storage, at least QUATERNION_SPLINE_STORAGE_DOUBLES(@p key_count).
+ * @return 1 on success; 0 for null pointers, fewer than 2 keyframes, insufficient storage, an
+ *         unknown @p type, timestamps that are non-finite or not strictly increasing, or a
+ *         zero/non-finite keyframe.
+ */
+int quaternion_spline_init(QuaternionSpline *spline,
+                           QuaternionSplineType type,
+                           const double *times,
+                           const double *keys,
+                           size_t key_count,
+                           double *storage,
+                           size_t storage_doubles);
+
+/**
+ * @brief Build a ::QUATERNION_SPLINE_HERMITE spline with known body rates at the keyframes.
+ *
+ * Same as quaternion_spline_init() except that the curve leaves every keyframe with the body
+ * angular velocity given in @p omegas (e.g. gyro readings at the keyframe timestamps).
+ *
+ * @param omegas  @p key_count body rates packed as @c [key_count][3] (rad/s), or NULL to
+ *                estimate them from the keyframes.
+ * @return As quaternion_spline_init(); also 0 for a non-finite rate.
+ */
+int quaternion_spline_init_hermite(QuaternionSpline *spline,
+                                   const double *times,
+                                   const double *keys,
+                                   const double *omegas,
+                                   size_t key_count,
+                                   double *storage,
+                                   size_t storage_doubles);
+
+/**
+ * @brief Evaluate a spline at one timestamp.
+ *
+ * The keyframe interval is found by binary search. Timestamps outside the keyframe range are
+ * clamped to it.
+ *
+ * @param spline  Spline from quaternion_spline_init().
+ * @param t       Timestamp (s).
+ * @param q_out   Unit orientation.
+ * @param omega   Body angular velocity (rad/s), or NULL.
+ * @param alpha   Body angular acceleration (rad/s@f$^2@f$), or NULL.
+ * @return 1 on success, 0 for null @p spline / @p q_out or a NaN @p t.
+ */
+int quaternion_spline_eval(const QuaternionSpline *spline, double t, double q_out[4], double omega[3], double alpha[3]);
+
+/**
+ * @brief Evaluate a spline at @p count timestamps.
+ *
+ * When the timestamps are ascending (the usual case for a trajectory) the interval search
+ * resumes from the previous sample, so a whole pass costs O(count + key_count); other orders
+ * fall back to binary search per sample.
+ *
+ * @param spline   Spline from quaternion_spline_init().
+ * @param t        @p count timestamps (s).
+ * @param count    Number of samples.
+ * @param q_out    @p count orientations packed as @c [count][4].
+ * @param omega    @p count angular velocities packed as @c [count][3], or NULL.
+ * @param alpha    @p count angular accelerations packed as @c [count][3], or NULL.
+ * @return 1 on success; 0 for null pointers or any NaN timestamp (that sample is set to NaN,
+ *         the others are still written).
+ */
+int quaternion_spline_eval_batch(const QuaternionSpline *spline,
+                                 const double *t,
+                                 size_t count,
+                                 double *q_out,
+                                 double *omega,
+                                 double *alpha);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision spline API
+ *
+ * Float counterparts of the functions above, generated from the same source. Storage sizes
+ * are counted in floats.
+ * @{
+ */
+/** @brief Single-precision variant of quaternion_spline_init(). */
+int quaternionf_spline_init(QuaternionSplinef *spline,
+                            QuaternionSplineType type,
+                            const float *times,
+                            const float *keys,
+                            size_t key_count,
+                            float *storage,
+                            size_t storage_floats);
+
+/** @brief Single-precision variant of quaternion_spline_init_hermite(). */
+int quaternionf_spline_init_hermite(QuaternionSplinef *spline,
+                                    const float *times,
+                                    const float *keys,
+                                    const float *omegas,
+                                    size_t key_count,
+                                    float *storage,
+                                    size_t storage_floats);
+
+/** @brief Single-precision variant of quaternion_spline_eval(). */
+int quaternionf_spline_eval(const QuaternionSplinef *spline, float t, float q_out[4], float omega[3], float alpha[3]);
+
+/** @brief Single-precision variant of quaternion_spline_eval_batch(). */
+int quaternionf_spline_eval_batch(const QuaternionSplinef *spline,
+                                  const float *t,
+                                  size_t count,
+                                  float *q_out,
+                                  float *omega,
+                                  float *alpha);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_SPLINE_H
@@ -14,14 +14,26 @@ enum AttitudeValidationFailure {
     ATTITUDE_VALIDATION_QUATERNION_DCM = 1u << 3,
     ATTITUDE_VALIDATION_DCM_TO_QUATERNION = 1u << 4,
     ATTITUDE_VALIDATION_DCM_TO_EULER = 1u << 5,
-    ATTITUDE_VALIDATION_INVALID_INPUT = 1u << 6
+    ATTITUDE_VALIDATION_INVALID_INPUT = 1u << 6,
+    ATTITUDE_VALIDATION_FIXED_POINT = 1u << 7
 };
 
+/**
+ * @brief Bit reported when @p stage fails in the single-precision fixture.
+ *
+ * The float API runs the same cases with float tolerances; its failures are the
+ * AttitudeValidationFailure bits shifted into the second byte of the mask.
+ */
+#define ATTITUDE_VALIDATION_SINGLE_PRECISION(stage) ((uint32_t)(stage) << 8)
+
 /**
  * @brief Run deterministic attitude conversion fixtures.
  *
  * The fixture has no heap, file, clock, or operating-system dependencies, so the
- * same code can run in host CI and on embedded targets.
+ * same code can run in host CI and on embedded targets. Both the double and the
+ * single-precision (@c quaternionf_*, @c dcmf_*, @c eulerf_*) APIs are exercised, and the
+ * Q1.30 integer API of fixed_point.h is compared against the double one
+ * (::ATTITUDE_VALIDATION_FIXED_POINT).
  *
  * @return Zero on success or a bitwise OR of AttitudeValidationFailure values.
  */
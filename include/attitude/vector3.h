@@ -1,6 +1,8 @@
 #ifndef ATTITUDE_VECTOR3_H
 #define ATTITUDE_VECTOR3_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,8 +50,102 @@ void vector3_cross(const double a[3], const double b[3], double out[3]);
  */
 void vector3_normalize(double v[3]);
 
+/**
+ * @brief Compute the Euclidean length of a vector.
+ *
+ * @param v Input vector.
+ * @return @f$\|v\|@f$.
+ */
+double vector3_mag(const double v[3]);
+
+/**
+ * @brief Normalise a 3D vector in-place, reporting degenerate input.
+ *
+ * @param v Vector to normalise.
+ * @return 1 on success, 0 when the magnitude is too small (the vector is left unchanged).
+ */
+int vector3_normalize_safe(double v[3]);
+
+/**
+ * @brief Pull a nearly unit vector back to unit length in place, cheaply.
+ *
+ * Meant to be called every step on vectors that should stay unit (a propagated gravity or
+ * magnetic-field direction, a body axis) and so only drift by rounding. When the squared norm
+ * is within about 4e-6 of one the inverse length comes from a short series, with no square
+ * root or division; otherwise the exact @f$1/\|v\|@f$ is used. Either way the result is unit
+ * to rounding, so repeated calls do not let drift accumulate.
+ *
+ * @param v Vector to renormalise.
+ * @return 1 on success; 0 (vector unchanged) for a null pointer, the zero vector, or a
+ *         non-finite (or overflowing) norm.
+ */
+int vector3_renormalize(double v[3]);
+
+/**
+ * @brief vector3_renormalize() on @p count vectors packed as @c [count][3], in place.
+ *
+ * @return 1 if every vector was renormalised; 0 for a null pointer with @p count > 0, or if
+ *         any vector was rejected (it is left unchanged and the rest are still processed).
+ */
+int vector3_renormalize_batch(double *v, size_t count);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision vector API
+ *
+ * Float counterparts of the functions above, generated from the same source.
+ * @{
+ */
+/** @brief Single-precision variant of vector3_add(). */
+void vector3f_add(const float a[3], const float b[3], float out[3]);
+
+/** @brief Single-precision variant of vector3_sub(). */
+void vector3f_sub(const float a[3], const float b[3], float out[3]);
+
+/** @brief Single-precision variant of vector3_dot(). */
+float vector3f_dot(const float a[3], const float b[3]);
+
+/** @brief Single-precision variant of vector3_cross(). */
+void vector3f_cross(const float a[3], const float b[3], float out[3]);
+
+/** @brief Single-precision variant of vector3_normalize(). */
+void vector3f_normalize(float v[3]);
+
+/** @brief Single-precision variant of vector3_mag(). */
+float vector3f_mag(const float v[3]);
+
+/** @brief Single-precision variant of vector3_normalize_safe(). */
+int vector3f_normalize_safe(float v[3]);
+
+/** @brief Single-precision variant of vector3_renormalize(); the series covers squared norms within about 4e-3 of one. */
+int vector3f_renormalize(float v[3]);
+
+/** @brief Single-precision variant of vector3_renormalize_batch(). */
+int vector3f_renormalize_batch(float *v, size_t count);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
 
+/*
+ * Opt-in header-only hot path: with ATTITUDE_INLINE defined before this header, calls to
+ * vector3_add/sub/dot/cross/mag() and their float variants expand to the static inline
+ * bodies in vector3_inline.h. See quaternion.h.
+ */
+#ifdef ATTITUDE_INLINE
+#include "attitude/vector3_inline.h"
+#define vector3_add(a, b, out) vector3_add_inline((a), (b), (out))
+#define vector3_sub(a, b, out) vector3_sub_inline((a), (b), (out))
+#define vector3_dot(a, b) vector3_dot_inline((a), (b))
+#define vector3_cross(a, b, out) vector3_cross_inline((a), (b), (out))
+#define vector3_mag(v) vector3_mag_inline((v))
+#define vector3f_add(a, b, out) vector3f_add_inline((a), (b), (out))
+#define vector3f_sub(a, b, out) vector3f_sub_inline((a), (b), (out))
+#define vector3f_dot(a, b) vector3f_dot_inline((a), (b))
+#define vector3f_cross(a, b, out) vector3f_cross_inline((a), (b), (out))
+#define vector3f_mag(v) vector3f_mag_inline((v))
+#endif
+
 #endif // ATTITUDE_VECTOR3_H
@@ -0,0 +1,95 @@
+#ifndef ATTITUDE_VECTOR3_INLINE_H
+#define ATTITUDE_VECTOR3_INLINE_H
+
+/**
+ * @file vector3_inline.h
+ * @brief Header-only definitions of the small vector kernels.
+ *
+ * The bodies of vector3_add(), vector3_sub(), vector3_dot(), vector3_cross() and vector3_mag()
+ * (and their float variants), which the library is built from. Use them directly, or define
+ * @c ATTITUDE_INLINE before including vector3.h; see quaternion_inline.h for the rationale and
+ * the FMA caveat.
+ */
+
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Inline body of vector3_add(). */
+static inline void vector3_add_inline(const double a[3], const double b[3], double out[3]) {
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+}
+
+/** @brief Inline body of vector3_sub(). */
+static inline void vector3_sub_inline(const double a[3], const double b[3], double out[3]) {
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+/** @brief Inline body of vector3_dot(). */
+static inline double vector3_dot_inline(const double a[3], const double b[3]) {
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+/** @brief Inline body of vector3_cross(). @p out must not alias @p a or @p b. */
+static inline void vector3_cross_inline(const double a[3], const double b[3], double out[3]) {
+    out[0] = a[1]*b[2] - a[2]*b[1];
+    out[1] = a[2]*b[0] - a[0]*b[2];
+    out[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+/** @brief Inline body of vector3_mag(). */
+static inline double vector3_mag_inline(const double v[3]) {
+    return sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision inline kernels
+ *
+ * Float counterparts of the functions above; the bodies of the @c vector3f_* functions.
+ * @{
+ */
+/** @brief Inline body of vector3f_add(). */
+static inline void vector3f_add_inline(const float a[3], const float b[3], float out[3]) {
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+}
+
+/** @brief Inline body of vector3f_sub(). */
+static inline void vector3f_sub_inline(const float a[3], const float b[3], float out[3]) {
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+/** @brief Inline body of vector3f_dot(). */
+static inline float vector3f_dot_inline(const float a[3], const float b[3]) {
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+/** @brief Inline body of vector3f_cross(). */
+static inline void vector3f_cross_inline(const float a[3], const float b[3], float out[3]) {
+    out[0] = a[1]*b[2] - a[2]*b[1];
+    out[1] = a[2]*b[0] - a[0]*b[2];
+    out[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+/** @brief Inline body of vector3f_mag(). */
+static inline float vector3f_mag_inline(const float v[3]) {
+    return sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_VECTOR3_INLINE_H
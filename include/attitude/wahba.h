@@ -0,0 +1,145 @@
+#ifndef ATTITUDE_WAHBA_H
+#define ATTITUDE_WAHBA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file wahba.h
+ * @brief Attitude determination from weighted vector observations (Wahba's problem).
+ *
+ * Given @f$n@f$ directions measured in the body frame, @f$b_i@f$ (star-tracker unit vectors,
+ * normalised magnetometer or accelerometer readings), the same directions known in a
+ * reference frame, @f$r_i@f$ (catalogue stars, a field model, gravity), and weights
+ * @f$a_i@f$, every solver here returns the unit quaternion @f$q@f$ minimising
+ * @f[ L(q) = \tfrac12 \sum_i a_i \left\| b_i - R(q)\, r_i \right\|^2 , @f]
+ * with @f$R(q)@f$ the matrix of quaternion_to_dcm(). In other words
+ * quaternion_rotate_vector(q, r_i) reproduces @f$b_i@f$ as closely as the data allow. The
+ * result is in the library's @c [w, x, y, z] order with @c w >= 0, like dcm_to_quaternion().
+ *
+ * All four solvers reduce the observations to the attitude profile matrix
+ * @f$B = \sum_i a_i b_i r_i^T@f$ (one pass over the data, so cost grows only by a few
+ * multiply-adds per vector) and then differ in how they extract the optimum:
+ * - wahba_quest(): Shuster's QUEST. Newton iteration on Davenport's characteristic
+ *   polynomial for the largest eigenvalue, then the eigenvector in closed form.
+ * - wahba_esoq2(): Mortari's ESOQ2. Same eigenvalue, then the rotation axis as the null
+ *   vector of a 3x3 matrix. Usually the fastest.
+ * - wahba_davenport(): Davenport's q-method. Full Jacobi eigendecomposition of the 4x4
+ *   @f$K@f$ matrix; no polynomial, robust reference.
+ * - wahba_svd(): Markley's SVD method on @f$B@f$ via one-sided Jacobi; robust reference.
+ *
+ * QUEST and ESOQ2 lose precision as the rotation approaches 180 degrees; both detect this and
+ * re-solve in a reference frame rotated by 180 degrees about a coordinate axis (Shuster's
+ * method of sequential rotations), so every solver is accurate for any attitude.
+ *
+ * The optional covariance is that of the small body-frame rotation error
+ * @f$\delta\theta@f$ (with @f$R_{true} = \exp([\delta\theta]_\times) R(q)@f$), computed as
+ * @f$ P = \left(\sum_i a_i (I - \hat b_i \hat b_i^T)\right)^{-1} @f$ with
+ * @f$\hat b_i = R(q) r_i@f$. It is in rad@f$^2@f$ when the weights are inverse measurement
+ * variances, @f$a_i = 1/\sigma_i^2@f$ with @f$\sigma_i@f$ in radians; for relative weights
+ * scale it by the actual variance.
+ */
+
+/**
+ * @brief Solve Wahba's problem with QUEST.
+ *
+ * @param observed    @p count body-frame directions packed as @c [count][3]. Need not be
+ *                    unit; each is normalised.
+ * @param reference   @p count reference-frame directions packed as @c [count][3]. Need not
+ *                    be unit; each is normalised.
+ * @param weights     @p count positive weights, or NULL for equal weights of 1.
+ * @param count       Number of vector pairs, at least 2.
+ * @param q_out       Optimal attitude, @c w >= 0.
+ * @param covariance  Covariance of the body-frame attitude error, or NULL.
+ * @return 1 on success; 0 (outputs unwritten) for null pointers, fewer than 2 pairs, a
+ *         zero-length or non-finite vector, a non-positive or non-finite weight, or
+ *         observations that do not determine the attitude (all directions parallel).
+ */
+int wahba_quest(const double *observed,
+                const double *reference,
+                const double *weights,
+                size_t count,
+                double q_out[4],
+                double covariance[3][3]);
+
+/**
+ * @brief Solve Wahba's problem with ESOQ2. Arguments and result as wahba_quest().
+ */
+int wahba_esoq2(const double *observed,
+                const double *reference,
+                const double *weights,
+                size_t count,
+                double q_out[4],
+                double covariance[3][3]);
+
+/**
+ * @brief Solve Wahba's problem with Davenport's q-method. Arguments and result as wahba_quest().
+ */
+int wahba_davenport(const double *observed,
+                    const double *reference,
+                    const double *weights,
+                    size_t count,
+                    double q_out[4],
+                    double covariance[3][3]);
+
+/**
+ * @brief Solve Wahba's problem by singular value decomposition. Arguments and result as
+ * wahba_quest().
+ */
+int wahba_svd(const double *observed,
+              const double *reference,
+              const double *weights,
+              size_t count,
+              double q_out[4],
+              double covariance[3][3]);
+
+/* ---- Single-precision API ------------------------------------------------ */
+
+/**
+ * @name Single-precision Wahba API
+ *
+ * Float counterparts of the functions above, generated from the same source. Expect
+ * attitude errors of a few float ulps times the condition of the observation geometry.
+ * @{
+ */
+/** @brief Single-precision variant of wahba_quest(). */
+int wahbaf_quest(const float *observed,
+                 const float *reference,
+                 const float *weights,
+                 size_t count,
+                 float q_out[4],
+                 float covariance[3][3]);
+
+/** @brief Single-precision variant of wahba_esoq2(). */
+int wahbaf_esoq2(const float *observed,
+                 const float *reference,
+                 const float *weights,
+                 size_t count,
+                 float q_out[4],
+                 float covariance[3][3]);
+
+/** @brief Single-precision variant of wahba_davenport(). */
+int wahbaf_davenport(const float *observed,
+                     const float *reference,
+                     const float *weights,
+                     size_t count,
+                     float q_out[4],
+                     float covariance[3][3]);
+
+/** @brief Single-precision variant of wahba_svd(). */
+int wahbaf_svd(const float *observed,
+               const float *reference,
+               const float *weights,
+               size_t count,
+               float q_out[4],
+               float covariance[3][3]);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATTITUDE_WAHBA_H
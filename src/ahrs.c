@@ -0,0 +1,7 @@
+#include "attitude/ahrs.h"
+#include "attitude/quaternion_inline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "ahrs_impl.inc"
@@ -0,0 +1,8 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/ahrs.h"
+#include "attitude/quaternion_inline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "ahrs_impl.inc"
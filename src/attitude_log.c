@@ -0,0 +1,349 @@
+#if defined(ATTITUDE_HAVE_MMAP) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "attitude/attitude_log.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ATTITUDE_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const unsigned char k_file_magic[8] = {'A', 'T', 'T', 'I', 'T', 'L', 'O', 'G'};
+static const unsigned char k_block_magic[4] = {'A', 'B', 'L', 'K'};
+
+/* ---- Little-endian encoding --------------------------------------------- */
+
+/*
+ * Header fields go byte by byte, which is endian-independent. Record values are copied whole
+ * and byte-swapped only on big-endian hosts.
+ */
+
+static void store_u16(unsigned char *p, uint16_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+}
+
+static void store_u32(unsigned char *p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = (unsigned char)(v >> (8 * i));
+    }
+}
+
+static int host_is_little_endian(void) {
+    const uint16_t one = 1;
+    unsigned char first;
+    memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+/* Record values are the hot path; the endianness test folds to a constant. */
+static void store_f64(unsigned char *p, double value) {
+    uint64_t v;
+    memcpy(&v, &value, sizeof(v));
+    if (!host_is_little_endian()) {
+        uint64_t swapped = 0;
+        for (int i = 0; i < 8; ++i) {
+            swapped = (swapped << 8) | ((v >> (8 * i)) & 0xffu);
+        }
+        v = swapped;
+    }
+    memcpy(p, &v, sizeof(v));
+}
+
+static uint16_t load_u16(const unsigned char *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t load_u32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ---- Writer --------------------------------------------------------------- */
+
+/*
+ * The caller's buffer holds the block by column (timestamps, then quaternions, then rates),
+ * each column sized for a full block, so a flush is one sink call per column and nothing is
+ * moved.
+ */
+
+static unsigned char *quaternion_column(const AttitudeLogWriter *w) {
+    return w->buffer + 8 * w->capacity;
+}
+
+static unsigned char *rate_column(const AttitudeLogWriter *w) {
+    return w->buffer + 40 * w->capacity;
+}
+
+static int emit(AttitudeLogWriter *w, const void *data, size_t size) {
+    if (!w->error && !w->sink(w->context, data, size)) {
+        w->error = 1;
+    }
+    return !w->error;
+}
+
+int attitude_log_writer_init(AttitudeLogWriter *writer,
+                             uint32_t flags,
+                             void *buffer,
+                             size_t buffer_bytes,
+                             AttitudeLogSink sink,
+                             void *context) {
+    if (writer == NULL || buffer == NULL || sink == NULL || (flags & ~ATTITUDE_LOG_HAS_RATE) != 0) {
+        return 0;
+    }
+    const size_t capacity = buffer_bytes / ATTITUDE_LOG_RECORD_BYTES(flags);
+    if (capacity == 0) {
+        return 0;
+    }
+    /* The block header stores the count in 32 bits. */
+    writer->capacity = capacity > UINT32_MAX ? UINT32_MAX : capacity;
+    writer->sink = sink;
+    writer->context = context;
+    writer->buffer = (unsigned char *)buffer;
+    writer->count = 0;
+    writer->written = 0;
+    writer->flags = flags;
+    writer->error = 0;
+    writer->file = NULL;
+
+    unsigned char header[ATTITUDE_LOG_HEADER_BYTES] = {0};
+    memcpy(header, k_file_magic, sizeof(k_file_magic));
+    store_u16(header + 8, ATTITUDE_LOG_VERSION);
+    store_u16(header + 10, ATTITUDE_LOG_HEADER_BYTES);
+    store_u32(header + 12, flags);
+    return emit(writer, header, sizeof(header));
+}
+
+static int file_sink(void *context, const void *data, size_t size) {
+    return fwrite(data, 1, size, (FILE *)context) == size;
+}
+
+int attitude_log_writer_open_file(AttitudeLogWriter *writer,
+                                  const char *path,
+                                  uint32_t flags,
+                                  void *buffer,
+                                  size_t buffer_bytes) {
+    if (writer == NULL || path == NULL) {
+        return 0;
+    }
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return 0;
+    }
+    if (!attitude_log_writer_init(writer, flags, buffer, buffer_bytes, file_sink, file)) {
+        fclose(file);
+        writer->file = NULL;
+        return 0;
+    }
+    writer->file = file;
+    return 1;
+}
+
+int attitude_log_writer_append(AttitudeLogWriter *writer, double timestamp, const double q[4], const double rate[3]) {
+    if (writer == NULL || q == NULL || writer->error) {
+        return 0;
+    }
+    const int has_rate = (writer->flags & ATTITUDE_LOG_HAS_RATE) != 0;
+    if (has_rate && rate == NULL) {
+        return 0;
+    }
+    const size_t n = writer->count;
+    store_f64(writer->buffer + 8 * n, timestamp);
+    unsigned char *qp = quaternion_column(writer) + 32 * n;
+    for (int i = 0; i < 4; ++i) {
+        store_f64(qp + 8 * i, q[i]);
+    }
+    if (has_rate) {
+        unsigned char *rp = rate_column(writer) + 24 * n;
+        for (int i = 0; i < 3; ++i) {
+            store_f64(rp + 8 * i, rate[i]);
+        }
+    }
+    writer->count = n + 1;
+    return writer->count < writer->capacity || attitude_log_writer_flush(writer);
+}
+
+int attitude_log_writer_flush(AttitudeLogWriter *writer) {
+    if (writer == NULL) {
+        return 0;
+    }
+    const size_t n = writer->count;
+    if (n == 0 || writer->error) {
+        return !writer->error;
+    }
+    unsigned char header[ATTITUDE_LOG_BLOCK_HEADER_BYTES] = {0};
+    memcpy(header, k_block_magic, sizeof(k_block_magic));
+    store_u32(header + 4, (uint32_t)n);
+    emit(writer, header, sizeof(header));
+    emit(writer, writer->buffer, 8 * n);
+    emit(writer, quaternion_column(writer), 32 * n);
+    if (writer->flags & ATTITUDE_LOG_HAS_RATE) {
+        emit(writer, rate_column(writer), 24 * n);
+    }
+    if (writer->error) {
+        return 0;
+    }
+    writer->written += n;
+    writer->count = 0;
+    return 1;
+}
+
+int attitude_log_writer_close(AttitudeLogWriter *writer) {
+    if (writer == NULL) {
+        return 0;
+    }
+    int ok = attitude_log_writer_flush(writer);
+    if (writer->file != NULL) {
+        ok = (fclose((FILE *)writer->file) == 0) && ok;
+        writer->file = NULL;
+    }
+    return ok;
+}
+
+/* ---- Reader --------------------------------------------------------------- */
+
+int attitude_log_reader_open_memory(AttitudeLogReader *reader, const void *data, size_t size) {
+    if (reader == NULL || data == NULL || ((uintptr_t)data % sizeof(double)) != 0 || !host_is_little_endian() ||
+        size < ATTITUDE_LOG_HEADER_BYTES) {
+        return 0;
+    }
+    const unsigned char *bytes = (const unsigned char *)data;
+    const uint16_t version = load_u16(bytes + 8);
+    const uint16_t header_bytes = load_u16(bytes + 10);
+    const uint32_t flags = load_u32(bytes + 12);
+    /* Later versions may grow the header, but only in whole doubles so the columns stay aligned. */
+    if (memcmp(bytes, k_file_magic, sizeof(k_file_magic)) != 0 || version == 0 || version > ATTITUDE_LOG_VERSION ||
+        header_bytes < ATTITUDE_LOG_HEADER_BYTES || header_bytes % sizeof(double) != 0 || header_bytes > size ||
+        (flags & ~ATTITUDE_LOG_HAS_RATE) != 0) {
+        return 0;
+    }
+    reader->data = bytes;
+    reader->size = size;
+    reader->offset = header_bytes;
+    reader->header_bytes = header_bytes;
+    reader->flags = flags;
+    reader->version = version;
+    reader->damaged = 0;
+    reader->mapping = NULL;
+    return 1;
+}
+
+int attitude_log_reader_open_file(AttitudeLogReader *reader, const char *path) {
+#ifdef ATTITUDE_HAVE_MMAP
+    if (reader == NULL || path == NULL) {
+        return 0;
+    }
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)ATTITUDE_LOG_HEADER_BYTES) {
+        close(fd);
+        return 0;
+    }
+    const size_t size = (size_t)st.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return 0;
+    }
+    /* Logs are read front to back; let the kernel read ahead aggressively. */
+    posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+    if (!attitude_log_reader_open_memory(reader, mapping, size)) {
+        munmap(mapping, size);
+        return 0;
+    }
+    reader->mapping = mapping;
+    return 1;
+#else
+    (void)reader;
+    (void)path;
+    return 0;
+#endif
+}
+
+void attitude_log_reader_close(AttitudeLogReader *reader) {
+    if (reader == NULL) {
+        return;
+    }
+#ifdef ATTITUDE_HAVE_MMAP
+    if (reader->mapping != NULL) {
+        munmap(reader->mapping, reader->size);
+    }
+#endif
+    memset(reader, 0, sizeof(*reader));
+}
+
+/*
+ * Validates the block at @p offset (which must be before the end of the data) and returns its
+ * record count through @p count; 0 when the block is truncated or its magic is wrong.
+ */
+static int block_at(const AttitudeLogReader *reader, size_t offset, size_t *count) {
+    const size_t remaining = reader->size - offset;
+    if (remaining < ATTITUDE_LOG_BLOCK_HEADER_BYTES ||
+        memcmp(reader->data + offset, k_block_magic, sizeof(k_block_magic)) != 0) {
+        return 0;
+    }
+    const size_t n = load_u32(reader->data + offset + 4);
+    if (n > (remaining - ATTITUDE_LOG_BLOCK_HEADER_BYTES) / ATTITUDE_LOG_RECORD_BYTES(reader->flags)) {
+        return 0;
+    }
+    *count = n;
+    return 1;
+}
+
+static size_t block_bytes(const AttitudeLogReader *reader, size_t count) {
+    return ATTITUDE_LOG_BLOCK_HEADER_BYTES + count * ATTITUDE_LOG_RECORD_BYTES(reader->flags);
+}
+
+int attitude_log_reader_next(AttitudeLogReader *reader, AttitudeLogBlock *block) {
+    if (reader == NULL || block == NULL || reader->data == NULL) {
+        return 0;
+    }
+    size_t n = 0;
+    while (n == 0) {
+        if (reader->offset >= reader->size || reader->damaged) {
+            return 0;
+        }
+        if (!block_at(reader, reader->offset, &n)) {
+            reader->damaged = 1;
+            return 0;
+        }
+        const double *columns = (const double *)(const void *)(reader->data + reader->offset +
+                                                               ATTITUDE_LOG_BLOCK_HEADER_BYTES);
+        block->count = n;
+        block->timestamps = columns;
+        block->quaternions = columns + n;
+        block->rates = (reader->flags & ATTITUDE_LOG_HAS_RATE) ? columns + 5 * n : NULL;
+        reader->offset += block_bytes(reader, n);
+    }
+    return 1;
+}
+
+void attitude_log_reader_rewind(AttitudeLogReader *reader) {
+    if (reader != NULL) {
+        reader->offset = reader->header_bytes;
+        reader->damaged = 0;
+    }
+}
+
+uint64_t attitude_log_reader_count(const AttitudeLogReader *reader) {
+    if (reader == NULL || reader->data == NULL) {
+        return 0;
+    }
+    uint64_t total = 0;
+    size_t offset = reader->header_bytes;
+    size_t n;
+    while (offset < reader->size && block_at(reader, offset, &n)) {
+        total += n;
+        offset += block_bytes(reader, n);
+    }
+    return total;
+}
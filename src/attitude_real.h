@@ -0,0 +1,104 @@
+#ifndef ATTITUDE_REAL_H
+#define ATTITUDE_REAL_H
+
+/*
+ * Scalar-type selection for the precision-generic sources (*_impl.inc).
+ *
+ * A translation unit defines ATTITUDE_REAL_FLOAT before including this header to instantiate
+ * the single-precision API; otherwise the double-precision API is produced. <tgmath.h> routes
+ * sqrt/sin/atan2/... to the float or double libm entry points from the argument type, and
+ * REAL() suffixes literals so float builds never promote to double (which would fall back to
+ * soft-float on single-precision FPUs such as the Cortex-M4F).
+ */
+
+#include <float.h>
+#include <tgmath.h>
+
+/* ATTITUDE_INLINE turns the public names into macros, which would rename the definitions here. */
+#ifdef ATTITUDE_INLINE
+#error "ATTITUDE_INLINE is for code using the library; build the library itself without it"
+#endif
+
+#include "attitude/attitude_utils.h"
+#include "attitude/dcm.h"
+
+#ifdef ATTITUDE_REAL_FLOAT
+
+typedef float real_t;
+#define REAL(literal) literal##f
+
+#define QUAT_FN(name) quaternionf_##name
+#define AXIS_ANGLE_FN(name) axis_anglef_##name
+#define ROTVEC_FN(name) rotvecf_##name
+#define DCM_FN(name) dcmf_##name
+#define EULER_FN(name) eulerf_##name
+#define VEC3_FN(name) vector3f_##name
+#define KINEMATICS_FN(name) kinematicsf_##name
+#define SLERP_FN(name) slerpf_##name
+#define EULER_ANGLES_T EulerAnglesf
+#define SLERP_SEGMENT_T SlerpSegmentf
+#define QUATERNION_SPLINE_T QuaternionSplinef
+#define QUATERNION_AVERAGE_T QuaternionAveragef
+#define WAHBA_FN(name) wahbaf_##name
+#define AHRS_FN(name) ahrsf_##name
+#define MAHONY_FILTER_T MahonyFilterf
+#define MADGWICK_FILTER_T MadgwickFilterf
+#define MEKF_FN(name) mekff_##name
+#define MEKF_FILTER_T MekfFilterf
+#define REAL_FN(name) name##f
+
+/* Tolerances scaled to float's ~1.2e-7 machine epsilon. */
+#define REAL_ORTHONORMAL_TOL ATTITUDE_DCMF_ORTHONORMAL_TOL
+#define REAL_GIMBAL_TOL REAL(1e-6)
+#define REAL_FIXTURE_TOL REAL(1e-5)
+#define REAL_SERIES_LIMIT REAL(0.25)
+#define REAL_ATAN_SERIES_LIMIT REAL(1e-2)
+#define REAL_RENORM_LIMIT REAL(4e-3)
+#define REAL_EPSILON FLT_EPSILON
+
+#else
+
+typedef double real_t;
+#define REAL(literal) literal
+
+#define QUAT_FN(name) quaternion_##name
+#define AXIS_ANGLE_FN(name) axis_angle_##name
+#define ROTVEC_FN(name) rotvec_##name
+#define DCM_FN(name) dcm_##name
+#define EULER_FN(name) euler_##name
+#define VEC3_FN(name) vector3_##name
+#define KINEMATICS_FN(name) kinematics_##name
+#define SLERP_FN(name) slerp_##name
+#define EULER_ANGLES_T EulerAngles
+#define SLERP_SEGMENT_T SlerpSegment
+#define QUATERNION_SPLINE_T QuaternionSpline
+#define QUATERNION_AVERAGE_T QuaternionAverage
+#define WAHBA_FN(name) wahba_##name
+#define AHRS_FN(name) ahrs_##name
+#define MAHONY_FILTER_T MahonyFilter
+#define MADGWICK_FILTER_T MadgwickFilter
+#define MEKF_FN(name) mekf_##name
+#define MEKF_FILTER_T MekfFilter
+#define REAL_FN(name) name
+
+#define REAL_ORTHONORMAL_TOL ATTITUDE_DCM_ORTHONORMAL_TOL
+#define REAL_GIMBAL_TOL REAL(1e-12)
+#define REAL_FIXTURE_TOL REAL(1e-12)
+#define REAL_SERIES_LIMIT REAL(6e-3)
+#define REAL_ATAN_SERIES_LIMIT REAL(1e-4)
+#define REAL_RENORM_LIMIT REAL(4e-6)
+#define REAL_EPSILON DBL_EPSILON
+
+#endif
+
+/*
+ * REAL_SERIES_LIMIT bounds the squared half-angle below which the degree-8 Taylor series of
+ * cos(h) and sin(h)/h are exact to rounding (the first dropped term is below epsilon);
+ * REAL_ATAN_SERIES_LIMIT does the same for the slower-converging atan(x)/x series, and
+ * REAL_RENORM_LIMIT for the inverse square root of a squared norm near one.
+ * See rotation_series.h.
+ */
+
+#define REAL_PI ((real_t)ATTITUDE_PI)
+
+#endif // ATTITUDE_REAL_H
@@ -0,0 +1,7 @@
+#include "attitude/average.h"
+#include "attitude_real.h"
+#include "symmetric_eigen.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "average_impl.inc"
@@ -0,0 +1,8 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/average.h"
+#include "attitude_real.h"
+#include "symmetric_eigen.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "average_impl.inc"
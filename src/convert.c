@@ -0,0 +1,392 @@
+#if defined(ATTITUDE_HAVE_THREADS) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "attitude/convert.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#ifdef ATTITUDE_HAVE_THREADS
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+/* ---- Element kernels ---------------------------------------------------- */
+
+/*
+ * Every element goes through the checked scalar conversion; a rejected element gets NaN
+ * output (Euler angles keep the requested order) and reports 0.
+ */
+
+static void fill_nan(double *out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = NAN;
+    }
+}
+
+static void euler_nan(EulerAngles *e, EulerOrder order) {
+    e->roll = e->pitch = e->yaw = NAN;
+    e->order = order;
+}
+
+static int convert_element(const AttitudeConversion *c, size_t i) {
+    switch (c->kind) {
+    case ATTITUDE_CONVERT_QUATERNION_TO_DCM: {
+        const double *q = (const double *)c->src + 4 * i;
+        double (*dcm)[3] = ((double (*)[3][3])c->dst)[i];
+        const double n2 = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+        if (!(n2 > 0.0) || !isfinite(n2)) {
+            fill_nan(&dcm[0][0], 9);
+            return 0;
+        }
+        quaternion_to_dcm(q, dcm);
+        return 1;
+    }
+    case ATTITUDE_CONVERT_QUATERNION_TO_EULER: {
+        EulerAngles *e = (EulerAngles *)c->dst + i;
+        if (!euler_from_quaternion_checked((const double *)c->src + 4 * i, c->order, e)) {
+            euler_nan(e, c->order);
+            return 0;
+        }
+        return 1;
+    }
+    case ATTITUDE_CONVERT_DCM_TO_QUATERNION: {
+        double *q = (double *)c->dst + 4 * i;
+        if (!dcm_to_quaternion_checked(((const double (*)[3][3])c->src)[i], q)) {
+            fill_nan(q, 4);
+            return 0;
+        }
+        return 1;
+    }
+    case ATTITUDE_CONVERT_DCM_TO_EULER: {
+        EulerAngles *e = (EulerAngles *)c->dst + i;
+        if (!euler_from_dcm_checked(((const double (*)[3][3])c->src)[i], c->order, e)) {
+            euler_nan(e, c->order);
+            return 0;
+        }
+        return 1;
+    }
+    case ATTITUDE_CONVERT_EULER_TO_QUATERNION: {
+        double *q = (double *)c->dst + 4 * i;
+        if (!euler_to_quaternion_checked((const EulerAngles *)c->src + i, q)) {
+            fill_nan(q, 4);
+            return 0;
+        }
+        return 1;
+    }
+    case ATTITUDE_CONVERT_EULER_TO_DCM: {
+        double (*dcm)[3] = ((double (*)[3][3])c->dst)[i];
+        if (!euler_to_dcm_checked((const EulerAngles *)c->src + i, dcm)) {
+            fill_nan(&dcm[0][0], 9);
+            return 0;
+        }
+        return 1;
+    }
+    default:
+        return 0;
+    }
+}
+
+/*
+ * The kind switch in convert_element() is taken the same way for a whole chunk, so it
+ * predicts perfectly next to the checked conversion it selects.
+ */
+static int convert_range(const AttitudeConversion *c, size_t begin, size_t end) {
+    int all_converted = 1;
+    unsigned char *mask = c->failures;
+    // begin is a multiple of 8, so each mask byte is owned by exactly one chunk.
+    for (size_t base = begin; base < end; base += 8) {
+        const size_t stop = (end - base < 8) ? end : base + 8;
+        unsigned bits = 0;
+        for (size_t i = base; i < stop; ++i) {
+            if (!convert_element(c, i)) {
+                bits |= 1u << (i - base);
+            }
+        }
+        if (bits != 0) {
+            all_converted = 0;
+        }
+        if (mask != NULL) {
+            mask[base / 8] = (unsigned char)bits;
+        }
+    }
+    return all_converted;
+}
+
+/* ---- Chunking ----------------------------------------------------------- */
+
+static size_t element_bytes(AttitudeConversionKind kind, int destination) {
+    static const size_t quaternion = 4 * sizeof(double);
+    static const size_t dcm = 9 * sizeof(double);
+    static const size_t euler = sizeof(EulerAngles);
+    switch (kind) {
+    case ATTITUDE_CONVERT_QUATERNION_TO_DCM:
+        return destination ? dcm : quaternion;
+    case ATTITUDE_CONVERT_QUATERNION_TO_EULER:
+        return destination ? euler : quaternion;
+    case ATTITUDE_CONVERT_DCM_TO_QUATERNION:
+        return destination ? quaternion : dcm;
+    case ATTITUDE_CONVERT_DCM_TO_EULER:
+        return destination ? euler : dcm;
+    case ATTITUDE_CONVERT_EULER_TO_QUATERNION:
+        return destination ? quaternion : euler;
+    case ATTITUDE_CONVERT_EULER_TO_DCM:
+        return destination ? dcm : euler;
+    default:
+        return 0;
+    }
+}
+
+size_t attitude_convert_default_chunk(AttitudeConversionKind kind) {
+    const size_t bytes = element_bytes(kind, 0) + element_bytes(kind, 1);
+    if (bytes == 0) {
+        return 0;
+    }
+    const size_t chunk = (ATTITUDE_CONVERT_CHUNK_BYTES / bytes) / ATTITUDE_CONVERT_CHUNK_ALIGN * ATTITUDE_CONVERT_CHUNK_ALIGN;
+    return chunk > 0 ? chunk : ATTITUDE_CONVERT_CHUNK_ALIGN;
+}
+
+typedef struct {
+    const AttitudeConversion *conversion;
+    size_t chunk;
+} ConvertJob;
+
+static int convert_task(void *arg, size_t index) {
+    const ConvertJob *job = (const ConvertJob *)arg;
+    const size_t count = job->conversion->count;
+    const size_t begin = index * job->chunk;
+    const size_t end = (count - begin < job->chunk) ? count : begin + job->chunk;
+    return convert_range(job->conversion, begin, end);
+}
+
+static int run_serial(AttitudeTaskFn task, void *arg, size_t count) {
+    int all_accepted = 1;
+    for (size_t index = 0; index < count; ++index) {
+        all_accepted &= task(arg, index);
+    }
+    return all_accepted;
+}
+
+static int order_is_valid(EulerOrder order) {
+    return (int)order >= 0 && order < EULER_ORDER_COUNT;
+}
+
+int attitude_convert(const AttitudeConversion *conversion, const AttitudeExecutor *executor) {
+    if (conversion == NULL || (int)conversion->kind < 0 || conversion->kind >= ATTITUDE_CONVERT_KIND_COUNT) {
+        return 0;
+    }
+    if ((conversion->kind == ATTITUDE_CONVERT_QUATERNION_TO_EULER ||
+         conversion->kind == ATTITUDE_CONVERT_DCM_TO_EULER) && !order_is_valid(conversion->order)) {
+        return 0;
+    }
+    if (conversion->count == 0) {
+        return 1;
+    }
+    if (conversion->src == NULL || conversion->dst == NULL) {
+        return 0;
+    }
+
+    ConvertJob job = {conversion, conversion->chunk};
+    if (job.chunk == 0) {
+        job.chunk = attitude_convert_default_chunk(conversion->kind);
+    } else if (job.chunk >= conversion->count) {
+        // One task; also keeps the rounding below from wrapping for chunks near SIZE_MAX.
+        job.chunk = conversion->count;
+    } else if (job.chunk % ATTITUDE_CONVERT_CHUNK_ALIGN != 0) {
+        job.chunk += ATTITUDE_CONVERT_CHUNK_ALIGN - job.chunk % ATTITUDE_CONVERT_CHUNK_ALIGN;
+    }
+    const size_t tasks = (conversion->count - 1) / job.chunk + 1;
+
+    if (executor == NULL || executor->run == NULL || tasks == 1) {
+        return run_serial(convert_task, &job, tasks);
+    }
+    return executor->run(executor->context, convert_task, &job, tasks);
+}
+
+/* ---- Thread pool -------------------------------------------------------- */
+
+#ifdef ATTITUDE_HAVE_THREADS
+
+/*
+ * Workers sleep on work_ready until a new generation is posted, then claim task indices under
+ * the lock until none are left. Chunks are large, so one lock round trip per chunk is noise.
+ * The caller claims tasks the same way and then waits on work_done for stragglers.
+ */
+struct AttitudeThreadPool {
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    pthread_mutex_t run_lock;   // serialises attitude_convert() calls sharing the pool
+    pthread_t *workers;
+    unsigned worker_count;
+    unsigned long generation;
+    int shutdown;
+
+    AttitudeTaskFn task;
+    void *arg;
+    size_t task_count;
+    size_t next_task;
+    size_t finished;
+    int all_accepted;
+};
+
+/* Claim and run tasks of the current job until none are left; called with the lock held. */
+static void drain_tasks(AttitudeThreadPool *pool) {
+    while (pool->next_task < pool->task_count) {
+        const size_t index = pool->next_task++;
+        const AttitudeTaskFn task = pool->task;
+        void *arg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+        const int accepted = task(arg, index);
+        pthread_mutex_lock(&pool->lock);
+        pool->all_accepted &= accepted;
+        if (++pool->finished == pool->task_count) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+}
+
+static void *worker_main(void *arg) {
+    AttitudeThreadPool *pool = (AttitudeThreadPool *)arg;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+        seen = pool->generation;
+        drain_tasks(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static int pool_run(void *context, AttitudeTaskFn task, void *arg, size_t count) {
+    AttitudeThreadPool *pool = (AttitudeThreadPool *)context;
+    if (count == 0) {
+        return 1;
+    }
+    pthread_mutex_lock(&pool->run_lock);
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->arg = arg;
+    pool->task_count = count;
+    pool->next_task = 0;
+    pool->finished = 0;
+    pool->all_accepted = 1;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    drain_tasks(pool);
+    while (pool->finished < pool->task_count) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    const int all_accepted = pool->all_accepted;
+    pool->task_count = 0;
+    pool->next_task = 0;
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->run_lock);
+    return all_accepted;
+}
+
+static void stop_workers(AttitudeThreadPool *pool, unsigned started) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+    for (unsigned i = 0; i < started; ++i) {
+        pthread_join(pool->workers[i], NULL);
+    }
+}
+
+AttitudeThreadPool *attitude_thread_pool_create(unsigned threads) {
+    if (threads == 0) {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (unsigned)online : 1u;
+    }
+
+    AttitudeThreadPool *pool = (AttitudeThreadPool *)calloc(1, sizeof(*pool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->worker_count = threads - 1;
+    if (pool->worker_count > 0) {
+        pool->workers = (pthread_t *)calloc(pool->worker_count, sizeof(pthread_t));
+        if (pool->workers == NULL) {
+            free(pool);
+            return NULL;
+        }
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->run_lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    for (unsigned i = 0; i < pool->worker_count; ++i) {
+        if (pthread_create(&pool->workers[i], NULL, worker_main, pool) != 0) {
+            stop_workers(pool, i);
+            pool->worker_count = 0;
+            attitude_thread_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+void attitude_thread_pool_destroy(AttitudeThreadPool *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    stop_workers(pool, pool->worker_count);
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->run_lock);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+unsigned attitude_thread_pool_size(const AttitudeThreadPool *pool) {
+    return pool != NULL ? pool->worker_count + 1 : 0;
+}
+
+AttitudeExecutor attitude_thread_pool_executor(AttitudeThreadPool *pool) {
+    AttitudeExecutor executor = {NULL, NULL};
+    if (pool != NULL) {
+        executor.run = pool_run;
+        executor.context = pool;
+    }
+    return executor;
+}
+
+#else
+
+AttitudeThreadPool *attitude_thread_pool_create(unsigned threads) {
+    (void)threads;
+    return NULL;
+}
+
+void attitude_thread_pool_destroy(AttitudeThreadPool *pool) {
+    (void)pool;
+}
+
+unsigned attitude_thread_pool_size(const AttitudeThreadPool *pool) {
+    (void)pool;
+    return 0;
+}
+
+AttitudeExecutor attitude_thread_pool_executor(AttitudeThreadPool *pool) {
+    AttitudeExecutor executor = {NULL, NULL};
+    (void)pool;
+    return executor;
+}
+
+#endif
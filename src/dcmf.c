@@ -0,0 +1,7 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/dcm.h"
+#include "attitude/dcm_inline.h"
+#include "attitude_real.h"
+#include <stddef.h>
+
+#include "dcm_impl.inc"
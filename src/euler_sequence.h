@@ -0,0 +1,46 @@
+#ifndef ATTITUDE_EULER_SEQUENCE_H
+#define ATTITUDE_EULER_SEQUENCE_H
+
+/*
+ * Axis table for every EulerOrder, shared by the precision-generic Euler conversions.
+ *
+ * X(order, i, j, k, extrinsic) describes the rotation as the intrinsic product
+ * R = R_i(a) * R_j(b) * R_k(c) with axes 0/1/2 = x/y/z. Extrinsic orders are stored as the
+ * equivalent intrinsic sequence (extrinsic ABC == intrinsic CBA), with `extrinsic` recording
+ * that the proper-Euler angle fields are listed in the opposite direction. Proper-Euler
+ * sequences have i == k.
+ *
+ * Expanding the table inside a switch gives every order its own case with constant axes,
+ * so the inlined kernels fold to straight-line code for that sequence.
+ */
+
+#define EULER_SEQUENCES(X)                   \
+    X(EULER_XYZ, 0, 1, 2, 0)                 \
+    X(EULER_XZY, 0, 2, 1, 0)                 \
+    X(EULER_YXZ, 1, 0, 2, 0)                 \
+    X(EULER_YZX, 1, 2, 0, 0)                 \
+    X(EULER_ZXY, 2, 0, 1, 0)                 \
+    X(EULER_ZYX, 2, 1, 0, 0)                 \
+    X(EULER_XYX, 0, 1, 0, 0)                 \
+    X(EULER_XZX, 0, 2, 0, 0)                 \
+    X(EULER_YXY, 1, 0, 1, 0)                 \
+    X(EULER_YZY, 1, 2, 1, 0)                 \
+    X(EULER_ZXZ, 2, 0, 2, 0)                 \
+    X(EULER_ZYZ, 2, 1, 2, 0)                 \
+    X(EULER_EXTRINSIC_XYZ, 2, 1, 0, 1)       \
+    X(EULER_EXTRINSIC_XZY, 1, 2, 0, 1)       \
+    X(EULER_EXTRINSIC_YXZ, 2, 0, 1, 1)       \
+    X(EULER_EXTRINSIC_YZX, 0, 2, 1, 1)       \
+    X(EULER_EXTRINSIC_ZXY, 1, 0, 2, 1)       \
+    X(EULER_EXTRINSIC_ZYX, 0, 1, 2, 1)       \
+    X(EULER_EXTRINSIC_XYX, 0, 1, 0, 1)       \
+    X(EULER_EXTRINSIC_XZX, 0, 2, 0, 1)       \
+    X(EULER_EXTRINSIC_YXY, 1, 0, 1, 1)       \
+    X(EULER_EXTRINSIC_YZY, 1, 2, 1, 1)       \
+    X(EULER_EXTRINSIC_ZXZ, 2, 0, 2, 1)       \
+    X(EULER_EXTRINSIC_ZYZ, 2, 1, 2, 1)
+
+/* +1 when (i, j, third axis) is a cyclic permutation of (x, y, z), -1 otherwise. */
+#define EULER_PARITY(i, j) ((((j) - (i) + 3) % 3) == 1 ? 1 : -1)
+
+#endif // ATTITUDE_EULER_SEQUENCE_H
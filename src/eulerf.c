@@ -0,0 +1,7 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/euler.h"
+#include "attitude_real.h"
+#include "euler_sequence.h"
+#include <stddef.h>
+
+#include "euler_impl.inc"
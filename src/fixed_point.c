@@ -0,0 +1,157 @@
+#include "attitude/fixed_point.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Products of two Q1.30 values are Q2.60 and reach 2^62 in magnitude, so sums of up to four of
+ * them are formed in Q58 (each product shifted right by two first) to stay clear of int64
+ * overflow for any input, saturated ones included.
+ */
+#define Q58_ONE ((int64_t)1 << 58)
+
+/* Newton steps for the reciprocal square root; the linear start is within 9% and the relative
+ * error after step k is about 1.5 e^2, so four steps leave ~1e-14, below Q1.30 resolution. */
+#define Q30_RSQRT_ITERATIONS 4
+/* 1.06 and 0.15 in Q31, spelled out so no floating point is needed at run time. */
+#define Q31_RSQRT_SEED_A UINT64_C(2276332667)
+#define Q31_RSQRT_SEED_B UINT64_C(322122547)
+
+static int32_t saturate(int64_t value) {
+    if (value > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (value < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
+/* value / 2^shift rounded to nearest (ties towards +inf); |value| must stay below 2^62. */
+static int64_t round_shift(int64_t value, int shift) {
+    if (shift <= 0) {
+        return value;
+    }
+    return (value + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+static int64_t product_q58(int32_t a, int32_t b) {
+    return ((int64_t)a * b) >> 2;
+}
+
+int quaternion_q30_from_double(const double q[4], int32_t q_out[4]) {
+    if (q == NULL || q_out == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (!isfinite(q[i])) {
+            return 0;
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        const double scaled = q[i] * (double)ATTITUDE_Q30_ONE;
+        if (scaled >= (double)INT32_MAX) {
+            q_out[i] = INT32_MAX;
+        } else if (scaled <= (double)INT32_MIN) {
+            q_out[i] = INT32_MIN;
+        } else {
+            q_out[i] = (int32_t)lround(scaled);
+        }
+    }
+    return 1;
+}
+
+void quaternion_q30_to_double(const int32_t q[4], double q_out[4]) {
+    for (int i = 0; i < 4; ++i) {
+        q_out[i] = (double)q[i] / (double)ATTITUDE_Q30_ONE;
+    }
+}
+
+void quaternion_q30_multiply(const int32_t a[4], const int32_t b[4], int32_t out[4]) {
+    const int32_t aw = a[0], ax = a[1], ay = a[2], az = a[3];
+    const int32_t bw = b[0], bx = b[1], by = b[2], bz = b[3];
+
+    const int64_t w = product_q58(aw, bw) - product_q58(ax, bx) - product_q58(ay, by) - product_q58(az, bz);
+    const int64_t x = product_q58(aw, bx) + product_q58(ax, bw) + product_q58(ay, bz) - product_q58(az, by);
+    const int64_t y = product_q58(aw, by) - product_q58(ax, bz) + product_q58(ay, bw) + product_q58(az, bx);
+    const int64_t z = product_q58(aw, bz) + product_q58(ax, by) - product_q58(ay, bx) + product_q58(az, bw);
+
+    out[0] = saturate(round_shift(w, 28));
+    out[1] = saturate(round_shift(x, 28));
+    out[2] = saturate(round_shift(y, 28));
+    out[3] = saturate(round_shift(z, 28));
+}
+
+int quaternion_q30_normalize(int32_t q[4]) {
+    if (q == NULL) {
+        return 0;
+    }
+
+    // Squared norm in Q60. INT32_MIN is clamped so that four squares cannot reach 2^64.
+    uint64_t norm_sq = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int64_t magnitude = q[i] == INT32_MIN ? INT32_MAX : (q[i] < 0 ? -(int64_t)q[i] : q[i]);
+        norm_sq += (uint64_t)(magnitude * magnitude);
+    }
+    if (norm_sq == 0) {
+        return 0;
+    }
+
+    // Scale by 4^k into [2^60, 2^62), i.e. x = norm_sq 4^k in [1, 4), so 1/|q| = 2^k / sqrt(x).
+    int k = 0;
+    uint64_t scaled = norm_sq;
+    if (scaled >= (uint64_t)1 << 62) {
+        scaled >>= 2;
+        k = -1;
+    }
+    while (scaled < (uint64_t)1 << 60) {
+        scaled <<= 2;
+        ++k;
+    }
+    const uint64_t x = (scaled + ((uint64_t)1 << 29)) >> 30;  // Q30 in [2^30, 2^32].
+
+    // y ~ 1/sqrt(x) in (0.5, 1], kept unsigned in Q31 for one more bit than the output:
+    // minimax line 1.06 - 0.15 x on [1, 4], then y <- y (3 - x y^2) / 2.
+    uint64_t y = Q31_RSQRT_SEED_A - ((Q31_RSQRT_SEED_B * x + ((uint64_t)1 << 29)) >> 30);
+    for (int iteration = 0; iteration < Q30_RSQRT_ITERATIONS; ++iteration) {
+        const uint64_t y2 = (y * y + ((uint64_t)1 << 30)) >> 31;
+        const uint64_t xy2 = (x * y2 + ((uint64_t)1 << 29)) >> 30;
+        y = (y * (((uint64_t)3 << 31) - xy2) + ((uint64_t)1 << 31)) >> 32;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        q[i] = saturate(round_shift((int64_t)q[i] * (int64_t)y, 31 - k));
+    }
+    return 1;
+}
+
+void quaternion_q30_to_dcm(const int32_t q[4], int32_t dcm[3][3]) {
+    const int32_t w = q[0], x = q[1], y = q[2], z = q[3];
+    const int64_t xx = product_q58(x, x), yy = product_q58(y, y), zz = product_q58(z, z);
+    const int64_t xy = product_q58(x, y), xz = product_q58(x, z), yz = product_q58(y, z);
+    const int64_t wx = product_q58(w, x), wy = product_q58(w, y), wz = product_q58(w, z);
+
+    dcm[0][0] = saturate(round_shift(Q58_ONE - 2 * (yy + zz), 28));
+    dcm[0][1] = saturate(round_shift(2 * (xy - wz), 28));
+    dcm[0][2] = saturate(round_shift(2 * (xz + wy), 28));
+    dcm[1][0] = saturate(round_shift(2 * (xy + wz), 28));
+    dcm[1][1] = saturate(round_shift(Q58_ONE - 2 * (xx + zz), 28));
+    dcm[1][2] = saturate(round_shift(2 * (yz - wx), 28));
+    dcm[2][0] = saturate(round_shift(2 * (xz - wy), 28));
+    dcm[2][1] = saturate(round_shift(2 * (yz + wx), 28));
+    dcm[2][2] = saturate(round_shift(Q58_ONE - 2 * (xx + yy), 28));
+}
+
+void dcm_q30_apply(const int32_t dcm[3][3], const int32_t v_in[3], int32_t v_out[3]) {
+    const int32_t vx = v_in[0], vy = v_in[1], vz = v_in[2];
+    for (int row = 0; row < 3; ++row) {
+        const int64_t sum = product_q58(dcm[row][0], vx) + product_q58(dcm[row][1], vy) + product_q58(dcm[row][2], vz);
+        v_out[row] = saturate(round_shift(sum, 28));
+    }
+}
+
+void quaternion_q30_rotate_vector(const int32_t q[4], const int32_t v_in[3], int32_t v_out[3]) {
+    int32_t dcm[3][3];
+    quaternion_q30_to_dcm(q, dcm);
+    dcm_q30_apply((const int32_t (*)[3])dcm, v_in, v_out);
+}
@@ -0,0 +1,6 @@
+#include "attitude/kinematics.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "kinematics_impl.inc"
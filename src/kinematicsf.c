@@ -0,0 +1,7 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/kinematics.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "kinematics_impl.inc"
@@ -0,0 +1,7 @@
+#include "attitude/mekf.h"
+#include "attitude/quaternion_inline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "mekf_impl.inc"
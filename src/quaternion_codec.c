@@ -0,0 +1,359 @@
+#include "attitude/quaternion_codec.h"
+#include "attitude/quaternion.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* 1/sqrt(2): no component other than the largest of a unit quaternion can exceed it. */
+#define SMALL_RANGE 0.70710678118654752440
+
+/* Stream records start with a 4-bit tag: a residual's field width, or the keyframe escape. */
+#define TAG_BITS 4u
+#define TAG_KEYFRAME 15u
+#define RESIDUAL_MAX_BITS 14u
+
+/* Positions of the three stored components for each largest-component index. */
+static const unsigned char k_small_slots[4][3] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
+
+static int bits_supported(unsigned bits) {
+    return bits >= QUATERNION_CODEC_MIN_BITS && bits <= QUATERNION_CODEC_MAX_BITS;
+}
+
+static double quantum(unsigned bits) {
+    return SMALL_RANGE / (double)((1u << (bits - 1)) - 1u);
+}
+
+double quaternion_codec_max_error(unsigned bits) {
+    if (!bits_supported(bits)) {
+        return 0.0;
+    }
+    /* First-order bound 2*sqrt(3)*s, reached when all four components are near 1/2. The
+     * relative margin covers the higher-order terms, which only matter at the coarsest depths. */
+    const double s = quantum(bits);
+    return 2.0 * sqrt(3.0) * s * (1.0 + 2.0 * s);
+}
+
+/* ---- Bit I/O ---------------------------------------------------------------- */
+
+/*
+ * The writer keeps at most 7 pending bits between calls, so one call takes up to 57 bits.
+ * The reader loads the 64 bits starting at the byte that holds the first wanted bit; after the
+ * shift at least 57 are valid, enough for any record. Loads near the end of the buffer go
+ * through a zero-padded copy so nothing past @c size is touched.
+ */
+
+typedef struct {
+    unsigned char *out;
+    size_t bytes;
+    uint64_t pending;
+    unsigned pending_bits;
+} BitWriter;
+
+static inline void put_bits(BitWriter *w, uint64_t value, unsigned bits) {
+    w->pending |= value << w->pending_bits;
+    w->pending_bits += bits;
+    while (w->pending_bits >= 8) {
+        w->out[w->bytes++] = (unsigned char)w->pending;
+        w->pending >>= 8;
+        w->pending_bits -= 8;
+    }
+}
+
+static size_t finish_bits(BitWriter *w) {
+    if (w->pending_bits > 0) {
+        w->out[w->bytes++] = (unsigned char)w->pending;
+    }
+    return w->bytes;
+}
+
+static inline uint64_t load_le64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    const uint16_t one = 1;
+    unsigned char first;
+    memcpy(&first, &one, 1);
+    if (first != 1) {
+        uint64_t swapped = 0;
+        for (int i = 0; i < 8; ++i) {
+            swapped = (swapped << 8) | ((v >> (8 * i)) & 0xffu);
+        }
+        v = swapped;
+    }
+    return v;
+}
+
+static inline uint64_t peek_bits(const unsigned char *in, size_t size, size_t bit) {
+    const size_t byte = bit >> 3;
+    if (byte + 8 <= size) {
+        return load_le64(in + byte) >> (bit & 7);
+    }
+    unsigned char tail[8] = {0};
+    if (byte < size) {
+        memcpy(tail, in + byte, size - byte);
+    }
+    return load_le64(tail) >> (bit & 7);
+}
+
+/* ---- Smallest-three records ------------------------------------------------- */
+
+static int prepare(const double q[4], double unit[4]) {
+    const double n2 = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+    if (!(n2 > 0.0) || !isfinite(n2)) {
+        unit[0] = 1.0;
+        unit[1] = unit[2] = unit[3] = 0.0;
+        return 0;
+    }
+    const double inv = 1.0 / sqrt(n2);
+    for (int i = 0; i < 4; ++i) {
+        unit[i] = q[i] * inv;
+    }
+    return 1;
+}
+
+static uint64_t encode_smallest_three(const double unit[4], unsigned bits) {
+    unsigned largest = 0;
+    for (unsigned i = 1; i < 4; ++i) {
+        if (fabs(unit[i]) > fabs(unit[largest])) {
+            largest = i;
+        }
+    }
+    const double sign = unit[largest] < 0.0 ? -1.0 : 1.0;
+    const int64_t limit = ((int64_t)1 << (bits - 1)) - 1;
+    const double inv_step = 1.0 / quantum(bits);
+    uint64_t code = largest;
+    for (unsigned k = 0; k < 3; ++k) {
+        int64_t level = (int64_t)lrint(sign * unit[k_small_slots[largest][k]] * inv_step);
+        level = level > limit ? limit : (level < -limit ? -limit : level);
+        code |= (uint64_t)(level + limit + 1) << (2 + k * bits);
+    }
+    return code;
+}
+
+static inline void decode_smallest_three(uint64_t code, unsigned bits, double step, double q[4]) {
+    const uint64_t mask = ((uint64_t)1 << bits) - 1;
+    const int64_t offset = (int64_t)1 << (bits - 1);
+    const unsigned largest = (unsigned)(code & 3u);
+    const double a = (double)((int64_t)((code >> 2) & mask) - offset) * step;
+    const double b = (double)((int64_t)((code >> (2 + bits)) & mask) - offset) * step;
+    const double c = (double)((int64_t)((code >> (2 + 2 * bits)) & mask) - offset) * step;
+    const double rest = 1.0 - (a * a + b * b + c * c);
+    const unsigned char *slots = k_small_slots[largest];
+    q[largest] = sqrt(rest > 0.0 ? rest : 0.0);
+    q[slots[0]] = a;
+    q[slots[1]] = b;
+    q[slots[2]] = c;
+}
+
+int quaternion_pack(const double *q, size_t count, unsigned bits, unsigned char *out) {
+    if (!bits_supported(bits) || (count > 0 && (q == NULL || out == NULL))) {
+        return 0;
+    }
+    const unsigned record = 2 + 3 * bits;
+    BitWriter writer = {out, 0, 0, 0};
+    int ok = 1;
+    for (size_t i = 0; i < count; ++i) {
+        double unit[4];
+        ok &= prepare(q + 4 * i, unit);
+        put_bits(&writer, encode_smallest_three(unit, bits), record);
+    }
+    finish_bits(&writer);
+    return ok;
+}
+
+int quaternion_unpack(const unsigned char *in, size_t count, unsigned bits, double *q_out) {
+    if (!bits_supported(bits) || (count > 0 && (in == NULL || q_out == NULL))) {
+        return 0;
+    }
+    const unsigned record = 2 + 3 * bits;
+    const size_t size = QUATERNION_PACK_BYTES(count, bits);
+    const double step = quantum(bits);
+    for (size_t i = 0; i < count; ++i) {
+        decode_smallest_three(peek_bits(in, size, i * record), bits, step, q_out + 4 * i);
+    }
+    return 1;
+}
+
+/* ---- Streams ------------------------------------------------------------------ */
+
+/*
+ * Encoder and decoder share the reconstruction below, so the encoder predicts from exactly the
+ * values the decoder will produce. State: q is the last decoded sample and d the last decoded
+ * step (identity in delta mode, and after every keyframe until the next residual).
+ */
+
+typedef struct {
+    double q[4];
+    double d[4];
+} StreamState;
+
+/* Hamilton product a * b, as quaternion_multiply(); local so the decode loop can inline it. */
+static inline void compose(const double a[4], const double b[4], double out[4]) {
+    const double w = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+    const double x = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+    const double y = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+    const double z = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+    out[0] = w;
+    out[1] = x;
+    out[2] = y;
+    out[3] = z;
+}
+
+static void predict(const StreamState *s, QuaternionCodecMode mode, double pred[4]) {
+    if (mode == QUATERNION_CODEC_PREDICTIVE) {
+        compose(s->d, s->q, pred);
+    } else {
+        memcpy(pred, s->q, sizeof(s->q));
+    }
+}
+
+static inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)-(int32_t)(v < 0);
+}
+
+static inline int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1u);
+}
+
+/*
+ * Restarts the state from a keyframe. Resetting d as well as q means a corrupted residual cannot
+ * outlive the next keyframe in predictive mode either.
+ */
+static inline void apply_keyframe(StreamState *s, uint64_t code, unsigned bits, double step) {
+    static const double identity[4] = {1.0, 0.0, 0.0, 0.0};
+    decode_smallest_three(code, bits, step, s->q);
+    memcpy(s->d, identity, sizeof(identity));
+}
+
+/*
+ * Applies a residual with the given quantised vector part. The encoder keeps its norm within
+ * 1/sqrt(2); the clamp only keeps a corrupted stream finite.
+ */
+static inline void apply_residual(StreamState *s, QuaternionCodecMode mode, const int32_t level[3], double step) {
+    const double x = level[0] * step;
+    const double y = level[1] * step;
+    const double z = level[2] * step;
+    const double rest = 1.0 - (x * x + y * y + z * z);
+    const double r[4] = {sqrt(rest > 0.0 ? rest : 0.0), x, y, z};
+    double next[4];
+    if (mode == QUATERNION_CODEC_PREDICTIVE) {
+        double d[4];
+        compose(r, s->d, d);
+        memcpy(s->d, d, sizeof(d));
+        compose(d, s->q, next);
+    } else {
+        compose(r, s->q, next);
+    }
+    memcpy(s->q, next, sizeof(next));
+}
+
+static int config_supported(const QuaternionStreamConfig *config) {
+    return config != NULL && bits_supported(config->bits) &&
+           (config->mode == QUATERNION_CODEC_DELTA || config->mode == QUATERNION_CODEC_PREDICTIVE);
+}
+
+/* Quantises the residual from @p pred to @p unit; 0 when it needs a keyframe instead. */
+static int quantise_residual(const double pred[4], const double unit[4], double step, int32_t level[3]) {
+    double r[4];
+    if (!quaternion_relative(pred, unit, r)) {
+        return 0;
+    }
+    const double limit = (double)(1 << (RESIDUAL_MAX_BITS - 1));
+    double n2 = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        const double l = nearbyint(r[k + 1] / step);
+        if (!(fabs(l) < limit)) {
+            return 0;
+        }
+        level[k] = (int32_t)l;
+        n2 += (l * step) * (l * step);
+    }
+    return n2 <= 0.5;
+}
+
+int quaternion_stream_encode(const double *q,
+                             size_t count,
+                             const QuaternionStreamConfig *config,
+                             unsigned char *out,
+                             size_t capacity,
+                             size_t *size) {
+    if (size != NULL) {
+        *size = 0;
+    }
+    if (!config_supported(config) || size == NULL || (count > 0 && (q == NULL || out == NULL)) ||
+        capacity < QUATERNION_STREAM_MAX_BYTES(count, config->bits)) {
+        return 0;
+    }
+    const unsigned bits = config->bits;
+    const double step = quantum(bits);
+    StreamState state = {{1.0, 0.0, 0.0, 0.0}, {1.0, 0.0, 0.0, 0.0}};
+    BitWriter writer = {out, 0, 0, 0};
+    int ok = 1;
+    for (size_t i = 0; i < count; ++i) {
+        double pred[4];
+        double unit[4];
+        predict(&state, config->mode, pred);
+        if (!prepare(q + 4 * i, unit)) {
+            memcpy(unit, pred, sizeof(unit));
+            ok = 0;
+        }
+        int32_t level[3];
+        const int keyframe = i == 0 || (config->keyframe_interval > 0 && i % config->keyframe_interval == 0);
+        if (!keyframe && quantise_residual(pred, unit, step, level)) {
+            const uint32_t zz[3] = {zigzag(level[0]), zigzag(level[1]), zigzag(level[2])};
+            const uint32_t any = zz[0] | zz[1] | zz[2];
+            unsigned width = 0;
+            while ((any >> width) != 0) {
+                ++width;
+            }
+            put_bits(&writer, width, TAG_BITS);
+            put_bits(&writer, zz[0] | ((uint64_t)zz[1] << width) | ((uint64_t)zz[2] << (2 * width)), 3 * width);
+            apply_residual(&state, config->mode, level, step);
+        } else {
+            const uint64_t code = encode_smallest_three(unit, bits);
+            put_bits(&writer, TAG_KEYFRAME, TAG_BITS);
+            put_bits(&writer, code, 2 + 3 * bits);
+            apply_keyframe(&state, code, bits, step);
+        }
+    }
+    *size = finish_bits(&writer);
+    return ok;
+}
+
+int quaternion_stream_decode(const unsigned char *in,
+                             size_t size,
+                             size_t count,
+                             const QuaternionStreamConfig *config,
+                             double *q_out) {
+    if (!config_supported(config) || (count > 0 && (in == NULL || q_out == NULL))) {
+        return 0;
+    }
+    if (count == 0) {
+        return 1;
+    }
+    const unsigned bits = config->bits;
+    if (size == 0 || (peek_bits(in, size, 0) & 15u) != TAG_KEYFRAME) {
+        return 0;
+    }
+    const unsigned record = 2 + 3 * bits;
+    const double step = quantum(bits);
+    StreamState state = {{1.0, 0.0, 0.0, 0.0}, {1.0, 0.0, 0.0, 0.0}};
+    size_t bit = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t window = peek_bits(in, size, bit);
+        const unsigned tag = (unsigned)(window & 15u);
+        if (tag == TAG_KEYFRAME) {
+            apply_keyframe(&state, peek_bits(in, size, bit + TAG_BITS), bits, step);
+            bit += TAG_BITS + record;
+        } else {
+            const uint64_t mask = ((uint64_t)1 << tag) - 1;
+            const int32_t level[3] = {unzigzag((uint32_t)((window >> TAG_BITS) & mask)),
+                                      unzigzag((uint32_t)((window >> (TAG_BITS + tag)) & mask)),
+                                      unzigzag((uint32_t)((window >> (TAG_BITS + 2 * tag)) & mask))};
+            apply_residual(&state, config->mode, level, step);
+            bit += TAG_BITS + 3 * tag;
+        }
+        memcpy(q_out + 4 * i, state.q, sizeof(state.q));
+    }
+    return bit <= 8 * size;
+}
@@ -0,0 +1,311 @@
+#include "attitude/quaternion_soa.h"
+#include "attitude/dcm.h"
+#include "attitude/quaternion.h"
+#include "quaternion_soa_internal.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The first batch call resolves the automatic backend, possibly on several threads at once
+ * (e.g. the attitude_convert() pool). Every resolver computes the same pair, publishes the
+ * kernels before the backend, and readers check the backend first, so a thread that sees it
+ * resolved also sees its kernels. The library is C99, hence the compiler builtins.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SOA_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define SOA_ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define SOA_ATOMIC_LOAD(p) (*(p))
+#define SOA_ATOMIC_STORE(p, v) (*(p) = (v))
+#endif
+
+static QuaternionSoaBackend g_soa_backend = QUATERNION_SOA_BACKEND_AUTO;
+static const QuaternionSoaKernels *g_soa_kernels = NULL;
+
+static void publish(QuaternionSoaBackend backend, const QuaternionSoaKernels *kernels) {
+    SOA_ATOMIC_STORE(&g_soa_kernels, kernels);
+    SOA_ATOMIC_STORE(&g_soa_backend, backend);
+}
+
+static const QuaternionSoaKernels *kernels_for(QuaternionSoaBackend backend) {
+    switch (backend) {
+    case QUATERNION_SOA_BACKEND_SSE2:
+        return quaternion_soa_sse2_kernels();
+    case QUATERNION_SOA_BACKEND_AVX2:
+        return quaternion_soa_avx2_kernels();
+    case QUATERNION_SOA_BACKEND_AVX512:
+        return quaternion_soa_avx512_kernels();
+    case QUATERNION_SOA_BACKEND_NEON:
+        return quaternion_soa_neon_kernels();
+    default:
+        return NULL;
+    }
+}
+
+static void resolve_backend(void) {
+    if (SOA_ATOMIC_LOAD(&g_soa_backend) != QUATERNION_SOA_BACKEND_AUTO) {
+        return;
+    }
+
+    // Widest first; the scalar loop is the last resort.
+    const QuaternionSoaBackend preference[] = {
+        QUATERNION_SOA_BACKEND_AVX512,
+        QUATERNION_SOA_BACKEND_AVX2,
+        QUATERNION_SOA_BACKEND_NEON,
+        QUATERNION_SOA_BACKEND_SSE2
+    };
+    for (size_t index = 0; index < sizeof(preference) / sizeof(preference[0]); ++index) {
+        const QuaternionSoaKernels *kernels = kernels_for(preference[index]);
+        if (kernels != NULL) {
+            publish(preference[index], kernels);
+            return;
+        }
+    }
+    publish(QUATERNION_SOA_BACKEND_SCALAR, NULL);
+}
+
+int quaternion_soa_set_backend(QuaternionSoaBackend backend) {
+    if (backend == QUATERNION_SOA_BACKEND_AUTO) {
+        SOA_ATOMIC_STORE(&g_soa_backend, QUATERNION_SOA_BACKEND_AUTO);
+        resolve_backend();
+        return 1;
+    }
+    if (backend == QUATERNION_SOA_BACKEND_SCALAR) {
+        publish(backend, NULL);
+        return 1;
+    }
+
+    const QuaternionSoaKernels *kernels = kernels_for(backend);
+    if (kernels == NULL) {
+        return 0;
+    }
+    publish(backend, kernels);
+    return 1;
+}
+
+QuaternionSoaBackend quaternion_soa_backend(void) {
+    resolve_backend();
+    return SOA_ATOMIC_LOAD(&g_soa_backend);
+}
+
+const char *quaternion_soa_backend_name(QuaternionSoaBackend backend) {
+    switch (backend) {
+    case QUATERNION_SOA_BACKEND_AUTO:
+        return "auto";
+    case QUATERNION_SOA_BACKEND_SCALAR:
+        return "scalar";
+    case QUATERNION_SOA_BACKEND_SSE2:
+        return "sse2";
+    case QUATERNION_SOA_BACKEND_AVX2:
+        return "avx2";
+    case QUATERNION_SOA_BACKEND_AVX512:
+        return "avx512";
+    case QUATERNION_SOA_BACKEND_NEON:
+        return "neon";
+    default:
+        return "unknown";
+    }
+}
+
+static const QuaternionSoaKernels *active_kernels(void) {
+    resolve_backend();
+    return SOA_ATOMIC_LOAD(&g_soa_kernels);
+}
+
+static int soa_is_valid(const QuaternionSoA *soa) {
+    return soa != NULL &&
+           (soa->count == 0 ||
+            (soa->w != NULL && soa->x != NULL && soa->y != NULL && soa->z != NULL));
+}
+
+static void soa_load(const QuaternionSoA *soa, size_t index, double q[4]) {
+    q[0] = soa->w[index];
+    q[1] = soa->x[index];
+    q[2] = soa->y[index];
+    q[3] = soa->z[index];
+}
+
+static void soa_store(QuaternionSoA *soa, size_t index, const double q[4]) {
+    soa->w[index] = q[0];
+    soa->x[index] = q[1];
+    soa->y[index] = q[2];
+    soa->z[index] = q[3];
+}
+
+int quaternion_soa_init(QuaternionSoA *soa, double *storage, size_t storage_doubles, size_t count) {
+    if (soa == NULL || storage == NULL || storage_doubles < QUATERNION_SOA_STORAGE_DOUBLES(count)) {
+        return 0;
+    }
+
+    const size_t alignment_doubles = QUATERNION_SOA_ALIGNMENT / sizeof(double);
+    const size_t misalignment = (size_t)((uintptr_t)storage % QUATERNION_SOA_ALIGNMENT);
+    double *base = storage;
+    if (misalignment != 0) {
+        // Storage is at least double-aligned, so the shift is a whole number of doubles.
+        base += (QUATERNION_SOA_ALIGNMENT - misalignment) / sizeof(double);
+    }
+    const size_t lane = (count + alignment_doubles - 1) & ~(alignment_doubles - 1);
+
+    soa->w = base;
+    soa->x = base + lane;
+    soa->y = base + 2 * lane;
+    soa->z = base + 3 * lane;
+    soa->count = count;
+    return 1;
+}
+
+int quaternion_soa_from_aos(QuaternionSoA *soa, const double *q_aos) {
+    if (!soa_is_valid(soa) || (soa->count > 0 && q_aos == NULL)) {
+        return 0;
+    }
+    for (size_t index = 0; index < soa->count; ++index) {
+        soa_store(soa, index, &q_aos[4 * index]);
+    }
+    return 1;
+}
+
+int quaternion_soa_to_aos(const QuaternionSoA *soa, double *q_aos) {
+    if (!soa_is_valid(soa) || (soa->count > 0 && q_aos == NULL)) {
+        return 0;
+    }
+    for (size_t index = 0; index < soa->count; ++index) {
+        soa_load(soa, index, &q_aos[4 * index]);
+    }
+    return 1;
+}
+
+int quaternion_soa_multiply(const QuaternionSoA *a, const QuaternionSoA *b, QuaternionSoA *out) {
+    if (!soa_is_valid(a) || !soa_is_valid(b) || !soa_is_valid(out) ||
+        a->count != b->count || a->count != out->count) {
+        return 0;
+    }
+
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->multiply(a, b, out, a->count) : 0;
+    for (; index < a->count; ++index) {
+        double q1[4];
+        double q2[4];
+        double q_out[4];
+        soa_load(a, index, q1);
+        soa_load(b, index, q2);
+        quaternion_multiply(q1, q2, q_out);
+        soa_store(out, index, q_out);
+    }
+    return 1;
+}
+
+int quaternion_soa_normalize(QuaternionSoA *q) {
+    if (!soa_is_valid(q)) {
+        return 0;
+    }
+
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->normalize(q, q->count) : 0;
+    for (; index < q->count; ++index) {
+        double element[4];
+        soa_load(q, index, element);
+        quaternion_normalize(element);
+        soa_store(q, index, element);
+    }
+    return 1;
+}
+
+int quaternion_soa_inverse(const QuaternionSoA *q, QuaternionSoA *out) {
+    if (!soa_is_valid(q) || !soa_is_valid(out) || q->count != out->count) {
+        return 0;
+    }
+
+    int all_inverted = 1;
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->inverse(q, out, q->count, &all_inverted) : 0;
+    for (; index < q->count; ++index) {
+        double element[4];
+        double inverse[4];
+        soa_load(q, index, element);
+        if (quaternion_inverse(element, inverse)) {
+            soa_store(out, index, inverse);
+        } else {
+            all_inverted = 0;
+        }
+    }
+    return all_inverted;
+}
+
+int quaternion_soa_rotate(const QuaternionSoA *q, const double *const v_in[3], double *const v_out[3]) {
+    if (!soa_is_valid(q) || v_in == NULL || v_out == NULL) {
+        return 0;
+    }
+    for (int axis = 0; axis < 3; ++axis) {
+        if (q->count > 0 && (v_in[axis] == NULL || v_out[axis] == NULL)) {
+            return 0;
+        }
+    }
+
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->rotate(q, v_in, v_out, q->count) : 0;
+    for (; index < q->count; ++index) {
+        double element[4];
+        double vector[3] = {v_in[0][index], v_in[1][index], v_in[2][index]};
+        double rotated[3];
+        soa_load(q, index, element);
+        quaternion_rotate_vector(element, vector, rotated);
+        v_out[0][index] = rotated[0];
+        v_out[1][index] = rotated[1];
+        v_out[2][index] = rotated[2];
+    }
+    return 1;
+}
+
+int quaternion_soa_to_dcm(const QuaternionSoA *q, double *const dcm[9]) {
+    if (!soa_is_valid(q) || dcm == NULL) {
+        return 0;
+    }
+    for (int lane = 0; lane < 9; ++lane) {
+        if (q->count > 0 && dcm[lane] == NULL) {
+            return 0;
+        }
+    }
+
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->to_dcm(q, dcm, q->count) : 0;
+    for (; index < q->count; ++index) {
+        double element[4];
+        double matrix[3][3];
+        soa_load(q, index, element);
+        quaternion_to_dcm(element, matrix);
+        for (int lane = 0; lane < 9; ++lane) {
+            dcm[lane][index] = matrix[lane / 3][lane % 3];
+        }
+    }
+    return 1;
+}
+
+int quaternion_soa_from_dcm(const double *const dcm[9], QuaternionSoA *out) {
+    if (dcm == NULL || !soa_is_valid(out)) {
+        return 0;
+    }
+    for (int lane = 0; lane < 9; ++lane) {
+        if (out->count > 0 && dcm[lane] == NULL) {
+            return 0;
+        }
+    }
+
+#ifdef ATTITUDE_CHECK_TRUSTED_INPUTS
+    // The vector kernels do not validate; route everything through the checking scalar path.
+    size_t index = 0;
+#else
+    const QuaternionSoaKernels *kernels = active_kernels();
+    size_t index = kernels != NULL ? kernels->from_dcm(dcm, out, out->count) : 0;
+#endif
+    for (; index < out->count; ++index) {
+        double matrix[3][3];
+        double element[4];
+        for (int lane = 0; lane < 9; ++lane) {
+            matrix[lane / 3][lane % 3] = dcm[lane][index];
+        }
+        dcm_to_quaternion_unchecked((const double (*)[3])matrix, element);
+        soa_store(out, index, element);
+    }
+    return 1;
+}
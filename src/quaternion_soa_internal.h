@@ -0,0 +1,28 @@
+#ifndef ATTITUDE_QUATERNION_SOA_INTERNAL_H
+#define ATTITUDE_QUATERNION_SOA_INTERNAL_H
+
+#include <stddef.h>
+
+#include "attitude/quaternion_soa.h"
+
+/*
+ * Vector kernels process the longest prefix that is a multiple of their lane width and return
+ * the number of elements handled. The dispatcher in quaternion_soa.c finishes the tail with the
+ * scalar API, which is what makes every backend bit-compatible with it.
+ */
+typedef struct {
+    size_t (*multiply)(const QuaternionSoA *a, const QuaternionSoA *b, QuaternionSoA *out, size_t count);
+    size_t (*normalize)(QuaternionSoA *q, size_t count);
+    size_t (*inverse)(const QuaternionSoA *q, QuaternionSoA *out, size_t count, int *all_inverted);
+    size_t (*rotate)(const QuaternionSoA *q, const double *const v_in[3], double *const v_out[3], size_t count);
+    size_t (*to_dcm)(const QuaternionSoA *q, double *const dcm[9], size_t count);
+    size_t (*from_dcm)(const double *const dcm[9], QuaternionSoA *out, size_t count);
+} QuaternionSoaKernels;
+
+/* Each returns NULL when the backend is not compiled in or the running CPU cannot execute it. */
+const QuaternionSoaKernels *quaternion_soa_sse2_kernels(void);
+const QuaternionSoaKernels *quaternion_soa_avx2_kernels(void);
+const QuaternionSoaKernels *quaternion_soa_avx512_kernels(void);
+const QuaternionSoaKernels *quaternion_soa_neon_kernels(void);
+
+#endif // ATTITUDE_QUATERNION_SOA_INTERNAL_H
@@ -0,0 +1,41 @@
+#include "quaternion_soa_internal.h"
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+/* Advanced SIMD is mandatory on AArch64, so no target attribute or runtime probe is needed. */
+
+#define SOA_VEC float64x2_t
+#define SOA_MASK uint64x2_t
+#define SOA_WIDTH 2
+#define SOA_TARGET
+#define SOA_NAME(op) soa_neon_##op
+#define SOA_LOAD(p) vld1q_f64(p)
+#define SOA_STORE(p, v) vst1q_f64((p), (v))
+#define SOA_SET1(x) vdupq_n_f64(x)
+#define SOA_ADD(a, b) vaddq_f64((a), (b))
+#define SOA_SUB(a, b) vsubq_f64((a), (b))
+#define SOA_MUL(a, b) vmulq_f64((a), (b))
+#define SOA_DIV(a, b) vdivq_f64((a), (b))
+#define SOA_SQRT(a) vsqrtq_f64(a)
+#define SOA_NEG(a) vnegq_f64(a)
+#define SOA_ABS(a) vabsq_f64(a)
+#define SOA_GT(a, b) vcgtq_f64((a), (b))
+#define SOA_LT(a, b) vcltq_f64((a), (b))
+#define SOA_MASK_AND(a, b) vandq_u64((a), (b))
+#define SOA_SELECT(m, t, f) vbslq_f64((m), (t), (f))
+#define SOA_MASK_ANY(m) (vmaxvq_u32(vreinterpretq_u32_u64(m)) != 0)
+#include "quaternion_soa_kernels.inc"
+
+const QuaternionSoaKernels *quaternion_soa_neon_kernels(void) {
+    return &soa_neon_kernels;
+}
+
+#else
+
+const QuaternionSoaKernels *quaternion_soa_neon_kernels(void) {
+    return NULL;
+}
+
+#endif
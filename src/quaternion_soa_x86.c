@@ -0,0 +1,182 @@
+#include "quaternion_soa_internal.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ATTITUDE_SOA_X86 1
+#endif
+
+#ifdef ATTITUDE_SOA_X86
+
+#include <immintrin.h>
+
+/* ---- SSE2: 2 lanes ---------------------------------------------------- */
+
+#define SOA_VEC __m128d
+#define SOA_MASK __m128d
+#define SOA_WIDTH 2
+#define SOA_TARGET __attribute__((target("sse2")))
+#define SOA_NAME(op) soa_sse2_##op
+#define SOA_LOAD(p) _mm_loadu_pd(p)
+#define SOA_STORE(p, v) _mm_storeu_pd((p), (v))
+#define SOA_SET1(x) _mm_set1_pd(x)
+#define SOA_ADD(a, b) _mm_add_pd((a), (b))
+#define SOA_SUB(a, b) _mm_sub_pd((a), (b))
+#define SOA_MUL(a, b) _mm_mul_pd((a), (b))
+#define SOA_DIV(a, b) _mm_div_pd((a), (b))
+#define SOA_SQRT(a) _mm_sqrt_pd(a)
+#define SOA_NEG(a) _mm_xor_pd((a), _mm_set1_pd(-0.0))
+#define SOA_ABS(a) _mm_andnot_pd(_mm_set1_pd(-0.0), (a))
+#define SOA_GT(a, b) _mm_cmpgt_pd((a), (b))
+#define SOA_LT(a, b) _mm_cmplt_pd((a), (b))
+#define SOA_MASK_AND(a, b) _mm_and_pd((a), (b))
+#define SOA_SELECT(m, t, f) _mm_or_pd(_mm_and_pd((m), (t)), _mm_andnot_pd((m), (f)))
+#define SOA_MASK_ANY(m) (_mm_movemask_pd(m) != 0)
+#include "quaternion_soa_kernels.inc"
+#undef SOA_VEC
+#undef SOA_MASK
+#undef SOA_WIDTH
+#undef SOA_TARGET
+#undef SOA_NAME
+#undef SOA_LOAD
+#undef SOA_STORE
+#undef SOA_SET1
+#undef SOA_ADD
+#undef SOA_SUB
+#undef SOA_MUL
+#undef SOA_DIV
+#undef SOA_SQRT
+#undef SOA_NEG
+#undef SOA_ABS
+#undef SOA_GT
+#undef SOA_LT
+#undef SOA_MASK_AND
+#undef SOA_SELECT
+#undef SOA_MASK_ANY
+
+/* ---- AVX2: 4 lanes ---------------------------------------------------- */
+
+#define SOA_VEC __m256d
+#define SOA_MASK __m256d
+#define SOA_WIDTH 4
+#define SOA_TARGET __attribute__((target("avx2")))
+#define SOA_NAME(op) soa_avx2_##op
+#define SOA_LOAD(p) _mm256_loadu_pd(p)
+#define SOA_STORE(p, v) _mm256_storeu_pd((p), (v))
+#define SOA_SET1(x) _mm256_set1_pd(x)
+#define SOA_ADD(a, b) _mm256_add_pd((a), (b))
+#define SOA_SUB(a, b) _mm256_sub_pd((a), (b))
+#define SOA_MUL(a, b) _mm256_mul_pd((a), (b))
+#define SOA_DIV(a, b) _mm256_div_pd((a), (b))
+#define SOA_SQRT(a) _mm256_sqrt_pd(a)
+#define SOA_NEG(a) _mm256_xor_pd((a), _mm256_set1_pd(-0.0))
+#define SOA_ABS(a) _mm256_andnot_pd(_mm256_set1_pd(-0.0), (a))
+#define SOA_GT(a, b) _mm256_cmp_pd((a), (b), _CMP_GT_OQ)
+#define SOA_LT(a, b) _mm256_cmp_pd((a), (b), _CMP_LT_OQ)
+#define SOA_MASK_AND(a, b) _mm256_and_pd((a), (b))
+#define SOA_SELECT(m, t, f) _mm256_blendv_pd((f), (t), (m))
+#define SOA_MASK_ANY(m) (_mm256_movemask_pd(m) != 0)
+#include "quaternion_soa_kernels.inc"
+#undef SOA_VEC
+#undef SOA_MASK
+#undef SOA_WIDTH
+#undef SOA_TARGET
+#undef SOA_NAME
+#undef SOA_LOAD
+#undef SOA_STORE
+#undef SOA_SET1
+#undef SOA_ADD
+#undef SOA_SUB
+#undef SOA_MUL
+#undef SOA_DIV
+#undef SOA_SQRT
+#undef SOA_NEG
+#undef SOA_ABS
+#undef SOA_GT
+#undef SOA_LT
+#undef SOA_MASK_AND
+#undef SOA_SELECT
+#undef SOA_MASK_ANY
+
+/* ---- AVX-512F: 8 lanes ------------------------------------------------ */
+
+#if defined(__x86_64__)
+#define ATTITUDE_SOA_AVX512 1
+
+#define SOA_VEC __m512d
+#define SOA_MASK __mmask8
+#define SOA_WIDTH 8
+#define SOA_TARGET __attribute__((target("avx512f")))
+#define SOA_NAME(op) soa_avx512_##op
+#define SOA_LOAD(p) _mm512_loadu_pd(p)
+#define SOA_STORE(p, v) _mm512_storeu_pd((p), (v))
+#define SOA_SET1(x) _mm512_set1_pd(x)
+#define SOA_ADD(a, b) _mm512_add_pd((a), (b))
+#define SOA_SUB(a, b) _mm512_sub_pd((a), (b))
+#define SOA_MUL(a, b) _mm512_mul_pd((a), (b))
+#define SOA_DIV(a, b) _mm512_div_pd((a), (b))
+#define SOA_SQRT(a) _mm512_sqrt_pd(a)
+/* _mm512_xor_pd needs AVX512DQ; flip the sign bit through the integer domain instead. */
+#define SOA_NEG(a) _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(a), \
+                                                        _mm512_set1_epi64((long long)0x8000000000000000ull)))
+#define SOA_ABS(a) _mm512_abs_pd(a)
+#define SOA_GT(a, b) _mm512_cmp_pd_mask((a), (b), _CMP_GT_OQ)
+#define SOA_LT(a, b) _mm512_cmp_pd_mask((a), (b), _CMP_LT_OQ)
+#define SOA_MASK_AND(a, b) ((__mmask8)((a) & (b)))
+#define SOA_SELECT(m, t, f) _mm512_mask_blend_pd((m), (f), (t))
+#define SOA_MASK_ANY(m) ((m) != 0)
+#include "quaternion_soa_kernels.inc"
+#undef SOA_VEC
+#undef SOA_MASK
+#undef SOA_WIDTH
+#undef SOA_TARGET
+#undef SOA_NAME
+#undef SOA_LOAD
+#undef SOA_STORE
+#undef SOA_SET1
+#undef SOA_ADD
+#undef SOA_SUB
+#undef SOA_MUL
+#undef SOA_DIV
+#undef SOA_SQRT
+#undef SOA_NEG
+#undef SOA_ABS
+#undef SOA_GT
+#undef SOA_LT
+#undef SOA_MASK_AND
+#undef SOA_SELECT
+#undef SOA_MASK_ANY
+#endif
+
+const QuaternionSoaKernels *quaternion_soa_sse2_kernels(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2") ? &soa_sse2_kernels : NULL;
+}
+
+const QuaternionSoaKernels *quaternion_soa_avx2_kernels(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? &soa_avx2_kernels : NULL;
+}
+
+const QuaternionSoaKernels *quaternion_soa_avx512_kernels(void) {
+#ifdef ATTITUDE_SOA_AVX512
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") ? &soa_avx512_kernels : NULL;
+#else
+    return NULL;
+#endif
+}
+
+#else
+
+const QuaternionSoaKernels *quaternion_soa_sse2_kernels(void) {
+    return NULL;
+}
+
+const QuaternionSoaKernels *quaternion_soa_avx2_kernels(void) {
+    return NULL;
+}
+
+const QuaternionSoaKernels *quaternion_soa_avx512_kernels(void) {
+    return NULL;
+}
+
+#endif
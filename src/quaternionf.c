@@ -0,0 +1,9 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/quaternion.h"
+#include "attitude/quaternion_inline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+#include <stdio.h>
+
+#include "quaternion_impl.inc"
@@ -0,0 +1,105 @@
+#ifndef ATTITUDE_ROTATION_SERIES_H
+#define ATTITUDE_ROTATION_SERIES_H
+
+/*
+ * Small-angle building blocks shared by the exponential/logarithm maps and the kinematics
+ * integrators. Include after attitude_real.h; every function is instantiated for the real_t
+ * of the including translation unit.
+ *
+ * Near zero the closed forms either divide 0 by 0 (sin(h)/h) or lose every significant digit
+ * (acos(w) for w ~ 1), so below the REAL_*_SERIES_LIMIT thresholds truncated Taylor series
+ * take over. The thresholds keep the first dropped term below machine epsilon, so both
+ * branches agree to rounding and the switch is invisible to callers.
+ */
+
+/* cos(h) and sin(h) / (2h) from the squared half-angle h2 = h^2. */
+static inline void half_angle_terms(real_t h2, real_t *c, real_t *half_sinc) {
+    if (h2 < REAL_SERIES_LIMIT) {
+        *c = REAL(1.0) + h2 * (-REAL(1.0) / REAL(2.0) + h2 * (REAL(1.0) / REAL(24.0) +
+             h2 * (-REAL(1.0) / REAL(720.0) + h2 * (REAL(1.0) / REAL(40320.0)))));
+        *half_sinc = REAL(0.5) + h2 * (-REAL(1.0) / REAL(12.0) + h2 * (REAL(1.0) / REAL(240.0) +
+                     h2 * (-REAL(1.0) / REAL(10080.0) + h2 * (REAL(1.0) / REAL(725760.0)))));
+    } else {
+        const real_t h = sqrt(h2);
+        *c = cos(h);
+        *half_sinc = REAL(0.5) * sin(h) / h;
+    }
+}
+
+/*
+ * 2 atan(s / w) / s for w > 0 and s >= 0, given s2 = s^2 and w: the factor that turns the
+ * vector part of a quaternion into its rotation vector. Scale-invariant in (s, w), so the
+ * quaternion need not be unit.
+ */
+static inline real_t log_scale(real_t s2, real_t w) {
+    const real_t x2 = s2 / (w * w);
+    if (x2 < REAL_ATAN_SERIES_LIMIT) {
+        return REAL(2.0) / w * (REAL(1.0) + x2 * (-REAL(1.0) / REAL(3.0) + x2 * (REAL(1.0) / REAL(5.0) +
+               x2 * (-REAL(1.0) / REAL(7.0) + x2 * (REAL(1.0) / REAL(9.0))))));
+    }
+    const real_t s = sqrt(s2);
+    return REAL(2.0) * atan2(s, w) / s;
+}
+
+/*
+ * cos(h), sinc(h) = sin(h) / h and the first two derivatives of sinc with respect to h2 = h^2,
+ * for differentiating exp() of a moving rotation vector (d cos / d h2 is -sinc / 2). The
+ * closed-form derivatives cancel like 1 / h2^2, so the series covers the same range as above.
+ */
+static inline void half_angle_jet(real_t h2, real_t *c, real_t *sinc, real_t *sinc_d1, real_t *sinc_d2) {
+    if (h2 < REAL_SERIES_LIMIT) {
+        *c = REAL(1.0) + h2 * (-REAL(1.0) / REAL(2.0) + h2 * (REAL(1.0) / REAL(24.0) +
+             h2 * (-REAL(1.0) / REAL(720.0) + h2 * (REAL(1.0) / REAL(40320.0)))));
+        *sinc = REAL(1.0) + h2 * (-REAL(1.0) / REAL(6.0) + h2 * (REAL(1.0) / REAL(120.0) +
+                h2 * (-REAL(1.0) / REAL(5040.0) + h2 * (REAL(1.0) / REAL(362880.0)))));
+        *sinc_d1 = -REAL(1.0) / REAL(6.0) + h2 * (REAL(1.0) / REAL(60.0) + h2 * (-REAL(1.0) / REAL(1680.0) +
+                   h2 * (REAL(1.0) / REAL(90720.0) + h2 * (-REAL(1.0) / REAL(7983360.0)))));
+        *sinc_d2 = REAL(1.0) / REAL(60.0) + h2 * (-REAL(1.0) / REAL(840.0) + h2 * (REAL(1.0) / REAL(30240.0) +
+                   h2 * (-REAL(1.0) / REAL(1995840.0) + h2 * (REAL(1.0) / REAL(207567360.0)))));
+    } else {
+        const real_t h = sqrt(h2);
+        *c = cos(h);
+        *sinc = sin(h) / h;
+        *sinc_d1 = (*c - *sinc) / (REAL(2.0) * h2);
+        *sinc_d2 = (-REAL(0.5) * *sinc - REAL(3.0) * *sinc_d1) / (REAL(2.0) * h2);
+    }
+}
+
+/*
+ * k(w) = acos(w) / sqrt(1 - w^2) and its first two derivatives in w, for w in (-1, 1]: the
+ * factor that turns the vector part of a unit quaternion into its logarithm when w itself is
+ * moving. Near w = 1 the closed forms cancel like 1 / (1 - w), so a series in x = 1 - w is used.
+ */
+static inline void acos_ratio_jet(real_t w, real_t *k, real_t *k_d1, real_t *k_d2) {
+    const real_t x = REAL(1.0) - w;
+    if (x < REAL(0.5) * REAL_SERIES_LIMIT) {
+        *k = REAL(1.0) + x * (REAL(1.0) / REAL(3.0) + x * (REAL(2.0) / REAL(15.0) + x * (REAL(2.0) / REAL(35.0) +
+             x * (REAL(8.0) / REAL(315.0) + x * (REAL(8.0) / REAL(693.0) + x * (REAL(16.0) / REAL(3003.0)))))));
+        *k_d1 = -(REAL(1.0) / REAL(3.0) + x * (REAL(4.0) / REAL(15.0) + x * (REAL(6.0) / REAL(35.0) +
+                x * (REAL(32.0) / REAL(315.0) + x * (REAL(40.0) / REAL(693.0) + x * (REAL(32.0) / REAL(1001.0)))))));
+        *k_d2 = REAL(4.0) / REAL(15.0) + x * (REAL(12.0) / REAL(35.0) + x * (REAL(32.0) / REAL(105.0) +
+                x * (REAL(160.0) / REAL(693.0) + x * (REAL(160.0) / REAL(1001.0) + x * (REAL(224.0) / REAL(2145.0))))));
+    } else {
+        const real_t s2 = x * (REAL(1.0) + w);
+        *k = acos(w) / sqrt(s2);
+        *k_d1 = (w * *k - REAL(1.0)) / s2;
+        *k_d2 = (*k + REAL(3.0) * w * *k_d1) / s2;
+    }
+}
+
+/*
+ * 1 / sqrt(n2) for a squared norm n2 > 0. Vectors that are renormalised every step sit within
+ * rounding-driven drift of unit length, where the series 1 - e/2 + 3e^2/8 in e = n2 - 1 replaces
+ * the square root and the division; its first dropped term, 5e^3/16, is below epsilon inside
+ * REAL_RENORM_LIMIT. Unlike a "skip if already close" test, every call pulls the norm back
+ * to one, so drift cannot accumulate across calls.
+ */
+static inline real_t inverse_norm(real_t n2) {
+    const real_t e = n2 - REAL(1.0);
+    if (fabs(e) < REAL_RENORM_LIMIT) {
+        return REAL(1.0) + e * (-REAL(0.5) + REAL(0.375) * e);
+    }
+    return REAL(1.0) / sqrt(n2);
+}
+
+#endif // ATTITUDE_ROTATION_SERIES_H
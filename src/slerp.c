@@ -0,0 +1,5 @@
+#include "attitude/slerp.h"
+#include "attitude_real.h"
+#include <stddef.h>
+
+#include "slerp_impl.inc"
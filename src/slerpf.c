@@ -0,0 +1,6 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/slerp.h"
+#include "attitude_real.h"
+#include <stddef.h>
+
+#include "slerp_impl.inc"
@@ -0,0 +1,7 @@
+#include "attitude/spline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "spline_impl.inc"
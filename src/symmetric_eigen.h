@@ -0,0 +1,88 @@
+#ifndef ATTITUDE_SYMMETRIC_EIGEN_H
+#define ATTITUDE_SYMMETRIC_EIGEN_H
+
+/*
+ * Small dense eigensolver shared by the Davenport q-method (wahba) and the quaternion average.
+ * Include after attitude_real.h; instantiated for the real_t of the including translation unit.
+ *
+ * Both problems reduce to the eigenvector of a symmetric 4x4 matrix with the largest
+ * eigenvalue. Cyclic Jacobi is slower than a characteristic-polynomial solve but needs no
+ * tolerance tuning and is accurate for clustered or repeated eigenvalues, which is what the
+ * reference solvers are for.
+ */
+
+/* Sweeps for the cyclic Jacobi iteration; convergence is quadratic, 4x4 needs about five. */
+#define SYMMETRIC_EIGEN_MAX_SWEEPS 16
+
+/* Eigenvector of the largest eigenvalue of the symmetric a (destroyed); unit norm, sign arbitrary. */
+static inline void symmetric4_dominant_eigenvector(real_t a[4][4], real_t v_out[4]) {
+    real_t v[4][4] = {
+        {REAL(1.0), REAL(0.0), REAL(0.0), REAL(0.0)},
+        {REAL(0.0), REAL(1.0), REAL(0.0), REAL(0.0)},
+        {REAL(0.0), REAL(0.0), REAL(1.0), REAL(0.0)},
+        {REAL(0.0), REAL(0.0), REAL(0.0), REAL(1.0)}
+    };
+
+    real_t scale = REAL(0.0);
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            scale += a[i][j] * a[i][j];
+        }
+    }
+    const real_t threshold = REAL_EPSILON * REAL_EPSILON * scale;
+
+    for (int sweep = 0; sweep < SYMMETRIC_EIGEN_MAX_SWEEPS; ++sweep) {
+        real_t off = REAL(0.0);
+        for (int p = 0; p < 3; ++p) {
+            for (int r = p + 1; r < 4; ++r) {
+                off += a[p][r] * a[p][r];
+            }
+        }
+        if (off <= threshold) {
+            break;
+        }
+        for (int p = 0; p < 3; ++p) {
+            for (int r = p + 1; r < 4; ++r) {
+                if (a[p][r] == REAL(0.0)) {
+                    continue;
+                }
+                // Rotation in the (p, r) plane that zeroes a[p][r] (Rutishauser's stable form).
+                const real_t theta = (a[r][r] - a[p][p]) / (REAL(2.0) * a[p][r]);
+                const real_t t = (theta >= REAL(0.0) ? REAL(1.0) : -REAL(1.0)) /
+                                 (fabs(theta) + sqrt(theta * theta + REAL(1.0)));
+                const real_t c = REAL(1.0) / sqrt(t * t + REAL(1.0));
+                const real_t s = t * c;
+                for (int i = 0; i < 4; ++i) {
+                    const real_t aip = a[i][p];
+                    const real_t air = a[i][r];
+                    a[i][p] = c * aip - s * air;
+                    a[i][r] = s * aip + c * air;
+                }
+                for (int i = 0; i < 4; ++i) {
+                    const real_t api = a[p][i];
+                    const real_t ari = a[r][i];
+                    a[p][i] = c * api - s * ari;
+                    a[r][i] = s * api + c * ari;
+                }
+                for (int i = 0; i < 4; ++i) {
+                    const real_t vip = v[i][p];
+                    const real_t vir = v[i][r];
+                    v[i][p] = c * vip - s * vir;
+                    v[i][r] = s * vip + c * vir;
+                }
+            }
+        }
+    }
+
+    int best = 0;
+    for (int i = 1; i < 4; ++i) {
+        if (a[i][i] > a[best][best]) {
+            best = i;
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        v_out[i] = v[i][best];
+    }
+}
+
+#endif // ATTITUDE_SYMMETRIC_EIGEN_H
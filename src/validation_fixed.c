@@ -0,0 +1,122 @@
+#include "attitude/validation.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "attitude/fixed_point.h"
+#include "attitude/quaternion.h"
+#include "validation_internal.h"
+
+/*
+ * Q1.30 fixture: each fixed-point result is compared with the double API applied to the same
+ * (exactly representable) inputs, so only the rounding of the integer path is measured.
+ * Tolerances are in units of the last place, 2^-30.
+ */
+#define FIXED_LSB (1.0 / (double)ATTITUDE_Q30_ONE)
+#define FIXED_ROUNDING_TOL (2.0 * FIXED_LSB)
+/* Rotation rounds the matrix entries first; each of three entries contributes up to one LSB. */
+#define FIXED_ROTATE_TOL (5.0 * FIXED_LSB)
+
+static int within(const int32_t *fixed, const double *expected, int count, double tolerance) {
+    for (int i = 0; i < count; ++i) {
+        if (fabs((double)fixed[i] * FIXED_LSB - expected[i]) > tolerance) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static uint32_t check_fixed_case(const double q_in[4], const double p_in[4], const double v_in[3]) {
+    int32_t q[4];
+    int32_t p[4];
+    int32_t v[3];
+    double qd[4];
+    double pd[4];
+    double vd[3];
+
+    if (!quaternion_q30_from_double(q_in, q) || !quaternion_q30_from_double(p_in, p)) {
+        return ATTITUDE_VALIDATION_FIXED_POINT;
+    }
+    quaternion_q30_to_double(q, qd);
+    quaternion_q30_to_double(p, pd);
+    for (int i = 0; i < 3; ++i) {
+        v[i] = (int32_t)lround(v_in[i] * (double)ATTITUDE_Q30_ONE);
+        vd[i] = (double)v[i] * FIXED_LSB;
+    }
+
+    uint32_t failures = 0;
+
+    int32_t product[4];
+    double expected_product[4];
+    quaternion_q30_multiply(q, p, product);
+    quaternion_multiply(qd, pd, expected_product);
+    if (!within(product, expected_product, 4, FIXED_ROUNDING_TOL)) {
+        failures |= ATTITUDE_VALIDATION_FIXED_POINT;
+    }
+
+    int32_t dcm[3][3];
+    double expected_dcm[3][3];
+    quaternion_q30_to_dcm(q, dcm);
+    quaternion_to_dcm(qd, expected_dcm);
+    if (!within(&dcm[0][0], &expected_dcm[0][0], 9, FIXED_ROUNDING_TOL)) {
+        failures |= ATTITUDE_VALIDATION_FIXED_POINT;
+    }
+
+    int32_t rotated[3];
+    double expected_rotated[3];
+    quaternion_q30_rotate_vector(q, v, rotated);
+    quaternion_rotate_vector(qd, vd, expected_rotated);
+    if (!within(rotated, expected_rotated, 3, FIXED_ROTATE_TOL)) {
+        failures |= ATTITUDE_VALIDATION_FIXED_POINT;
+    }
+
+    // Renormalising the drifted product; the reference divides by the exact norm.
+    double drifted[4];
+    double norm_sq = 0.0;
+    quaternion_q30_to_double(product, drifted);
+    for (int i = 0; i < 4; ++i) {
+        norm_sq += drifted[i] * drifted[i];
+    }
+    for (int i = 0; i < 4; ++i) {
+        drifted[i] /= sqrt(norm_sq);
+    }
+    if (!quaternion_q30_normalize(product) || !within(product, drifted, 4, FIXED_ROUNDING_TOL)) {
+        failures |= ATTITUDE_VALIDATION_FIXED_POINT;
+    }
+
+    return failures;
+}
+
+static uint32_t check_fixed_rejections(void) {
+    const double non_finite[4] = {NAN, 0.0, 0.0, 0.0};
+    int32_t zero[4] = {0, 0, 0, 0};
+    int32_t q[4];
+
+    if (quaternion_q30_from_double(non_finite, q) || quaternion_q30_normalize(zero)) {
+        return ATTITUDE_VALIDATION_INVALID_INPUT;
+    }
+    return 0;
+}
+
+uint32_t attitude_validation_fixed_point(void) {
+    /* Unit rotations (identity, half turns, a generic one) and a drifted non-unit quaternion. */
+    static const double quaternions[][4] = {
+        {1.0, 0.0, 0.0, 0.0},
+        {0.0, 1.0, 0.0, 0.0},
+        {0.0, 0.0, 0.0, -1.0},
+        {0.7071067811865476, 0.0, 0.7071067811865476, 0.0},
+        {0.8223631719059994, 0.0222600267, 0.4396797395, 0.3604234056},
+        {-0.1825741858, 0.3651483717, 0.5477225575, 0.7302967433},
+        {0.5000003, -0.4999998, 0.5000002, -0.4999997}
+    };
+    static const double vector[3] = {0.6, -0.75, 0.25};
+    const size_t count = sizeof(quaternions) / sizeof(quaternions[0]);
+    uint32_t failures = 0;
+
+    for (size_t index = 0; index < count; ++index) {
+        failures |= check_fixed_case(quaternions[index], quaternions[(index + 3) % count], vector);
+    }
+    failures |= check_fixed_rejections();
+    return failures;
+}
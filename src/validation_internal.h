@@ -0,0 +1,13 @@
+#ifndef ATTITUDE_VALIDATION_INTERNAL_H
+#define ATTITUDE_VALIDATION_INTERNAL_H
+
+#include <stdint.h>
+
+/* Per-precision fixture runners; each returns AttitudeValidationFailure stage bits. */
+uint32_t attitude_validation_conversions(void);
+uint32_t attitude_validation_conversionsf(void);
+
+/* Q1.30 fixture; returns ATTITUDE_VALIDATION_FIXED_POINT or ATTITUDE_VALIDATION_INVALID_INPUT. */
+uint32_t attitude_validation_fixed_point(void);
+
+#endif // ATTITUDE_VALIDATION_INTERNAL_H
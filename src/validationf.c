@@ -0,0 +1,12 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/validation.h"
+
+#include <stddef.h>
+
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+#include "attitude_real.h"
+#include "validation_internal.h"
+
+#include "validation_impl.inc"
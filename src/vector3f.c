@@ -0,0 +1,8 @@
+#define ATTITUDE_REAL_FLOAT
+#include "attitude/vector3.h"
+#include "attitude/vector3_inline.h"
+#include "attitude_real.h"
+#include "rotation_series.h"
+#include <stddef.h>
+
+#include "vector3_impl.inc"
@@ -0,0 +1,9 @@
+#include "attitude/quaternion.h"
+#include "attitude/wahba.h"
+#include "attitude_real.h"
+#include "symmetric_eigen.h"
+#include <stddef.h>
+#include <string.h>
+
+
+#include "wahba_impl.inc"
@@ -0,0 +1,289 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/ahrs.h"
+#include "attitude/euler.h"
+#include "attitude/kinematics.h"
+#include "attitude/quaternion.h"
+
+#define DT 0.01
+#define GRAVITY 9.81
+
+/* Horizontal component along world x, pointing down (z up) at ~65 degrees dip. */
+static const double k_field_world[3] = {0.21, 0.0, -0.45};
+
+/* Rotation angle between two attitudes (rad); sign-insensitive. */
+static double attitude_error(const double a[4], const double b[4]) {
+    double conjugate[4];
+    double difference[4];
+    quaternion_inverse(a, conjugate);
+    quaternion_multiply(conjugate, b, difference);
+    const double s = sqrt(difference[1] * difference[1] + difference[2] * difference[2] + difference[3] * difference[3]);
+    return 2.0 * atan2(s, fabs(difference[0]));
+}
+
+/* Angle between the world-up directions seen in the body frame; what an IMU-only filter observes. */
+static double tilt_error(const double a[4], const double b[4]) {
+    double conjugate[4];
+    double up_a[3];
+    double up_b[3];
+    const double up[3] = {0.0, 0.0, 1.0};
+    quaternion_inverse(a, conjugate);
+    quaternion_rotate_vector(conjugate, up, up_a);
+    quaternion_inverse(b, conjugate);
+    quaternion_rotate_vector(conjugate, up, up_b);
+    const double dot = up_a[0] * up_b[0] + up_a[1] * up_b[1] + up_a[2] * up_b[2];
+    return acos(fmin(1.0, dot));
+}
+
+/* Noise-free accelerometer and magnetometer readings for a stationary body at attitude q. */
+static void sense(const double q[4], double accel[3], double mag[3]) {
+    double conjugate[4];
+    const double up[3] = {0.0, 0.0, GRAVITY};
+    quaternion_inverse(q, conjugate);
+    quaternion_rotate_vector(conjugate, up, accel);
+    quaternion_rotate_vector(conjugate, k_field_world, mag);
+}
+
+static double body_rate(double t, int axis) {
+    switch (axis) {
+    case 0:
+        return 0.5 * sin(t);
+    case 1:
+        return 0.3 * cos(0.7 * t);
+    default:
+        return 0.2;
+    }
+}
+
+static int check_static_convergence(void) {
+    const EulerAngles e = {0.5, -0.4, 2.0, EULER_ZYX};
+    const double gyro[3] = {0.0, 0.0, 0.0};
+    double truth[4];
+    double accel[3];
+    double mag[3];
+    euler_to_quaternion(&e, truth);
+    sense(truth, accel, mag);
+
+    MahonyFilter mahony;
+    MadgwickFilter madgwick;
+    MahonyFilter mahony_imu;
+    ahrs_mahony_init(&mahony, NULL, 2.0, 0.0);
+    ahrs_madgwick_init(&madgwick, NULL, 0.1);
+    ahrs_mahony_init(&mahony_imu, NULL, 2.0, 0.0);
+    // Heading converges slowest: its error signal is scaled by the horizontal field squared.
+    for (int n = 0; n < 12000; ++n) {
+        ahrs_mahony_update_marg(&mahony, gyro, accel, mag, DT);
+        ahrs_madgwick_update_marg(&madgwick, gyro, accel, mag, DT);
+        ahrs_mahony_update_imu(&mahony_imu, gyro, accel, DT);
+    }
+
+    // Madgwick's normalised step keeps it within about beta dt of the fixed point.
+    if (attitude_error(mahony.q, truth) > 1e-8 || attitude_error(madgwick.q, truth) > 2e-3 ||
+        tilt_error(mahony_imu.q, truth) > 1e-8) {
+        printf("FAIL: static convergence mahony %.3g madgwick %.3g mahony_imu tilt %.3g\n",
+               attitude_error(mahony.q, truth), attitude_error(madgwick.q, truth), tilt_error(mahony_imu.q, truth));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_bias_estimation(void) {
+    const double bias[3] = {0.01, -0.02, 0.015};
+    const EulerAngles e = {-0.3, 0.2, -1.0, EULER_ZYX};
+    double truth[4];
+    double accel[3];
+    double mag[3];
+    euler_to_quaternion(&e, truth);
+    sense(truth, accel, mag);
+
+    MahonyFilter filter;
+    ahrs_mahony_init(&filter, truth, 1.0, 0.3);
+    for (int n = 0; n < 30000; ++n) {
+        ahrs_mahony_update_marg(&filter, bias, accel, mag, DT);
+    }
+    for (int i = 0; i < 3; ++i) {
+        if (fabs(filter.integral[i] + bias[i]) > 1e-6) {
+            printf("FAIL: Mahony integral %g does not cancel bias %g\n", filter.integral[i], bias[i]);
+            return 0;
+        }
+    }
+    if (attitude_error(filter.q, truth) > 1e-6) {
+        printf("FAIL: Mahony attitude with gyro bias off by %.3g\n", attitude_error(filter.q, truth));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_tracking(void) {
+    double truth[4] = {1.0, 0.0, 0.0, 0.0};
+    MahonyFilter mahony;
+    MadgwickFilter madgwick;
+    MadgwickFilter madgwick_imu;
+    ahrs_mahony_init(&mahony, truth, 1.0, 0.1);
+    ahrs_madgwick_init(&madgwick, truth, 0.05);
+    ahrs_madgwick_init(&madgwick_imu, truth, 0.05);
+    double worst_mahony = 0.0;
+    double worst_madgwick = 0.0;
+    double worst_tilt = 0.0;
+
+    for (int n = 0; n < 3000; ++n) {
+        const double gyro[3] = {body_rate(n * DT, 0), body_rate(n * DT, 1), body_rate(n * DT, 2)};
+        double accel[3];
+        double mag[3];
+        // The correction is evaluated at the attitude before the step, so sense there.
+        sense(truth, accel, mag);
+        kinematics_integrate_exp(truth, gyro, DT, truth);
+
+        ahrs_mahony_update_marg(&mahony, gyro, accel, mag, DT);
+        ahrs_madgwick_update_marg(&madgwick, gyro, accel, mag, DT);
+        ahrs_madgwick_update_imu(&madgwick_imu, gyro, accel, DT);
+        worst_mahony = fmax(worst_mahony, attitude_error(mahony.q, truth));
+        worst_madgwick = fmax(worst_madgwick, attitude_error(madgwick.q, truth));
+        worst_tilt = fmax(worst_tilt, tilt_error(madgwick_imu.q, truth));
+    }
+
+    if (worst_mahony > 1e-9 || worst_madgwick > 2e-3 || worst_tilt > 2e-3) {
+        printf("FAIL: tracking error mahony %.3g madgwick %.3g madgwick_imu tilt %.3g\n", worst_mahony,
+               worst_madgwick, worst_tilt);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_replay(void) {
+    enum { SAMPLES = 500 };
+    static double gyro[SAMPLES][3];
+    static double accel[SAMPLES][3];
+    static double mag[SAMPLES][3];
+    static double q_replay[SAMPLES][4];
+    double truth[4] = {0.5, 0.5, -0.5, 0.5};
+
+    for (int n = 0; n < SAMPLES; ++n) {
+        for (int i = 0; i < 3; ++i) {
+            gyro[n][i] = body_rate(n * DT, i) + 0.01;
+        }
+        kinematics_integrate_exp(truth, gyro[n], DT, truth);
+        sense(truth, accel[n], mag[n]);
+    }
+    gyro[100][1] = NAN;
+
+    MahonyFilter replayed;
+    MahonyFilter stepped;
+    ahrs_mahony_init(&replayed, NULL, 1.5, 0.2);
+    stepped = replayed;
+    if (ahrs_mahony_replay(&replayed, &gyro[0][0], &accel[0][0], &mag[0][0], SAMPLES, DT, &q_replay[0][0])) {
+        printf("FAIL: Mahony replay accepted a NaN sample\n");
+        return 0;
+    }
+    for (int n = 0; n < SAMPLES; ++n) {
+        ahrs_mahony_update_marg(&stepped, gyro[n], accel[n], mag[n], DT);
+        if (memcmp(q_replay[n], stepped.q, sizeof(stepped.q)) != 0) {
+            printf("FAIL: Mahony replay differs from single updates at sample %d\n", n);
+            return 0;
+        }
+    }
+    if (memcmp(&replayed, &stepped, sizeof(stepped)) != 0) {
+        printf("FAIL: Mahony replay final state\n");
+        return 0;
+    }
+
+    MadgwickFilter replayed_imu;
+    MadgwickFilter stepped_imu;
+    ahrs_madgwick_init(&replayed_imu, NULL, 0.2);
+    stepped_imu = replayed_imu;
+    ahrs_madgwick_replay(&replayed_imu, &gyro[0][0], &accel[0][0], NULL, SAMPLES, DT, NULL);
+    for (int n = 0; n < SAMPLES; ++n) {
+        ahrs_madgwick_update_imu(&stepped_imu, gyro[n], accel[n], DT);
+    }
+    if (memcmp(&replayed_imu, &stepped_imu, sizeof(stepped_imu)) != 0) {
+        printf("FAIL: Madgwick IMU replay differs from single updates\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_degenerate_inputs(void) {
+    MahonyFilter mahony;
+    MadgwickFilter madgwick;
+    const double zero_q[4] = {0.0, 0.0, 0.0, 0.0};
+    const double gyro[3] = {0.1, -0.2, 0.3};
+    const double accel[3] = {0.0, 0.0, 9.81};
+    const double zero[3] = {0.0, 0.0, 0.0};
+    const double nan_gyro[3] = {0.0, NAN, 0.0};
+
+    if (ahrs_mahony_init(NULL, NULL, 1.0, 0.0) || ahrs_mahony_init(&mahony, NULL, -1.0, 0.0) ||
+        ahrs_mahony_init(&mahony, zero_q, 1.0, 0.0) || ahrs_madgwick_init(&madgwick, NULL, NAN) ||
+        !ahrs_mahony_init(&mahony, NULL, 1.0, 0.1) || !ahrs_madgwick_init(&madgwick, NULL, 0.1)) {
+        printf("FAIL: AHRS init validation\n");
+        return 0;
+    }
+
+    const MahonyFilter before = mahony;
+    if (ahrs_mahony_update_imu(&mahony, nan_gyro, accel, DT) || ahrs_mahony_update_imu(&mahony, gyro, accel, INFINITY) ||
+        ahrs_mahony_update_marg(&mahony, gyro, accel, NULL, DT) || ahrs_madgwick_update_imu(NULL, gyro, accel, DT) ||
+        ahrs_mahony_replay(&mahony, NULL, accel, NULL, 1, DT, NULL) || !ahrs_madgwick_replay(&madgwick, NULL, NULL, NULL, 0, DT, NULL) ||
+        memcmp(&before, &mahony, sizeof(before)) != 0) {
+        printf("FAIL: AHRS update rejections\n");
+        return 0;
+    }
+
+    // Free fall: no correction, so the update is plain gyro integration.
+    double expected[4];
+    kinematics_integrate_exp(mahony.q, gyro, DT, expected);
+    if (!ahrs_mahony_update_imu(&mahony, gyro, zero, DT) || attitude_error(mahony.q, expected) > 1e-15 ||
+        mahony.integral[0] != 0.0) {
+        printf("FAIL: Mahony with zero accelerometer\n");
+        return 0;
+    }
+
+    // A zero magnetometer falls back to the IMU update.
+    MadgwickFilter marg = madgwick;
+    ahrs_madgwick_update_imu(&madgwick, gyro, accel, DT);
+    if (!ahrs_madgwick_update_marg(&marg, gyro, accel, zero, DT) || memcmp(&marg, &madgwick, sizeof(marg)) != 0) {
+        printf("FAIL: Madgwick with zero magnetometer\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const EulerAngles e = {0.5, -0.4, 2.0, EULER_ZYX};
+    double truth[4];
+    double accel[3];
+    double mag[3];
+    euler_to_quaternion(&e, truth);
+    sense(truth, accel, mag);
+    const float gyrof[3] = {0.0f, 0.0f, 0.0f};
+    const float accelf[3] = {(float)accel[0], (float)accel[1], (float)accel[2]};
+    const float magf[3] = {(float)mag[0], (float)mag[1], (float)mag[2]};
+
+    MahonyFilterf mahony;
+    MadgwickFilterf madgwick;
+    ahrsf_mahony_init(&mahony, NULL, 2.0f, 0.0f);
+    ahrsf_madgwick_init(&madgwick, NULL, 0.1f);
+    for (int n = 0; n < 12000; ++n) {
+        ahrsf_mahony_update_marg(&mahony, gyrof, accelf, magf, (float)DT);
+        ahrsf_madgwick_update_marg(&madgwick, gyrof, accelf, magf, (float)DT);
+    }
+    const double mahony_q[4] = {mahony.q[0], mahony.q[1], mahony.q[2], mahony.q[3]};
+    const double madgwick_q[4] = {madgwick.q[0], madgwick.q[1], madgwick.q[2], madgwick.q[3]};
+    // Float stalls once kp e dt falls below an ulp of q: a dead zone of a few 1e-5 rad at kp dt = 0.02.
+    if (attitude_error(mahony_q, truth) > 1e-4 || attitude_error(madgwick_q, truth) > 2e-3) {
+        printf("FAIL: float AHRS convergence mahony %.3g madgwick %.3g\n", attitude_error(mahony_q, truth),
+               attitude_error(madgwick_q, truth));
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_static_convergence() || !check_bias_estimation() || !check_tracking() || !check_replay() ||
+        !check_degenerate_inputs() || !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: Mahony and Madgwick AHRS filters\n");
+    return 0;
+}
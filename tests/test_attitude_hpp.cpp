@@ -0,0 +1,194 @@
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+
+#include "attitude/attitude.hpp"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+using attitude::Dcmd;
+using attitude::Dcmf;
+using attitude::Quaterniond;
+using attitude::Quaternionf;
+using attitude::Vec3d;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+constexpr double absolute(double x) { return x < 0.0 ? -x : x; }
+
+/* Compile-time folding: these only build if every step is a constant expression. */
+constexpr Quaterniond kImuToBody = Quaterniond::from_euler(0.0, 0.0, kPi / 2.0);
+constexpr Dcmd kCameraToBody = Dcmd::from_euler(-kPi / 2.0, 0.0, -kPi / 2.0, EULER_XYZ);
+constexpr Vec3d kForwardInBody = kImuToBody.rotate(Vec3d{{1.0, 0.0, 0.0}});
+constexpr Quaterniond kChained = kImuToBody * Quaterniond::from_axis_angle(Vec3d{{0.0, 0.0, 2.0}}, -kPi / 2.0);
+constexpr Quaterniond kFromMatrix = (kCameraToBody * kCameraToBody.transpose()).to_quaternion();
+
+static_assert(absolute(kForwardInBody[0]) < 1e-15 && absolute(kForwardInBody[1] - 1.0) < 1e-15,
+              "yaw of 90 degrees takes x onto y");
+static_assert(absolute(kChained[0] - 1.0) < 1e-15 && absolute(kChained[3]) < 1e-15,
+              "composition with the inverse rotation is the identity");
+static_assert(absolute(kFromMatrix[0] - 1.0) < 1e-15, "R R^T is the identity");
+static_assert(absolute(attitude::detail::sqrt(2.0) * attitude::detail::sqrt(2.0) - 2.0) < 1e-15,
+              "constexpr sqrt");
+
+/* Intrinsic XYZ with zero pitch is R_x(roll) R_z(yaw). */
+constexpr Dcmd kElementary = Quaterniond::from_axis_angle(Vec3d{{1.0, 0.0, 0.0}}, -kPi / 2.0).to_dcm() *
+                             Quaterniond::from_axis_angle(Vec3d{{0.0, 0.0, 1.0}}, -kPi / 2.0).to_dcm();
+static_assert(absolute(kCameraToBody[2][0] - kElementary[2][0]) < 1e-15 &&
+                  absolute(kCameraToBody[1][2] - kElementary[1][2]) < 1e-15 &&
+                  absolute(kCameraToBody[2][0] - 1.0) < 1e-15,
+              "Euler order matches the product of elementary rotations");
+
+unsigned int g_seed = 7u;
+
+double random_unit() {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return static_cast<double>(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+double max_difference(const double *a, const double *b, int count) {
+    double worst = 0.0;
+    for (int i = 0; i < count; ++i) {
+        worst = std::fmax(worst, std::fabs(a[i] - b[i]));
+    }
+    return worst;
+}
+
+bool check_series() {
+    double worst = 0.0;
+    for (int n = 0; n <= 20000; ++n) {
+        const double angle = -20.0 + 40.0 * n / 20000.0;
+        const attitude::detail::SinCos<double> sc = attitude::detail::sin_cos(angle);
+        worst = std::fmax(worst, std::fmax(std::fabs(sc.s - std::sin(angle)), std::fabs(sc.c - std::cos(angle))));
+        const double x = std::ldexp(1.0 + 0.5 * (random_unit() + 1.0), n % 200 - 100);
+        worst = std::fmax(worst, std::fabs(attitude::detail::sqrt(x) - std::sqrt(x)) / std::sqrt(x));
+    }
+    if (worst > 4.0 * DBL_EPSILON) {
+        std::printf("FAIL: constexpr sin/cos/sqrt error %.3g\n", worst);
+        return false;
+    }
+    return true;
+}
+
+bool check_euler_against_c() {
+    double worst = 0.0;
+    for (int order = 0; order < EULER_ORDER_COUNT; ++order) {
+        for (int n = 0; n < 200; ++n) {
+            const EulerAngles e = {3.0 * random_unit(), 1.5 * random_unit(), 3.0 * random_unit(),
+                                   static_cast<EulerOrder>(order)};
+            double q[4];
+            double dcm[3][3];
+            euler_to_quaternion(&e, q);
+            euler_to_dcm(&e, dcm);
+
+            const Quaterniond quat = Quaterniond::from_euler(e.roll, e.pitch, e.yaw, e.order);
+            const Dcmd matrix = Dcmd::from_euler(e.roll, e.pitch, e.yaw, e.order);
+            worst = std::fmax(worst, max_difference(quat.data(), q, 4));
+            worst = std::fmax(worst, max_difference(&matrix.m[0][0], &dcm[0][0], 9));
+        }
+    }
+    if (worst > 8.0 * DBL_EPSILON) {
+        std::printf("FAIL: from_euler differs from the C conversions by %.3g\n", worst);
+        return false;
+    }
+
+    const Quaterniond invalid = Quaterniond::from_euler(0.1, 0.2, 0.3, EULER_ORDER_COUNT);
+    if (!std::isnan(invalid[0])) {
+        std::printf("FAIL: from_euler accepted an invalid order\n");
+        return false;
+    }
+    return true;
+}
+
+bool check_interop() {
+    for (int n = 0; n < 1000; ++n) {
+        const Quaterniond a = Quaterniond::from_axis_angle(Vec3d{{random_unit(), random_unit(), random_unit()}},
+                                                           3.0 * random_unit());
+        const Quaterniond b = Quaterniond::from_euler(random_unit(), random_unit(), random_unit());
+        const Vec3d v = {{random_unit(), random_unit(), random_unit()}};
+
+        // The value types go straight into the C API without copies or casts.
+        Quaterniond product;
+        quaternion_multiply(a.data(), b.data(), product.data());
+        Dcmd dcm;
+        quaternion_to_dcm(a.data(), dcm.data());
+        Vec3d rotated;
+        quaternion_rotate_vector(a.data(), v.data(), rotated.data());
+        Vec3d applied;
+        dcm_apply(dcm.data(), v.data(), applied.data());
+        Quaterniond back;
+        dcm_to_quaternion(dcm.data(), back.data());
+
+        const Quaterniond cpp_product = a * b;
+        const Dcmd cpp_dcm = a.to_dcm();
+        const Vec3d cpp_rotated = a.rotate(v);
+        const Vec3d cpp_applied = cpp_dcm * v;
+        const Quaterniond cpp_back = cpp_dcm.to_quaternion();
+        if (max_difference(product.data(), cpp_product.data(), 4) > 4.0 * DBL_EPSILON ||
+            max_difference(&dcm.m[0][0], &cpp_dcm.m[0][0], 9) > 4.0 * DBL_EPSILON ||
+            max_difference(rotated.data(), cpp_rotated.data(), 3) > 4.0 * DBL_EPSILON ||
+            max_difference(applied.data(), cpp_applied.data(), 3) > 4.0 * DBL_EPSILON ||
+            max_difference(back.data(), cpp_back.data(), 4) > 4.0 * DBL_EPSILON) {
+            std::printf("FAIL: C++ types disagree with the C API\n");
+            return false;
+        }
+
+        // A C array converts to the wrapper; R R^T of a quaternion-built DCM is I to ~13 ulp.
+        double raw[4];
+        quaternion_multiply(b.data(), a.data(), raw);
+        const Quaterniond wrapped = Quaterniond::from_array(raw);
+        if (max_difference(wrapped.data(), (b * a).data(), 4) > 4.0 * DBL_EPSILON ||
+            max_difference((cpp_dcm * cpp_dcm.transpose()).data()[1], Dcmd::identity()[1], 3) > 16.0 * DBL_EPSILON) {
+            std::printf("FAIL: from_array / transpose\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool check_float() {
+    const EulerAnglesf e = {0.3f, -0.4f, 1.2f, EULER_YXZ};
+    float q[4];
+    float dcm[3][3];
+    eulerf_to_quaternion(&e, q);
+    eulerf_to_dcm(&e, dcm);
+    constexpr Quaternionf folded = Quaternionf::from_euler(0.3f, -0.4f, 1.2f, EULER_YXZ);
+    const Dcmf matrix = folded.to_dcm();
+    for (int i = 0; i < 4; ++i) {
+        if (std::fabs(folded[i] - q[i]) > 4.0f * FLT_EPSILON) {
+            std::printf("FAIL: Quaternionf::from_euler\n");
+            return false;
+        }
+    }
+    for (int i = 0; i < 9; ++i) {
+        if (std::fabs(matrix.m[i / 3][i % 3] - dcm[i / 3][i % 3]) > 4.0f * FLT_EPSILON) {
+            std::printf("FAIL: Quaternionf::to_dcm\n");
+            return false;
+        }
+    }
+    float rotated[3];
+    const float v[3] = {1.0f, -2.0f, 0.5f};
+    quaternionf_rotate_vector(folded.data(), v, rotated);
+    const attitude::Vec3f cpp_rotated = folded.rotate(attitude::Vec3f::from_array(v));
+    for (int i = 0; i < 3; ++i) {
+        if (std::fabs(cpp_rotated[i] - rotated[i]) > 8.0f * FLT_EPSILON) {
+            std::printf("FAIL: Quaternionf::rotate\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main() {
+    if (!check_series() || !check_euler_against_c() || !check_interop() || !check_float()) {
+        return 1;
+    }
+
+    std::printf("PASS: constexpr C++ attitude types\n");
+    return 0;
+}
@@ -0,0 +1,389 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/attitude_log.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+/* Not a multiple of the block capacity, so every log ends with a short block. */
+#define COUNT 2500
+#define BLOCK_RECORDS 300
+
+static unsigned int g_seed = 0x10c5eedu;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+static double g_timestamps[COUNT];
+static double g_quaternions[COUNT][4];
+static double g_rates[COUNT][3];
+
+/* In-memory sink; stored as doubles so the reader can open it in place. */
+typedef struct {
+    double storage[COUNT * 8 + 1024];
+    size_t size;
+    size_t limit; ///< Writes that would grow the log past this fail.
+} MemorySink;
+
+static MemorySink g_sink;
+static unsigned char g_block[BLOCK_RECORDS * 64];
+
+static int memory_sink(void *context, const void *data, size_t size) {
+    MemorySink *sink = (MemorySink *)context;
+    if (sink->size + size > sink->limit) {
+        return 0;
+    }
+    memcpy((unsigned char *)sink->storage + sink->size, data, size);
+    sink->size += size;
+    return 1;
+}
+
+static void reset_sink(size_t limit) {
+    g_sink.size = 0;
+    g_sink.limit = limit;
+}
+
+static void fill_records(void) {
+    for (size_t i = 0; i < COUNT; ++i) {
+        g_timestamps[i] = 1.0e4 + 0.0025 * (double)i;
+        for (int k = 0; k < 4; ++k) {
+            g_quaternions[i][k] = random_unit();
+        }
+        quaternion_normalize(g_quaternions[i]);
+        for (int k = 0; k < 3; ++k) {
+            g_rates[i][k] = 4.0 * random_unit();
+        }
+    }
+    g_quaternions[17][2] = NAN;
+}
+
+static int write_log(uint32_t flags, size_t count) {
+    AttitudeLogWriter writer;
+    if (!attitude_log_writer_init(&writer, flags, g_block, BLOCK_RECORDS * ATTITUDE_LOG_RECORD_BYTES(flags),
+                                  memory_sink, &g_sink) ||
+        writer.capacity != BLOCK_RECORDS) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!attitude_log_writer_append(&writer, g_timestamps[i], g_quaternions[i], g_rates[i])) {
+            return 0;
+        }
+        /* Only whole blocks reach the sink before the close. */
+        if (writer.written != (i + 1) / BLOCK_RECORDS * BLOCK_RECORDS) {
+            return 0;
+        }
+    }
+    return attitude_log_writer_close(&writer) && writer.written == count;
+}
+
+static int same_bits(const double *a, const double *b, size_t n) {
+    return memcmp(a, b, n * sizeof(double)) == 0;
+}
+
+/* Reads the whole log and compares it bit for bit with the records written. */
+static int check_contents(AttitudeLogReader *reader, uint32_t flags, size_t expected) {
+    AttitudeLogBlock block;
+    size_t seen = 0;
+    while (attitude_log_reader_next(reader, &block)) {
+        if (block.count == 0 || block.count > BLOCK_RECORDS || seen + block.count > expected ||
+            !same_bits(block.timestamps, g_timestamps + seen, block.count) ||
+            !same_bits(block.quaternions, g_quaternions[seen], 4 * block.count) ||
+            ((flags & ATTITUDE_LOG_HAS_RATE) ? !same_bits(block.rates, g_rates[seen], 3 * block.count)
+                                              : block.rates != NULL)) {
+            printf("FAIL: block at record %zu does not match the records written\n", seen);
+            return 0;
+        }
+        seen += block.count;
+    }
+    if (seen != expected || reader->damaged || attitude_log_reader_count(reader) != expected) {
+        printf("FAIL: read %zu of %zu records (damaged %d)\n", seen, expected, reader->damaged);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_round_trip(void) {
+    const uint32_t all_flags[2] = {0, ATTITUDE_LOG_HAS_RATE};
+    for (int f = 0; f < 2; ++f) {
+        const uint32_t flags = all_flags[f];
+        reset_sink(sizeof(g_sink.storage));
+        if (!write_log(flags, COUNT)) {
+            printf("FAIL: writing log with flags %u\n", (unsigned)flags);
+            return 0;
+        }
+        const size_t blocks = (COUNT + BLOCK_RECORDS - 1) / BLOCK_RECORDS;
+        if (g_sink.size != ATTITUDE_LOG_HEADER_BYTES + blocks * ATTITUDE_LOG_BLOCK_HEADER_BYTES +
+                               COUNT * ATTITUDE_LOG_RECORD_BYTES(flags)) {
+            printf("FAIL: log size %zu\n", g_sink.size);
+            return 0;
+        }
+        AttitudeLogReader reader;
+        if (!attitude_log_reader_open_memory(&reader, g_sink.storage, g_sink.size) || reader.flags != flags ||
+            reader.version != ATTITUDE_LOG_VERSION || !check_contents(&reader, flags, COUNT)) {
+            printf("FAIL: reading log with flags %u\n", (unsigned)flags);
+            return 0;
+        }
+        attitude_log_reader_rewind(&reader);
+        if (!check_contents(&reader, flags, COUNT)) {
+            return 0;
+        }
+    }
+
+    reset_sink(sizeof(g_sink.storage));
+    AttitudeLogReader reader;
+    if (!write_log(0, 0) || g_sink.size != ATTITUDE_LOG_HEADER_BYTES ||
+        !attitude_log_reader_open_memory(&reader, g_sink.storage, g_sink.size) || !check_contents(&reader, 0, 0)) {
+        printf("FAIL: empty log\n");
+        return 0;
+    }
+    return 1;
+}
+
+/* The documented layout, byte for byte, so other tools can read the format without this code. */
+static int check_layout(void) {
+    reset_sink(sizeof(g_sink.storage));
+    AttitudeLogWriter writer;
+    const double q[4] = {0.5, -0.5, 0.5, -0.5};
+    const double w[3] = {1.0, 2.0, 3.0};
+    if (!attitude_log_writer_init(&writer, ATTITUDE_LOG_HAS_RATE, g_block, sizeof(g_block), memory_sink, &g_sink) ||
+        !attitude_log_writer_append(&writer, 2.0, q, w) || !attitude_log_writer_append(&writer, 4.0, q, w) ||
+        !attitude_log_writer_close(&writer)) {
+        printf("FAIL: writing layout log\n");
+        return 0;
+    }
+    const unsigned char *bytes = (const unsigned char *)g_sink.storage;
+    static const unsigned char header[16] = {'A', 'T', 'T', 'I', 'T', 'L', 'O', 'G', 1, 0, 64, 0, 1, 0, 0, 0};
+    static const unsigned char block[8] = {'A', 'B', 'L', 'K', 2, 0, 0, 0};
+    /* 2.0 and -0.5 as little-endian IEEE 754 doubles. */
+    static const unsigned char two[8] = {0, 0, 0, 0, 0, 0, 0, 0x40};
+    static const unsigned char minus_half[8] = {0, 0, 0, 0, 0, 0, 0xe0, 0xbf};
+    const unsigned char *columns = bytes + 80;
+    int ok = g_sink.size == 64 + 16 + 2 * 64 && memcmp(bytes, header, sizeof(header)) == 0 &&
+             memcmp(bytes + 64, block, sizeof(block)) == 0 && memcmp(columns, two, 8) == 0 &&
+             memcmp(columns + 16 + 8, minus_half, 8) == 0;
+    for (size_t i = 16; i < 64 && ok; ++i) {
+        ok = bytes[i] == 0;
+    }
+    if (!ok) {
+        printf("FAIL: on-disk layout\n");
+    }
+    return ok;
+}
+
+/* Blocks are plain double arrays the batch functions can work on in place. */
+static int check_zero_copy_batch(void) {
+    reset_sink(sizeof(g_sink.storage));
+    AttitudeLogReader reader;
+    AttitudeLogBlock block;
+    if (!write_log(0, COUNT) || !attitude_log_reader_open_memory(&reader, g_sink.storage, g_sink.size)) {
+        printf("FAIL: writing batch log\n");
+        return 0;
+    }
+    size_t seen = 0;
+    while (attitude_log_reader_next(&reader, &block)) {
+        if ((const void *)block.quaternions < (const void *)g_sink.storage ||
+            (const void *)(block.quaternions + 4 * block.count) >
+                (const void *)((const unsigned char *)g_sink.storage + g_sink.size)) {
+            printf("FAIL: block does not point into the log\n");
+            return 0;
+        }
+        /* Zeroed so the struct padding compares equal. */
+        EulerAngles batch[BLOCK_RECORDS] = {{0}};
+        EulerAngles copied[BLOCK_RECORDS] = {{0}};
+        const int expect_ok = seen > 17 || seen + block.count <= 17;
+        if (euler_from_quaternions(block.quaternions, block.count, EULER_ZYX, batch) != expect_ok) {
+            printf("FAIL: batch result on block at record %zu\n", seen);
+            return 0;
+        }
+        euler_from_quaternions(g_quaternions[seen], block.count, EULER_ZYX, copied);
+        if (memcmp(batch, copied, block.count * sizeof(EulerAngles)) != 0) {
+            printf("FAIL: batch Euler angles of block at record %zu\n", seen);
+            return 0;
+        }
+        seen += block.count;
+    }
+    return seen == COUNT;
+}
+
+static int check_damaged(void) {
+    reset_sink(sizeof(g_sink.storage));
+    if (!write_log(ATTITUDE_LOG_HAS_RATE, COUNT)) {
+        return 0;
+    }
+    const size_t full = g_sink.size;
+    const size_t block_bytes = ATTITUDE_LOG_BLOCK_HEADER_BYTES + BLOCK_RECORDS * 64;
+    AttitudeLogReader reader;
+
+    /* A reset during a block write: the complete blocks before it are still readable. */
+    const size_t cut = ATTITUDE_LOG_HEADER_BYTES + 3 * block_bytes + 1000;
+    if (!attitude_log_reader_open_memory(&reader, g_sink.storage, cut) ||
+        attitude_log_reader_count(&reader) != 3 * BLOCK_RECORDS) {
+        printf("FAIL: truncated log count\n");
+        return 0;
+    }
+    AttitudeLogBlock block;
+    size_t seen = 0;
+    while (attitude_log_reader_next(&reader, &block)) {
+        seen += block.count;
+    }
+    if (seen != 3 * BLOCK_RECORDS || !reader.damaged) {
+        printf("FAIL: truncated log read %zu records, damaged %d\n", seen, reader.damaged);
+        return 0;
+    }
+
+    /* A corrupt block magic stops iteration there. */
+    unsigned char *bytes = (unsigned char *)g_sink.storage;
+    bytes[ATTITUDE_LOG_HEADER_BYTES + block_bytes] ^= 0xff;
+    if (!attitude_log_reader_open_memory(&reader, g_sink.storage, full) ||
+        attitude_log_reader_count(&reader) != BLOCK_RECORDS || !attitude_log_reader_next(&reader, &block) ||
+        attitude_log_reader_next(&reader, &block) || !reader.damaged) {
+        printf("FAIL: corrupt block magic\n");
+        return 0;
+    }
+    bytes[ATTITUDE_LOG_HEADER_BYTES + block_bytes] ^= 0xff;
+
+    /* A record count running past the end of the data. */
+    bytes[ATTITUDE_LOG_HEADER_BYTES + 7] = 0x7f;
+    if (!attitude_log_reader_open_memory(&reader, g_sink.storage, full) || attitude_log_reader_count(&reader) != 0 ||
+        attitude_log_reader_next(&reader, &block) || !reader.damaged) {
+        printf("FAIL: oversized block count\n");
+        return 0;
+    }
+    bytes[ATTITUDE_LOG_HEADER_BYTES + 7] = 0;
+    return 1;
+}
+
+static int check_rejected_headers(void) {
+    reset_sink(sizeof(g_sink.storage));
+    if (!write_log(0, 10)) {
+        return 0;
+    }
+    unsigned char *bytes = (unsigned char *)g_sink.storage;
+    AttitudeLogReader reader;
+    /* Byte to patch, value to patch in; each patch alone must make the header unreadable. */
+    static const struct {
+        size_t offset;
+        unsigned char value;
+    } k_patches[] = {
+        {0, 'X'},  /* magic */
+        {8, 2},    /* newer version */
+        {8, 0},    /* version 0 */
+        {10, 60},  /* header shorter than version 1 */
+        {10, 68},  /* header not a whole number of doubles */
+        {11, 0xff}, /* header past the end */
+        {12, 2},   /* unknown flag */
+    };
+    for (size_t i = 0; i < sizeof(k_patches) / sizeof(k_patches[0]); ++i) {
+        const unsigned char saved = bytes[k_patches[i].offset];
+        bytes[k_patches[i].offset] = k_patches[i].value;
+        const int opened = attitude_log_reader_open_memory(&reader, g_sink.storage, g_sink.size);
+        bytes[k_patches[i].offset] = saved;
+        if (opened) {
+            printf("FAIL: accepted header patch %zu\n", i);
+            return 0;
+        }
+    }
+
+    if (!attitude_log_reader_open_memory(&reader, g_sink.storage, g_sink.size) ||
+        attitude_log_reader_open_memory(&reader, g_sink.storage, ATTITUDE_LOG_HEADER_BYTES - 1) ||
+        attitude_log_reader_open_memory(&reader, bytes + 4, g_sink.size - 4) ||
+        attitude_log_reader_open_memory(NULL, g_sink.storage, g_sink.size) ||
+        attitude_log_reader_open_memory(&reader, NULL, g_sink.size) || attitude_log_reader_next(NULL, NULL) ||
+        attitude_log_reader_count(NULL) != 0) {
+        printf("FAIL: reader argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_writer_errors(void) {
+    AttitudeLogWriter writer;
+    const double q[4] = {1.0, 0.0, 0.0, 0.0};
+    const double w[3] = {0.0, 0.0, 0.0};
+
+    reset_sink(sizeof(g_sink.storage));
+    if (attitude_log_writer_init(NULL, 0, g_block, sizeof(g_block), memory_sink, &g_sink) ||
+        attitude_log_writer_init(&writer, 0, NULL, sizeof(g_block), memory_sink, &g_sink) ||
+        attitude_log_writer_init(&writer, 0, g_block, sizeof(g_block), NULL, &g_sink) ||
+        attitude_log_writer_init(&writer, 4, g_block, sizeof(g_block), memory_sink, &g_sink) ||
+        attitude_log_writer_init(&writer, ATTITUDE_LOG_HAS_RATE, g_block, 63, memory_sink, &g_sink) ||
+        g_sink.size != 0) {
+        printf("FAIL: writer init accepted invalid arguments\n");
+        return 0;
+    }
+
+    /* A one-record buffer writes every record as its own block. */
+    if (!attitude_log_writer_init(&writer, ATTITUDE_LOG_HAS_RATE, g_block, 64, memory_sink, &g_sink) ||
+        writer.capacity != 1 || attitude_log_writer_append(&writer, 0.0, q, NULL) ||
+        attitude_log_writer_append(&writer, 0.0, NULL, w) || !attitude_log_writer_append(&writer, 0.0, q, w) ||
+        writer.written != 1 || !attitude_log_writer_flush(&writer) ||
+        g_sink.size != ATTITUDE_LOG_HEADER_BYTES + ATTITUDE_LOG_BLOCK_HEADER_BYTES + 64) {
+        printf("FAIL: single-record blocks\n");
+        return 0;
+    }
+
+    /* A sink that fails part way: the error sticks and nothing more is written. */
+    reset_sink(ATTITUDE_LOG_HEADER_BYTES + 50);
+    if (!attitude_log_writer_init(&writer, 0, g_block, 2 * 40, memory_sink, &g_sink) ||
+        !attitude_log_writer_append(&writer, 0.0, q, NULL) || attitude_log_writer_append(&writer, 1.0, q, NULL) ||
+        !writer.error || attitude_log_writer_append(&writer, 2.0, q, NULL) || attitude_log_writer_flush(&writer) ||
+        attitude_log_writer_close(&writer) || writer.written != 0) {
+        printf("FAIL: failing sink\n");
+        return 0;
+    }
+    reset_sink(ATTITUDE_LOG_HEADER_BYTES - 1);
+    if (attitude_log_writer_init(&writer, 0, g_block, sizeof(g_block), memory_sink, &g_sink)) {
+        printf("FAIL: header write failure not reported\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_files(void) {
+    /* CTest runs the test in the build tree. */
+    const char *path = "test_attitude_log.alog";
+    AttitudeLogWriter writer;
+    if (!attitude_log_writer_open_file(&writer, path, ATTITUDE_LOG_HAS_RATE, g_block, sizeof(g_block))) {
+        printf("NOTE: cannot create %s, skipping file round trip\n", path);
+        return 1;
+    }
+    int ok = 1;
+    for (size_t i = 0; i < COUNT && ok; ++i) {
+        ok = attitude_log_writer_append(&writer, g_timestamps[i], g_quaternions[i], g_rates[i]);
+    }
+    ok = attitude_log_writer_close(&writer) && ok && writer.file == NULL;
+    if (!ok) {
+        printf("FAIL: writing %s\n", path);
+        remove(path);
+        return 0;
+    }
+
+    AttitudeLogReader reader;
+    if (attitude_log_reader_open_file(&reader, path)) {
+        ok = reader.mapping != NULL && check_contents(&reader, ATTITUDE_LOG_HAS_RATE, COUNT);
+        attitude_log_reader_close(&reader);
+        ok = ok && reader.data == NULL;
+    } else {
+        printf("NOTE: library built without mmap, file reader not checked\n");
+    }
+    remove(path);
+    if (!ok) {
+        printf("FAIL: reading %s\n", path);
+        return 0;
+    }
+    return !attitude_log_reader_open_file(&reader, path) && !attitude_log_writer_open_file(&writer, NULL, 0, g_block, 64);
+}
+
+int main(void) {
+    fill_records();
+    if (!check_round_trip() || !check_layout() || !check_zero_copy_batch() || !check_damaged() ||
+        !check_rejected_headers() || !check_writer_errors() || !check_files()) {
+        return 1;
+    }
+    printf("PASS: binary attitude log\n");
+    return 0;
+}
@@ -0,0 +1,346 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "attitude/convert.h"
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+/* Not a multiple of the chunk alignment, so every run has a partial last chunk and mask byte. */
+#define COUNT 5037
+
+static unsigned int g_seed = 0xc0ffee11u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+static double g_quaternions[COUNT][4];
+static double g_dcms[COUNT][3][3];
+static EulerAngles g_euler[COUNT];
+
+/* Inputs with rejected elements sprinkled in: zero and NaN quaternions, stretched DCMs, Euler
+ * angles with an invalid order or a NaN angle. */
+static void fill_inputs(void) {
+    for (size_t i = 0; i < COUNT; ++i) {
+        double *q = g_quaternions[i];
+        for (int k = 0; k < 4; ++k) {
+            q[k] = random_unit();
+        }
+        quaternion_normalize(q);
+        quaternion_to_dcm(q, g_dcms[i]);
+        if (i % 89 == 5) {
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    g_dcms[i][r][c] *= 1.1;
+                }
+            }
+        }
+        if (i % 97 == 3) {
+            q[0] = q[1] = q[2] = q[3] = 0.0;
+        } else if (i % 131 == 7) {
+            q[2] = NAN;
+        }
+
+        g_euler[i].roll = 3.0 * random_unit();
+        g_euler[i].pitch = 1.5 * random_unit();
+        g_euler[i].yaw = 3.0 * random_unit();
+        g_euler[i].order = (EulerOrder)(i % EULER_ORDER_COUNT);
+        if (i % 101 == 11) {
+            g_euler[i].order = EULER_ORDER_COUNT;
+        } else if (i % 103 == 13) {
+            g_euler[i].yaw = NAN;
+        }
+    }
+}
+
+static const void *source_for(AttitudeConversionKind kind) {
+    switch (kind) {
+    case ATTITUDE_CONVERT_QUATERNION_TO_DCM:
+    case ATTITUDE_CONVERT_QUATERNION_TO_EULER:
+        return g_quaternions;
+    case ATTITUDE_CONVERT_DCM_TO_QUATERNION:
+    case ATTITUDE_CONVERT_DCM_TO_EULER:
+        return g_dcms;
+    default:
+        return g_euler;
+    }
+}
+
+static void set_nan(double *out, int n) {
+    for (int k = 0; k < n; ++k) {
+        out[k] = NAN;
+    }
+}
+
+/* Element-by-element reference through the scalar API; returns 1 when element i converted. */
+static int reference_element(AttitudeConversionKind kind, EulerOrder order, size_t i, void *dst) {
+    int ok = 0;
+    switch (kind) {
+    case ATTITUDE_CONVERT_QUATERNION_TO_DCM: {
+        double (*dcm)[3] = ((double (*)[3][3])dst)[i];
+        const double *q = g_quaternions[i];
+        const double n2 = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+        ok = n2 > 0.0 && isfinite(n2);
+        if (ok) {
+            quaternion_to_dcm(q, dcm);
+        } else {
+            set_nan(&dcm[0][0], 9);
+        }
+        break;
+    }
+    case ATTITUDE_CONVERT_QUATERNION_TO_EULER:
+    case ATTITUDE_CONVERT_DCM_TO_EULER: {
+        EulerAngles *e = (EulerAngles *)dst + i;
+        ok = kind == ATTITUDE_CONVERT_QUATERNION_TO_EULER
+                 ? euler_from_quaternion_checked(g_quaternions[i], order, e)
+                 : euler_from_dcm_checked((const double (*)[3])g_dcms[i], order, e);
+        if (!ok) {
+            e->roll = e->pitch = e->yaw = NAN;
+            e->order = order;
+        }
+        break;
+    }
+    case ATTITUDE_CONVERT_DCM_TO_QUATERNION: {
+        double *q = (double *)dst + 4 * i;
+        ok = dcm_to_quaternion_checked((const double (*)[3])g_dcms[i], q);
+        if (!ok) {
+            set_nan(q, 4);
+        }
+        break;
+    }
+    case ATTITUDE_CONVERT_EULER_TO_QUATERNION: {
+        double *q = (double *)dst + 4 * i;
+        ok = euler_to_quaternion_checked(&g_euler[i], q);
+        if (!ok) {
+            set_nan(q, 4);
+        }
+        break;
+    }
+    default: {
+        double (*dcm)[3] = ((double (*)[3][3])dst)[i];
+        ok = euler_to_dcm_checked(&g_euler[i], dcm);
+        if (!ok) {
+            set_nan(&dcm[0][0], 9);
+        }
+        break;
+    }
+    }
+    return ok;
+}
+
+static int outputs_equal(AttitudeConversionKind kind, const void *a, const void *b) {
+    if (kind == ATTITUDE_CONVERT_QUATERNION_TO_EULER || kind == ATTITUDE_CONVERT_DCM_TO_EULER) {
+        const EulerAngles *ea = (const EulerAngles *)a;
+        const EulerAngles *eb = (const EulerAngles *)b;
+        for (size_t i = 0; i < COUNT; ++i) {
+            // Field by field: the struct has padding that the conversions never write.
+            if (memcmp(&ea[i].roll, &eb[i].roll, sizeof(double)) != 0 ||
+                memcmp(&ea[i].pitch, &eb[i].pitch, sizeof(double)) != 0 ||
+                memcmp(&ea[i].yaw, &eb[i].yaw, sizeof(double)) != 0 || ea[i].order != eb[i].order) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+    const size_t doubles = (kind == ATTITUDE_CONVERT_QUATERNION_TO_DCM || kind == ATTITUDE_CONVERT_EULER_TO_DCM) ? 9 : 4;
+    return memcmp(a, b, COUNT * doubles * sizeof(double)) == 0;
+}
+
+/* Runs tasks back to front and records that each one ran exactly once. */
+typedef struct {
+    unsigned char seen[COUNT];
+    size_t calls;
+    int duplicate;
+} ReverseExecutor;
+
+static int run_reverse(void *context, AttitudeTaskFn task, void *arg, size_t count) {
+    ReverseExecutor *executor = (ReverseExecutor *)context;
+    int all_accepted = 1;
+    ++executor->calls;
+    memset(executor->seen, 0, sizeof(executor->seen));
+    for (size_t index = count; index-- > 0;) {
+        if (executor->seen[index]) {
+            executor->duplicate = 1;
+        }
+        executor->seen[index] = 1;
+        all_accepted &= task(arg, index);
+    }
+    return all_accepted;
+}
+
+/* Every kind, every executor and several chunk sizes against the scalar reference. */
+static int check_matches_scalar(AttitudeThreadPool *pool, AttitudeThreadPool *single) {
+    static double expected[COUNT * 9];
+    static double actual[COUNT * 9];
+    static unsigned char mask[ATTITUDE_CONVERT_MASK_BYTES(COUNT)];
+    static unsigned char rejected[COUNT];
+    static ReverseExecutor reverse;
+
+    const AttitudeExecutor pool_executor = attitude_thread_pool_executor(pool);
+    const AttitudeExecutor single_executor = attitude_thread_pool_executor(single);
+    const AttitudeExecutor reverse_executor = {run_reverse, &reverse};
+    const AttitudeExecutor *executors[] = {NULL, &pool_executor, &single_executor, &reverse_executor};
+    const char *names[] = {"serial", "pool", "single-thread pool", "reverse"};
+    const size_t chunks[] = {0, 64, 100, 4096};
+
+    for (int kind = 0; kind < ATTITUDE_CONVERT_KIND_COUNT; ++kind) {
+        const EulerOrder order = (EulerOrder)(kind % EULER_ORDER_COUNT + 3);
+        int expected_ok = 1;
+        size_t failures = 0;
+        for (size_t i = 0; i < COUNT; ++i) {
+            rejected[i] = (unsigned char)!reference_element((AttitudeConversionKind)kind, order, i, expected);
+            expected_ok &= !rejected[i];
+            failures += rejected[i];
+        }
+        if (failures == 0) {
+            printf("FAIL: kind %d test data has no rejected elements\n", kind);
+            return 0;
+        }
+
+        for (size_t e = 0; e < sizeof(executors) / sizeof(executors[0]); ++e) {
+            for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); ++c) {
+                memset(actual, 0xA5, sizeof(actual));
+                memset(mask, 0xA5, sizeof(mask));
+                reverse.calls = 0;
+                reverse.duplicate = 0;
+                const AttitudeConversion conversion = {
+                    (AttitudeConversionKind)kind, order, source_for((AttitudeConversionKind)kind),
+                    actual, COUNT, mask, chunks[c]
+                };
+                const int ok = attitude_convert(&conversion, executors[e]);
+                if (ok != expected_ok || !outputs_equal((AttitudeConversionKind)kind, expected, actual)) {
+                    printf("FAIL: kind %d on %s executor, chunk %zu differs from the scalar API\n",
+                           kind, names[e], chunks[c]);
+                    return 0;
+                }
+                for (size_t i = 0; i < COUNT; ++i) {
+                    const int bit = (mask[i / 8] >> (i % 8)) & 1;
+                    if (bit != rejected[i]) {
+                        printf("FAIL: kind %d on %s executor, mask bit %zu is %d\n", kind, names[e], i, bit);
+                        return 0;
+                    }
+                }
+                if (executors[e] == &reverse_executor && (reverse.calls != 1 || reverse.duplicate)) {
+                    printf("FAIL: custom executor called %zu times (duplicate task: %d)\n", reverse.calls,
+                           reverse.duplicate);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_chunking(void) {
+    for (int kind = 0; kind < ATTITUDE_CONVERT_KIND_COUNT; ++kind) {
+        const size_t chunk = attitude_convert_default_chunk((AttitudeConversionKind)kind);
+        if (chunk == 0 || chunk % ATTITUDE_CONVERT_CHUNK_ALIGN != 0 || chunk * 32 > ATTITUDE_CONVERT_CHUNK_BYTES) {
+            printf("FAIL: default chunk %zu for kind %d\n", chunk, kind);
+            return 0;
+        }
+    }
+    if (attitude_convert_default_chunk(ATTITUDE_CONVERT_KIND_COUNT) != 0) {
+        printf("FAIL: default chunk for an invalid kind\n");
+        return 0;
+    }
+
+    // A single chunk never reaches the executor, including one of SIZE_MAX elements.
+    static double out[64 * 9];
+    ReverseExecutor *reverse = (ReverseExecutor *)calloc(1, sizeof(ReverseExecutor));
+    const AttitudeExecutor executor = {run_reverse, reverse};
+    const AttitudeConversion small = {ATTITUDE_CONVERT_QUATERNION_TO_DCM, EULER_ZYX, g_quaternions, out, 64, NULL, 0};
+    const AttitudeConversion whole = {ATTITUDE_CONVERT_QUATERNION_TO_DCM, EULER_ZYX, g_quaternions, out, 2, NULL,
+                                      SIZE_MAX};
+    attitude_convert(&small, &executor);
+    const int converted = attitude_convert(&whole, &executor);
+    const size_t calls = reverse->calls;
+    free(reverse);
+    if (!converted || calls != 0) {
+        printf("FAIL: single-chunk conversion went through the executor\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_invalid_arguments(void) {
+    static double out[COUNT * 4];
+    unsigned char mask[4] = {0x5A, 0x5A, 0x5A, 0x5A};
+    AttitudeConversion conversion = {ATTITUDE_CONVERT_QUATERNION_TO_EULER, EULER_ORDER_COUNT, g_quaternions, out, 20, mask, 0};
+    memset(out, 0x5A, sizeof(out));
+
+    int rejected = !attitude_convert(NULL, NULL) && !attitude_convert(&conversion, NULL);
+    conversion.order = EULER_ZYX;
+    conversion.kind = ATTITUDE_CONVERT_KIND_COUNT;
+    rejected = rejected && !attitude_convert(&conversion, NULL);
+    conversion.kind = ATTITUDE_CONVERT_DCM_TO_QUATERNION;
+    conversion.src = NULL;
+    rejected = rejected && !attitude_convert(&conversion, NULL);
+    conversion.src = g_dcms;
+    conversion.dst = NULL;
+    rejected = rejected && !attitude_convert(&conversion, NULL);
+    if (!rejected) {
+        printf("FAIL: attitude_convert accepted invalid arguments\n");
+        return 0;
+    }
+    for (size_t i = 0; i < sizeof(out); ++i) {
+        if (((unsigned char *)out)[i] != 0x5A || (i < sizeof(mask) && mask[i] != 0x5A)) {
+            printf("FAIL: rejected attitude_convert call wrote output\n");
+            return 0;
+        }
+    }
+
+    // The order is ignored by kinds that do not produce Euler angles, and count 0 is a no-op.
+    conversion.dst = out;
+    conversion.order = EULER_ORDER_COUNT;
+    conversion.count = 3;
+    const AttitudeConversion empty = {ATTITUDE_CONVERT_EULER_TO_DCM, EULER_ZYX, NULL, NULL, 0, NULL, 0};
+    if (!attitude_convert(&conversion, NULL) || !attitude_convert(&empty, NULL)) {
+        printf("FAIL: attitude_convert rejected valid arguments\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_pool_api(AttitudeThreadPool *pool) {
+    const AttitudeExecutor none = attitude_thread_pool_executor(NULL);
+    attitude_thread_pool_destroy(NULL);
+    if (none.run != NULL || attitude_thread_pool_size(NULL) != 0 || attitude_thread_pool_size(pool) != 4) {
+        printf("FAIL: thread pool bookkeeping\n");
+        return 0;
+    }
+    AttitudeThreadPool *automatic = attitude_thread_pool_create(0);
+    const unsigned size = attitude_thread_pool_size(automatic);
+    attitude_thread_pool_destroy(automatic);
+    if (size < 1) {
+        printf("FAIL: thread pool sized from online CPUs has %u threads\n", size);
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    fill_inputs();
+
+    AttitudeThreadPool *pool = attitude_thread_pool_create(4);
+    AttitudeThreadPool *single = attitude_thread_pool_create(1);
+    if (pool == NULL || single == NULL) {
+        // Built without ATTITUDE_THREADS: the NULL executors below fall back to one thread.
+        printf("NOTE: thread pool unavailable, checking the single-threaded paths only\n");
+    }
+
+    const int ok = check_matches_scalar(pool, single) && check_chunking() && check_invalid_arguments() &&
+                   (pool == NULL || check_pool_api(pool));
+    attitude_thread_pool_destroy(single);
+    attitude_thread_pool_destroy(pool);
+    if (!ok) {
+        return 1;
+    }
+
+    printf("PASS: batch attitude conversion\n");
+    return 0;
+}
@@ -0,0 +1,266 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/dcm.h"
+#include "attitude/quaternion.h"
+
+static unsigned int g_seed = 777u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/* Largest entry of |M M^T - I|. */
+static double orthonormality_error(const double m[3][3]) {
+    double worst = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            const double dot = m[i][0] * m[j][0] + m[i][1] * m[j][1] + m[i][2] * m[j][2];
+            worst = fmax(worst, fabs(dot - (i == j ? 1.0 : 0.0)));
+        }
+    }
+    return worst;
+}
+
+static double max_difference(const double a[3][3], const double b[3][3]) {
+    double worst = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            worst = fmax(worst, fabs(a[i][j] - b[i][j]));
+        }
+    }
+    return worst;
+}
+
+static void random_rotation(double r[3][3]) {
+    const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+    double q[4];
+    quaternion_exp(rotvec, q);
+    quaternion_to_dcm(q, r);
+}
+
+static int check_integration(void) {
+    /* Gyro propagation C <- C (I + [w dt]x): uncorrected it drifts, corrected it stays a rotation. */
+    const double w[3] = {0.3, -1.1, 0.7};
+    const double dt = 1e-3;
+    const int steps = 20000;
+    double tracks[3][3][3] = {
+        {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+        {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+        {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}
+    };
+    const double step[3][3] = {{1.0, -w[2] * dt, w[1] * dt}, {w[2] * dt, 1.0, -w[0] * dt}, {-w[1] * dt, w[0] * dt, 1.0}};
+
+    for (int n = 0; n < steps; ++n) {
+        double next[3][3][3];
+        for (int t = 0; t < 3; ++t) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    next[t][i][j] =
+                        tracks[t][i][0] * step[0][j] + tracks[t][i][1] * step[1][j] + tracks[t][i][2] * step[2][j];
+                }
+            }
+        }
+        memcpy(tracks[0], next[0], sizeof(tracks[0]));
+        if (!dcm_orthonormalize_fast((const double (*)[3])next[1], tracks[1]) ||
+            !dcm_orthonormalize((const double (*)[3])next[2], tracks[2])) {
+            printf("FAIL: orthonormalization rejected step %d\n", n);
+            return 0;
+        }
+    }
+
+    /* Each step drifts by about (|w| dt)^2 / 2 and the fast correction leaves the square of that. */
+    if (dcm_is_orthonormal((const double (*)[3])tracks[0], ATTITUDE_DCM_ORTHONORMAL_TOL) ||
+        orthonormality_error((const double (*)[3])tracks[1]) > 1e-11 ||
+        orthonormality_error((const double (*)[3])tracks[2]) > 1e-15) {
+        printf("FAIL: corrected integration errors %.3e (fast) / %.3e (exact)\n",
+               orthonormality_error((const double (*)[3])tracks[1]), orthonormality_error((const double (*)[3])tracks[2]));
+        return 0;
+    }
+
+    /* The rotation part of each step turns by atan(|w| dt); the exact projection keeps precisely that. */
+    const double rate = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+    const double angle = steps * atan(rate * dt);
+    const double rotvec[3] = {w[0] / rate * angle, w[1] / rate * angle, w[2] / rate * angle};
+    double q[4];
+    double expected[3][3];
+    quaternion_exp(rotvec, q);
+    quaternion_to_dcm(q, expected);
+    if (max_difference((const double (*)[3])tracks[2], (const double (*)[3])expected) > 1e-11) {
+        printf("FAIL: exact-corrected integration off by %.3e\n",
+               max_difference((const double (*)[3])tracks[2], (const double (*)[3])expected));
+        return 0;
+    }
+    /* The fast correction is not the nearest rotation: each step may bias it by up to the drift removed. */
+    if (max_difference((const double (*)[3])tracks[1], (const double (*)[3])expected) > steps * rate * rate * dt * dt) {
+        printf("FAIL: fast-corrected integration off by %.3e\n",
+               max_difference((const double (*)[3])tracks[1], (const double (*)[3])expected));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_fast_convergence(void) {
+    const double sizes[] = {1e-3, 1e-5, 1e-7};
+    for (int trial = 0; trial < 100; ++trial) {
+        for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            double m[3][3];
+            random_rotation(m);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    m[i][j] += sizes[s] * random_unit();
+                }
+            }
+            /* One pass leaves an error of second order; a few more converge to rounding. */
+            double out[3][3];
+            dcm_orthonormalize_fast((const double (*)[3])m, out);
+            if (orthonormality_error((const double (*)[3])out) > 40.0 * sizes[s] * sizes[s] + 1e-15) {
+                printf("FAIL: fast pass from %.0e drift leaves %.3e\n", sizes[s],
+                       orthonormality_error((const double (*)[3])out));
+                return 0;
+            }
+            for (int pass = 0; pass < 3; ++pass) {
+                dcm_orthonormalize_fast((const double (*)[3])out, out);
+            }
+            if (orthonormality_error((const double (*)[3])out) > 1e-15 ||
+                !dcm_is_rotation_fast((const double (*)[3])out, 1e-15)) {
+                printf("FAIL: repeated fast passes stall at %.3e\n", orthonormality_error((const double (*)[3])out));
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_nearest(void) {
+    /* M = R S with S symmetric positive definite has polar factor exactly R, for any drift. */
+    const double sizes[] = {0.0, 1e-8, 1e-3, 0.3};
+    for (int trial = 0; trial < 200; ++trial) {
+        const double size = sizes[trial % 4];
+        double r[3][3];
+        double s[3][3];
+        double m[3][3];
+        double out[3][3];
+        random_rotation(r);
+        if (trial == 1) {
+            const double half_turn[3][3] = {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}};
+            memcpy(r, half_turn, sizeof(r));
+        }
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j <= i; ++j) {
+                s[i][j] = s[j][i] = (i == j ? 1.0 : 0.0) + size * random_unit();
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                m[i][j] = 2.5 * (r[i][0] * s[0][j] + r[i][1] * s[1][j] + r[i][2] * s[2][j]);
+            }
+        }
+
+        if (!dcm_orthonormalize((const double (*)[3])m, out) ||
+            max_difference((const double (*)[3])out, (const double (*)[3])r) > 4e-15) {
+            printf("FAIL: nearest rotation off by %.3e at drift %.0e\n",
+                   max_difference((const double (*)[3])out, (const double (*)[3])r), size);
+            return 0;
+        }
+        /* Batch and in-place calls give the same bits. */
+        double batch[2][3][3];
+        memcpy(batch[0], m, sizeof(m));
+        memcpy(batch[1], m, sizeof(m));
+        if (!dcm_orthonormalize_batch(&batch[0][0][0], 2, &batch[0][0][0]) ||
+            memcmp(batch[0], out, sizeof(out)) != 0 || memcmp(batch[1], out, sizeof(out)) != 0) {
+            printf("FAIL: batch orthonormalization differs from single\n");
+            return 0;
+        }
+        double fast[3][3];
+        dcm_orthonormalize_fast((const double (*)[3])m, fast);
+        memcpy(batch[0], m, sizeof(m));
+        if (!dcm_orthonormalize_fast_batch(&batch[0][0][0], 1, &batch[1][0][0]) ||
+            memcmp(batch[1], fast, sizeof(fast)) != 0) {
+            printf("FAIL: fast batch differs from single\n");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    double r[3][3];
+    float m[3][3];
+    float fast[3][3];
+    float exact[3][3];
+    random_rotation(r);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            m[i][j] = (float)(r[i][j] + 1e-3 * random_unit());
+        }
+    }
+    if (!dcmf_orthonormalize((const float (*)[3])m, exact) || !dcmf_orthonormalize_fast((const float (*)[3])m, fast) ||
+        !dcmf_orthonormalize_fast((const float (*)[3])fast, fast) ||
+        !dcmf_is_orthonormal((const float (*)[3])exact, 1e-6f) || !dcmf_is_orthonormal((const float (*)[3])fast, 1e-6f)) {
+        printf("FAIL: float orthonormalization\n");
+        return 0;
+    }
+    float batch[2][3][3];
+    memcpy(batch[0], m, sizeof(m));
+    memcpy(batch[1], m, sizeof(m));
+    if (!dcmf_orthonormalize_batch(&batch[0][0][0], 2, &batch[0][0][0]) || memcmp(batch[1], exact, sizeof(exact)) != 0 ||
+        !dcmf_orthonormalize_fast_batch(&batch[0][0][0], 0, NULL)) {
+        printf("FAIL: float batch orthonormalization\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double identity[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    const double reflection[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}};
+    const double singular[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 0.0}};
+    double with_nan[3][3];
+    double out[3][3];
+    memcpy(with_nan, identity, sizeof(with_nan));
+    with_nan[1][2] = NAN;
+
+    if (dcm_orthonormalize(NULL, out) || dcm_orthonormalize(identity, NULL) || dcm_orthonormalize_fast(NULL, out) ||
+        dcm_orthonormalize_fast(identity, NULL) || dcm_orthonormalize_batch(NULL, 1, &out[0][0]) ||
+        dcm_orthonormalize_fast_batch(&identity[0][0], 1, NULL)) {
+        printf("FAIL: orthonormalization null checks\n");
+        return 0;
+    }
+    const double (*const bad[])[3] = {reflection, singular, (const double (*)[3])with_nan};
+    for (unsigned int b = 0; b < 3; ++b) {
+        if (dcm_orthonormalize(bad[b], out) || !isnan(out[0][0]) || !isnan(out[2][2])) {
+            printf("FAIL: dcm_orthonormalize accepted bad matrix %u\n", b);
+            return 0;
+        }
+    }
+    if (dcm_orthonormalize_fast((const double (*)[3])with_nan, out) || !isnan(out[0][0])) {
+        printf("FAIL: dcm_orthonormalize_fast accepted NaN\n");
+        return 0;
+    }
+
+    /* A batch with one bad element still corrects the rest. */
+    double batch[3][3][3];
+    memcpy(batch[0], identity, sizeof(identity));
+    memcpy(batch[1], reflection, sizeof(reflection));
+    memcpy(batch[2], identity, sizeof(identity));
+    if (dcm_orthonormalize_batch(&batch[0][0][0], 3, &batch[0][0][0]) ||
+        memcmp(batch[0], identity, sizeof(identity)) != 0 || !isnan(batch[1][1][1]) ||
+        memcmp(batch[2], identity, sizeof(identity)) != 0) {
+        printf("FAIL: partially invalid batch\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_integration() || !check_fast_convergence() || !check_nearest() || !check_float() ||
+        !check_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: DCM orthonormalization\n");
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+static int check_matches_checked(const double dcm[3][3]) {
+    double q_checked[4];
+    double q_unchecked[4];
+    double checked[3];
+    double unchecked[3];
+
+    if (!dcm_to_quaternion_checked(dcm, q_checked) ||
+        !dcm_to_euler_checked(dcm, &checked[0], &checked[1], &checked[2])) {
+        printf("FAIL: checked conversion rejected a valid rotation\n");
+        return 0;
+    }
+    dcm_to_quaternion_unchecked(dcm, q_unchecked);
+    dcm_to_euler_unchecked(dcm, &unchecked[0], &unchecked[1], &unchecked[2]);
+
+    /* Both paths share one kernel, so the results must be bit-identical. */
+    if (memcmp(q_checked, q_unchecked, sizeof(q_checked)) != 0 ||
+        memcmp(checked, unchecked, sizeof(checked)) != 0) {
+        printf("FAIL: unchecked conversion differs from the checked one\n");
+        return 0;
+    }
+    if (!dcm_is_rotation_fast(dcm, ATTITUDE_DCM_ORTHONORMAL_TOL)) {
+        printf("FAIL: dcm_is_rotation_fast rejected a valid rotation\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_fast_rejections(void) {
+    const double identity[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    double dcm[3][3];
+
+    memcpy(dcm, identity, sizeof(dcm));
+    dcm[2][2] = -1.0;
+    if (dcm_is_rotation_fast((const double (*)[3])dcm, ATTITUDE_DCM_ORTHONORMAL_TOL)) {
+        printf("FAIL: dcm_is_rotation_fast accepted a reflection\n");
+        return 0;
+    }
+
+    memcpy(dcm, identity, sizeof(dcm));
+    dcm[0][0] = 1.0 + 1e-6;
+    if (dcm_is_rotation_fast((const double (*)[3])dcm, ATTITUDE_DCM_ORTHONORMAL_TOL)) {
+        printf("FAIL: dcm_is_rotation_fast accepted a scaled row\n");
+        return 0;
+    }
+
+    memcpy(dcm, identity, sizeof(dcm));
+    dcm[1][0] = 1e-6;
+    if (dcm_is_rotation_fast((const double (*)[3])dcm, ATTITUDE_DCM_ORTHONORMAL_TOL)) {
+        printf("FAIL: dcm_is_rotation_fast accepted a sheared matrix\n");
+        return 0;
+    }
+
+    memcpy(dcm, identity, sizeof(dcm));
+    dcm[2][1] = NAN;
+    if (dcm_is_rotation_fast((const double (*)[3])dcm, ATTITUDE_DCM_ORTHONORMAL_TOL)) {
+        printf("FAIL: dcm_is_rotation_fast accepted NaN\n");
+        return 0;
+    }
+
+#ifdef ATTITUDE_CHECK_TRUSTED_INPUTS
+    /* The debug mode must poison, not silently convert, a matrix that is not a rotation. */
+    double q[4];
+    memcpy(dcm, identity, sizeof(dcm));
+    dcm[0][0] = 2.0;
+    dcm_to_quaternion_unchecked((const double (*)[3])dcm, q);
+    if (!isnan(q[0])) {
+        printf("FAIL: ATTITUDE_CHECK_TRUSTED_INPUTS did not flag a non-rotation\n");
+        return 0;
+    }
+#endif
+
+    if (dcm_is_rotation_fast(identity, NAN) || dcm_is_rotation_fast(identity, -1.0)) {
+        printf("FAIL: dcm_is_rotation_fast accepted an invalid tolerance\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    const double cases[][3] = {
+        {0.0, 0.0, 0.0},
+        {0.3, -0.4, 1.2},
+        {-2.9, 1.1, 3.0},
+        {1.0, 1.5707963267948966, -0.5},
+        {0.2, -1.5707963267948966, 0.7},
+        {3.14159, 0.0, 0.0}
+    };
+
+    for (unsigned int index = 0; index < sizeof(cases) / sizeof(cases[0]); ++index) {
+        EulerAngles e = {cases[index][0], cases[index][1], cases[index][2], EULER_ZYX};
+        double q[4];
+        double dcm[3][3];
+
+        euler_to_quaternion(&e, q);
+        quaternion_to_dcm(q, dcm);
+        if (!check_matches_checked((const double (*)[3])dcm)) {
+            return 1;
+        }
+    }
+
+    if (!check_fast_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: unchecked DCM conversions match the checked ones\n");
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+#define SAMPLE_COUNT 200
+
+static double g_q[SAMPLE_COUNT][4];
+
+static double angle_difference(double a, double b) {
+    return fabs(atan2(sin(a - b), cos(a - b)));
+}
+
+static int same_angles(const EulerAngles *a, const EulerAngles *b, double tolerance) {
+    return angle_difference(a->roll, b->roll) <= tolerance &&
+           angle_difference(a->pitch, b->pitch) <= tolerance &&
+           angle_difference(a->yaw, b->yaw) <= tolerance;
+}
+
+static void build_samples(void) {
+    for (int index = 0; index < SAMPLE_COUNT; ++index) {
+        for (int component = 0; component < 4; ++component) {
+            g_q[index][component] = sin(1.7 * index + 2.3 * component + 0.4);
+        }
+        quaternion_normalize(g_q[index]);
+    }
+}
+
+/* The direct method must agree with extracting from the equivalent DCM. */
+static int check_matches_dcm_path(EulerOrder order) {
+    for (int index = 0; index < SAMPLE_COUNT; ++index) {
+        const double *q = g_q[index];
+        const double scaled[4] = {-3.0 * q[0], -3.0 * q[1], -3.0 * q[2], -3.0 * q[3]};
+        double dcm[3][3];
+        EulerAngles direct;
+        EulerAngles via_dcm;
+        EulerAngles via_scaled;
+
+        quaternion_to_dcm(q, dcm);
+        if (!euler_from_quaternion_checked(q, order, &direct) ||
+            !euler_from_dcm_checked((const double (*)[3])dcm, order, &via_dcm) ||
+            !euler_from_quaternion_checked(scaled, order, &via_scaled)) {
+            printf("FAIL: order %d rejected sample %d\n", (int)order, index);
+            return 0;
+        }
+        if (!same_angles(&direct, &via_dcm, 1e-9) || !same_angles(&direct, &via_scaled, 1e-12)) {
+            printf("FAIL: order %d sample %d: direct (%f, %f, %f) vs DCM (%f, %f, %f)\n", (int)order,
+                   index, direct.roll, direct.pitch, direct.yaw, via_dcm.roll, via_dcm.pitch, via_dcm.yaw);
+            return 0;
+        }
+        if (fabs(direct.roll) > 3.141592653589794 || fabs(direct.yaw) > 3.141592653589794) {
+            printf("FAIL: order %d sample %d returned an unwrapped angle\n", (int)order, index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Field holding the middle angle: the second axis for Tait-Bryan orders, pitch otherwise. */
+static double *middle_field(EulerAngles *e) {
+    switch (e->order) {
+    case EULER_XZY:
+    case EULER_YZX:
+    case EULER_EXTRINSIC_XZY:
+    case EULER_EXTRINSIC_YZX:
+        return &e->yaw;
+    case EULER_YXZ:
+    case EULER_ZXY:
+    case EULER_EXTRINSIC_YXZ:
+    case EULER_EXTRINSIC_ZXY:
+        return &e->roll;
+    default:
+        return &e->pitch;
+    }
+}
+
+/* Gimbal lock (and the b = 0 / pi singularities of proper-Euler orders) still reconstructs. */
+static int check_gimbal_lock(EulerOrder order) {
+    const double pi = 3.14159265358979323846;
+    const double middles[] = {pi / 2.0, -pi / 2.0, 0.0, pi};
+
+    for (unsigned int index = 0; index < sizeof(middles) / sizeof(middles[0]); ++index) {
+        EulerAngles input = {0.7, 0.7, 0.7, order};
+        double q[4];
+        double dcm[3][3];
+        EulerAngles direct;
+
+        *middle_field(&input) = middles[index];
+        euler_to_quaternion(&input, q);
+        euler_to_dcm(&input, dcm);
+        euler_from_quaternion(q, order, &direct);
+        if (isnan(direct.roll) || isnan(direct.pitch) || isnan(direct.yaw)) {
+            printf("FAIL: order %d middle %f rejected\n", (int)order, middles[index]);
+            return 0;
+        }
+
+        double back[3][3];
+        euler_to_dcm(&direct, back);
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                if (fabs(back[row][column] - dcm[row][column]) > 1e-7) {
+                    printf("FAIL: order %d middle %f does not reconstruct the rotation\n", (int)order,
+                           middles[index]);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_batch(EulerOrder order) {
+    static EulerAngles batch[SAMPLE_COUNT];
+    double bad[3][4];
+
+    if (!euler_from_quaternions(&g_q[0][0], SAMPLE_COUNT, order, batch)) {
+        printf("FAIL: euler_from_quaternions rejected valid input for order %d\n", (int)order);
+        return 0;
+    }
+    for (int index = 0; index < SAMPLE_COUNT; ++index) {
+        EulerAngles single;
+        euler_from_quaternion(g_q[index], order, &single);
+        /* Same kernel per element: bit-identical angles (compared fieldwise, not padding). */
+        if (memcmp(&single.roll, &batch[index].roll, sizeof(double)) != 0 ||
+            memcmp(&single.pitch, &batch[index].pitch, sizeof(double)) != 0 ||
+            memcmp(&single.yaw, &batch[index].yaw, sizeof(double)) != 0 ||
+            single.order != batch[index].order) {
+            printf("FAIL: euler_from_quaternions differs from the scalar call at %d\n", index);
+            return 0;
+        }
+    }
+
+    memcpy(bad[0], g_q[0], sizeof(bad[0]));
+    memset(bad[1], 0, sizeof(bad[1]));
+    memcpy(bad[2], g_q[2], sizeof(bad[2]));
+    bad[2][3] = NAN;
+    if (euler_from_quaternions(&bad[0][0], 3, order, batch) || isnan(batch[0].roll) ||
+        !isnan(batch[1].roll) || !isnan(batch[2].yaw) || batch[1].order != order) {
+        printf("FAIL: euler_from_quaternions did not flag invalid elements\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(EulerOrder order) {
+    float qf[SAMPLE_COUNT][4];
+    EulerAnglesf angles[SAMPLE_COUNT];
+
+    for (int index = 0; index < SAMPLE_COUNT; ++index) {
+        for (int component = 0; component < 4; ++component) {
+            qf[index][component] = (float)g_q[index][component];
+        }
+    }
+    if (!eulerf_from_quaternions(&qf[0][0], SAMPLE_COUNT, order, angles)) {
+        printf("FAIL: eulerf_from_quaternions rejected valid input\n");
+        return 0;
+    }
+    for (int index = 0; index < SAMPLE_COUNT; ++index) {
+        EulerAngles expected;
+        euler_from_quaternion(g_q[index], order, &expected);
+        if (angle_difference(angles[index].roll, expected.roll) > 1e-3 ||
+            angle_difference(angles[index].pitch, expected.pitch) > 1e-3 ||
+            angle_difference(angles[index].yaw, expected.yaw) > 1e-3) {
+            printf("FAIL: eulerf_from_quaternions order %d sample %d differs from double\n",
+                   (int)order, index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    build_samples();
+
+    for (int order = 0; order < (int)EULER_ORDER_COUNT; ++order) {
+        if (!check_matches_dcm_path((EulerOrder)order) || !check_gimbal_lock((EulerOrder)order) ||
+            !check_batch((EulerOrder)order) || !check_float((EulerOrder)order)) {
+            return 1;
+        }
+    }
+    if (euler_from_quaternions(&g_q[0][0], 1, EULER_ORDER_COUNT, NULL) ||
+        !euler_from_quaternions(NULL, 0, EULER_ZYX, NULL)) {
+        printf("FAIL: euler_from_quaternions argument checks\n");
+        return 1;
+    }
+
+    printf("PASS: direct quaternion-to-Euler for every order\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+
+/* Reference description of each order, independent of the library's axis table. */
+typedef struct {
+    EulerOrder order;
+    const char *axes;
+    int extrinsic;
+} OrderCase;
+
+static const OrderCase k_orders[] = {
+    {EULER_XYZ, "XYZ", 0}, {EULER_XZY, "XZY", 0}, {EULER_YXZ, "YXZ", 0},
+    {EULER_YZX, "YZX", 0}, {EULER_ZXY, "ZXY", 0}, {EULER_ZYX, "ZYX", 0},
+    {EULER_XYX, "XYX", 0}, {EULER_XZX, "XZX", 0}, {EULER_YXY, "YXY", 0},
+    {EULER_YZY, "YZY", 0}, {EULER_ZXZ, "ZXZ", 0}, {EULER_ZYZ, "ZYZ", 0},
+    {EULER_EXTRINSIC_XYZ, "XYZ", 1}, {EULER_EXTRINSIC_XZY, "XZY", 1},
+    {EULER_EXTRINSIC_YXZ, "YXZ", 1}, {EULER_EXTRINSIC_YZX, "YZX", 1},
+    {EULER_EXTRINSIC_ZXY, "ZXY", 1}, {EULER_EXTRINSIC_ZYX, "ZYX", 1},
+    {EULER_EXTRINSIC_XYX, "XYX", 1}, {EULER_EXTRINSIC_XZX, "XZX", 1},
+    {EULER_EXTRINSIC_YXY, "YXY", 1}, {EULER_EXTRINSIC_YZY, "YZY", 1},
+    {EULER_EXTRINSIC_ZXZ, "ZXZ", 1}, {EULER_EXTRINSIC_ZYZ, "ZYZ", 1},
+};
+
+static void elementary(int axis, double angle, double r[3][3]) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    const int u = (axis + 1) % 3;
+    const int v = (axis + 2) % 3;
+
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            r[row][column] = row == column ? 1.0 : 0.0;
+        }
+    }
+    r[u][u] = c;
+    r[u][v] = -s;
+    r[v][u] = s;
+    r[v][v] = c;
+}
+
+static void multiply(const double a[3][3], const double b[3][3], double out[3][3]) {
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            out[row][column] = a[row][0] * b[0][column] + a[row][1] * b[1][column] +
+                               a[row][2] * b[2][column];
+        }
+    }
+}
+
+/* Builds the matrix as an explicit product of elementary rotations. */
+static void reference_dcm(const OrderCase *order, const EulerAngles *e, double out[3][3]) {
+    int axis[3];
+    double angle[3];
+    double first[3][3];
+    double second[3][3];
+    double third[3][3];
+    double partial[3][3];
+
+    for (int position = 0; position < 3; ++position) {
+        axis[position] = order->axes[position] - 'X';
+    }
+    if (axis[0] != axis[2]) {
+        for (int position = 0; position < 3; ++position) {
+            angle[position] = axis[position] == 0 ? e->roll : (axis[position] == 1 ? e->pitch : e->yaw);
+        }
+    } else {
+        angle[0] = e->yaw;
+        angle[1] = e->pitch;
+        angle[2] = e->roll;
+    }
+
+    elementary(axis[0], angle[0], first);
+    elementary(axis[1], angle[1], second);
+    elementary(axis[2], angle[2], third);
+    if (order->extrinsic) {
+        multiply((const double (*)[3])third, (const double (*)[3])second, partial);
+        multiply((const double (*)[3])partial, (const double (*)[3])first, out);
+    } else {
+        multiply((const double (*)[3])first, (const double (*)[3])second, partial);
+        multiply((const double (*)[3])partial, (const double (*)[3])third, out);
+    }
+}
+
+static double matrix_error(const double a[3][3], const double b[3][3]) {
+    double worst = 0.0;
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            worst = fmax(worst, fabs(a[row][column] - b[row][column]));
+        }
+    }
+    return worst;
+}
+
+static int check_angles(const OrderCase *order, double roll, double pitch, double yaw) {
+    const EulerAngles e = {roll, pitch, yaw, order->order};
+    double expected[3][3];
+    double dcm[3][3];
+    double from_q[3][3];
+    double q[4];
+    EulerAngles recovered;
+
+    reference_dcm(order, &e, expected);
+    if (!euler_to_dcm_checked(&e, dcm) ||
+        matrix_error((const double (*)[3])dcm, (const double (*)[3])expected) > 1e-14) {
+        printf("FAIL: euler_to_dcm %s%s does not match the elementary product\n",
+               order->extrinsic ? "extrinsic " : "", order->axes);
+        return 0;
+    }
+    if (!euler_to_quaternion_checked(&e, q)) {
+        printf("FAIL: euler_to_quaternion rejected %s\n", order->axes);
+        return 0;
+    }
+    quaternion_to_dcm(q, from_q);
+    if (matrix_error((const double (*)[3])from_q, (const double (*)[3])expected) > 1e-14) {
+        printf("FAIL: euler_to_quaternion %s%s does not match the elementary product\n",
+               order->extrinsic ? "extrinsic " : "", order->axes);
+        return 0;
+    }
+
+    /* Inverses: compare reconstructed matrices so gimbal-lock solutions are accepted. */
+    if (!euler_from_dcm_checked((const double (*)[3])expected, order->order, &recovered) ||
+        recovered.order != order->order || !euler_to_dcm_checked(&recovered, dcm) ||
+        matrix_error((const double (*)[3])dcm, (const double (*)[3])expected) > 1e-12) {
+        printf("FAIL: euler_from_dcm %s%s does not reconstruct the rotation\n",
+               order->extrinsic ? "extrinsic " : "", order->axes);
+        return 0;
+    }
+    if (!euler_from_quaternion_checked(q, order->order, &recovered) ||
+        !euler_to_dcm_checked(&recovered, dcm) ||
+        matrix_error((const double (*)[3])dcm, (const double (*)[3])expected) > 1e-12) {
+        printf("FAIL: euler_from_quaternion %s%s does not reconstruct the rotation\n",
+               order->extrinsic ? "extrinsic " : "", order->axes);
+        return 0;
+    }
+    return 1;
+}
+
+static double *field_for_axis(EulerAngles *e, int axis) {
+    return axis == 0 ? &e->roll : (axis == 1 ? &e->pitch : &e->yaw);
+}
+
+static int check_recovers_angles(const OrderCase *order) {
+    /* Inside the principal ranges, away from gimbal lock, the angles themselves come back. */
+    EulerAngles e = {0.0, 0.0, 0.0, order->order};
+    double dcm[3][3];
+    EulerAngles recovered;
+
+    if (order->axes[0] != order->axes[2]) {
+        *field_for_axis(&e, order->axes[0] - 'X') = 0.4;
+        *field_for_axis(&e, order->axes[1] - 'X') = -0.6;
+        *field_for_axis(&e, order->axes[2] - 'X') = -2.2;
+    } else {
+        e.yaw = 0.4;
+        e.pitch = 1.1;
+        e.roll = -2.2;
+    }
+
+    euler_to_dcm(&e, dcm);
+    euler_from_dcm((const double (*)[3])dcm, order->order, &recovered);
+    if (fabs(recovered.roll - e.roll) > 1e-12 || fabs(recovered.pitch - e.pitch) > 1e-12 ||
+        fabs(recovered.yaw - e.yaw) > 1e-12) {
+        printf("FAIL: euler_from_dcm %s%s returned (%f, %f, %f)\n", order->extrinsic ? "extrinsic " : "",
+               order->axes, recovered.roll, recovered.pitch, recovered.yaw);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(const OrderCase *order) {
+    const EulerAnglesf e = {0.3f, 0.5f, -1.0f, order->order};
+    const EulerAngles ed = {0.3f, 0.5f, -1.0f, order->order};
+    float dcm[3][3];
+    double expected[3][3];
+    EulerAnglesf recovered;
+
+    euler_to_dcm(&ed, expected);
+    if (!eulerf_to_dcm_checked(&e, dcm) ||
+        !eulerf_from_dcm_checked((const float (*)[3])dcm, order->order, &recovered) ||
+        !eulerf_to_dcm_checked(&recovered, dcm)) {
+        printf("FAIL: float API rejected %s\n", order->axes);
+        return 0;
+    }
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            if (fabs(dcm[row][column] - expected[row][column]) > 1e-5) {
+                printf("FAIL: float round trip %s differs from double\n", order->axes);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    const double pi = 3.14159265358979323846;
+    const double angles[][3] = {
+        {0.0, 0.0, 0.0},
+        {0.3, -0.4, 1.2},
+        {-2.9, 1.1, 3.0},
+        {1.0, pi / 2.0, -0.5},
+        {0.2, -pi / 2.0, 0.7},
+        {0.6, pi, -1.3},
+        {-0.6, 0.0, 2.3}
+    };
+    const EulerAngles invalid = {0.1, 0.2, 0.3, EULER_ORDER_COUNT};
+    double dcm[3][3];
+    EulerAngles e;
+
+    for (size_t o = 0; o < sizeof(k_orders) / sizeof(k_orders[0]); ++o) {
+        for (size_t a = 0; a < sizeof(angles) / sizeof(angles[0]); ++a) {
+            if (!check_angles(&k_orders[o], angles[a][0], angles[a][1], angles[a][2])) {
+                return 1;
+            }
+        }
+        if (!check_recovers_angles(&k_orders[o]) || !check_float(&k_orders[o])) {
+            return 1;
+        }
+    }
+
+    euler_to_dcm(&(EulerAngles){0.1, 0.2, 0.3, EULER_ZYX}, dcm);
+    if (euler_to_dcm_checked(&invalid, dcm) ||
+        euler_from_dcm_checked((const double (*)[3])dcm, EULER_ORDER_COUNT, &e)) {
+        printf("FAIL: invalid order accepted\n");
+        return 1;
+    }
+    euler_from_quaternion((const double[4]){0.0, 0.0, 0.0, 0.0}, EULER_ZYZ, &e);
+    if (!isnan(e.roll) || !isnan(e.pitch) || !isnan(e.yaw) || e.order != EULER_ZYZ) {
+        printf("FAIL: euler_from_quaternion accepted a zero quaternion\n");
+        return 1;
+    }
+
+    printf("PASS: all %zu Euler orders\n", sizeof(k_orders) / sizeof(k_orders[0]));
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "attitude/fixed_point.h"
+#include "attitude/quaternion.h"
+#include "attitude/validation.h"
+
+#define Q29_ONE ((int32_t)1 << 29)
+
+static unsigned int g_seed = 4242u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+static void random_q30(int32_t q[4]) {
+    const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+    double qd[4];
+    quaternion_exp(rotvec, qd);
+    quaternion_q30_from_double(qd, q);
+}
+
+/* Largest |fixed - expected| in units of the fixed format's last place. */
+static double error_lsb(const int32_t *fixed, const double *expected, int count, double one) {
+    double worst = 0.0;
+    for (int i = 0; i < count; ++i) {
+        worst = fmax(worst, fabs((double)fixed[i] - expected[i] * one));
+    }
+    return worst;
+}
+
+static int check_against_double(void) {
+    double worst_multiply = 0.0;
+    double worst_dcm = 0.0;
+    double worst_rotate = 0.0;
+    double worst_normalize = 0.0;
+
+    for (int n = 0; n < 20000; ++n) {
+        int32_t q[4];
+        int32_t p[4];
+        double qd[4];
+        double pd[4];
+        random_q30(q);
+        random_q30(p);
+        quaternion_q30_to_double(q, qd);
+        quaternion_q30_to_double(p, pd);
+
+        int32_t product[4];
+        double expected_product[4];
+        quaternion_q30_multiply(q, p, product);
+        quaternion_multiply(qd, pd, expected_product);
+        worst_multiply = fmax(worst_multiply, error_lsb(product, expected_product, 4, (double)ATTITUDE_Q30_ONE));
+
+        int32_t dcm[3][3];
+        double expected_dcm[3][3];
+        quaternion_q30_to_dcm(q, dcm);
+        quaternion_to_dcm(qd, expected_dcm);
+        worst_dcm = fmax(worst_dcm, error_lsb(&dcm[0][0], &expected_dcm[0][0], 9, (double)ATTITUDE_Q30_ONE));
+
+        // Q2.29 vector of length up to ~3.4, close to the top of its range.
+        int32_t v[3];
+        double vd[3];
+        for (int i = 0; i < 3; ++i) {
+            v[i] = (int32_t)lround(1.99 * random_unit() * Q29_ONE);
+            vd[i] = (double)v[i] / Q29_ONE;
+        }
+        int32_t rotated[3];
+        double expected_rotated[3];
+        quaternion_q30_rotate_vector(q, v, rotated);
+        quaternion_rotate_vector(qd, vd, expected_rotated);
+        worst_rotate = fmax(worst_rotate, error_lsb(rotated, expected_rotated, 3, (double)Q29_ONE));
+
+        // Drift the norm by up to +-30% and bring it back.
+        const double scale = 1.0 + 0.3 * random_unit();
+        int32_t drifted[4];
+        for (int i = 0; i < 4; ++i) {
+            drifted[i] = (int32_t)lround(qd[i] * scale * ATTITUDE_Q30_ONE);
+        }
+        double expected_unit[4];
+        double norm_sq = 0.0;
+        quaternion_q30_to_double(drifted, expected_unit);
+        for (int i = 0; i < 4; ++i) {
+            norm_sq += expected_unit[i] * expected_unit[i];
+        }
+        for (int i = 0; i < 4; ++i) {
+            expected_unit[i] /= sqrt(norm_sq);
+        }
+        if (!quaternion_q30_normalize(drifted)) {
+            printf("FAIL: quaternion_q30_normalize rejected a drifted quaternion\n");
+            return 0;
+        }
+        worst_normalize = fmax(worst_normalize, error_lsb(drifted, expected_unit, 4, (double)ATTITUDE_Q30_ONE));
+    }
+
+    if (worst_multiply > 1.0 || worst_dcm > 1.0 || worst_rotate > 3.0 || worst_normalize > 1.5) {
+        printf("FAIL: fixed-point error (LSB) multiply %.2f dcm %.2f rotate %.2f normalize %.2f\n", worst_multiply,
+               worst_dcm, worst_rotate, worst_normalize);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_normalize_range(void) {
+    /* Tiny, huge and saturated inputs all land on the unit sphere. */
+    int32_t cases[][4] = {
+        {3, -1, 2, 0},
+        {0, 0, 0, 1},
+        {INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX},
+        {INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN},
+        {INT32_MIN, 0, 0, 0},
+        {1000, 0, -1000, 0}
+    };
+    for (unsigned int c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+        double direction[4];
+        double norm_sq = 0.0;
+        for (int i = 0; i < 4; ++i) {
+            direction[i] = (double)cases[c][i];
+            norm_sq += direction[i] * direction[i];
+        }
+        for (int i = 0; i < 4; ++i) {
+            direction[i] /= sqrt(norm_sq);
+        }
+        if (!quaternion_q30_normalize(cases[c]) ||
+            error_lsb(cases[c], direction, 4, (double)ATTITUDE_Q30_ONE) > 1.5) {
+            printf("FAIL: quaternion_q30_normalize case %u\n", c);
+            return 0;
+        }
+    }
+
+    int32_t zero[4] = {0, 0, 0, 0};
+    if (quaternion_q30_normalize(zero) || quaternion_q30_normalize(NULL) || zero[0] != 0) {
+        printf("FAIL: quaternion_q30_normalize accepted zero\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_propagation(void) {
+    /* Body-rate integration q <- q (x) dq with renormalisation every step tracks the double one. */
+    const double rotvec[3] = {2e-3, -1.5e-3, 0.7e-3};
+    double dqd[4];
+    double qd[4] = {1.0, 0.0, 0.0, 0.0};
+    int32_t dq[4];
+    int32_t q[4] = {ATTITUDE_Q30_ONE, 0, 0, 0};
+    quaternion_exp(rotvec, dqd);
+    quaternion_q30_from_double(dqd, dq);
+    quaternion_q30_to_double(dq, dqd);
+
+    for (int n = 0; n < 100000; ++n) {
+        quaternion_q30_multiply(q, dq, q);
+        quaternion_q30_normalize(q);
+        quaternion_multiply(qd, dqd, qd);
+        quaternion_normalize(qd);
+    }
+    double q_back[4];
+    quaternion_q30_to_double(q, q_back);
+    double worst = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        worst = fmax(worst, fabs(q_back[i] - qd[i]));
+    }
+    if (worst > 1e-5) {
+        printf("FAIL: fixed-point propagation drifted by %.3g\n", worst);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_saturation_and_aliasing(void) {
+    /* (1.999 i + 1.999 j)^2 would need w = -8: clamps instead of wrapping. */
+    const int32_t big[4] = {0, INT32_MAX, INT32_MAX, 0};
+    int32_t out[4];
+    quaternion_q30_multiply(big, big, out);
+    if (out[0] != INT32_MIN || out[1] != 0 || out[2] != 0 || out[3] != 0) {
+        printf("FAIL: quaternion_q30_multiply saturation\n");
+        return 0;
+    }
+
+    /* 45 degrees about z turns (1.99, 1.99, 0) onto the y axis at length 2.8 > 2. */
+    const double half_turn_eighth[4] = {cos(M_PI / 8.0), 0.0, 0.0, sin(M_PI / 8.0)};
+    int32_t q[4];
+    int32_t v[3] = {INT32_MAX - 4, INT32_MAX - 4, -12345};
+    quaternion_q30_from_double(half_turn_eighth, q);
+    quaternion_q30_rotate_vector(q, v, v);
+    if (abs(v[0]) > 2 || v[1] != INT32_MAX || abs(v[2] + 12345) > 2) {
+        printf("FAIL: quaternion_q30_rotate_vector saturation\n");
+        return 0;
+    }
+
+    int32_t a[4];
+    int32_t b[4];
+    int32_t expected[4];
+    random_q30(a);
+    random_q30(b);
+    quaternion_q30_multiply(a, b, expected);
+    int32_t left[4];
+    memcpy(left, a, sizeof(a));
+    quaternion_q30_multiply(left, b, left);
+    int32_t right[4];
+    memcpy(right, b, sizeof(b));
+    quaternion_q30_multiply(a, right, right);
+    if (memcmp(left, expected, sizeof(expected)) != 0 || memcmp(right, expected, sizeof(expected)) != 0) {
+        printf("FAIL: quaternion_q30_multiply aliasing\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_conversions(void) {
+    const double unit[4] = {0.5, -0.5, 0.5, -0.5};
+    const double out_of_range[4] = {2.5, -2.5, 1.0, -1.0};
+    const double non_finite[4] = {1.0, INFINITY, 0.0, 0.0};
+    int32_t q[4];
+    double back[4];
+
+    if (!quaternion_q30_from_double(unit, q) || q[0] != ATTITUDE_Q30_ONE / 2 || q[1] != -ATTITUDE_Q30_ONE / 2) {
+        printf("FAIL: quaternion_q30_from_double unit\n");
+        return 0;
+    }
+    quaternion_q30_to_double(q, back);
+    if (memcmp(back, unit, sizeof(unit)) != 0) {
+        printf("FAIL: quaternion_q30_to_double round trip\n");
+        return 0;
+    }
+    if (!quaternion_q30_from_double(out_of_range, q) || q[0] != INT32_MAX || q[1] != INT32_MIN ||
+        q[2] != ATTITUDE_Q30_ONE || q[3] != -ATTITUDE_Q30_ONE) {
+        printf("FAIL: quaternion_q30_from_double saturation\n");
+        return 0;
+    }
+    memset(q, 0, sizeof(q));
+    if (quaternion_q30_from_double(non_finite, q) || quaternion_q30_from_double(NULL, q) ||
+        quaternion_q30_from_double(unit, NULL) || q[0] != 0) {
+        printf("FAIL: quaternion_q30_from_double rejections\n");
+        return 0;
+    }
+    if (attitude_validation_run() & ATTITUDE_VALIDATION_FIXED_POINT) {
+        printf("FAIL: fixed-point validation fixture\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_against_double() || !check_normalize_range() || !check_propagation() ||
+        !check_saturation_and_aliasing() || !check_conversions()) {
+        return 1;
+    }
+
+    printf("PASS: fixed-point quaternion API\n");
+    return 0;
+}
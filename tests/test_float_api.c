@@ -0,0 +1,126 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "attitude/dcm.h"
+#include "attitude/euler.h"
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+/* Float results are compared with the double API evaluated on the same (float) inputs. */
+static const double TOLERANCE = 2e-6;
+
+static int close_to(double a, double b) {
+    return fabs(a - b) <= TOLERANCE;
+}
+
+static int check_case(double roll, double pitch, double yaw) {
+    const EulerAngles e = {roll, pitch, yaw, EULER_ZYX};
+    const EulerAnglesf ef = {(float)roll, (float)pitch, (float)yaw, EULER_ZYX};
+    double q[4];
+    float qf[4];
+    double dcm[3][3];
+    float dcmf[3][3];
+
+    if (!euler_to_quaternion_checked(&e, q) || !eulerf_to_quaternion_checked(&ef, qf) ||
+        !euler_to_dcm_checked(&e, dcm) || !eulerf_to_dcm_checked(&ef, dcmf)) {
+        printf("FAIL: checked Euler conversion rejected (%f, %f, %f)\n", roll, pitch, yaw);
+        return 0;
+    }
+    for (int index = 0; index < 4; ++index) {
+        if (!close_to(q[index], qf[index])) {
+            printf("FAIL: eulerf_to_quaternion component %d differs\n", index);
+            return 0;
+        }
+    }
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            if (!close_to(dcm[row][column], dcmf[row][column])) {
+                printf("FAIL: eulerf_to_dcm element [%d][%d] differs\n", row, column);
+                return 0;
+            }
+        }
+    }
+
+    /* A float DCM must pass its own checked conversion; the double tolerance is too tight for it. */
+    float q_back[4];
+    if (!dcmf_is_orthonormal((const float (*)[3])dcmf, ATTITUDE_DCMF_ORTHONORMAL_TOL) ||
+        !dcmf_to_quaternion_checked((const float (*)[3])dcmf, q_back)) {
+        printf("FAIL: float DCM rejected at the float orthonormality tolerance\n");
+        return 0;
+    }
+    const double dot = fabs(q_back[0] * (double)qf[0] + q_back[1] * (double)qf[1] +
+                            q_back[2] * (double)qf[2] + q_back[3] * (double)qf[3]);
+    if (!close_to(dot, 1.0)) {
+        printf("FAIL: dcmf_to_quaternion_checked does not reconstruct the orientation\n");
+        return 0;
+    }
+
+    /* Rotation and composition */
+    const float v[3] = {0.25f, -1.5f, 2.0f};
+    const double vd[3] = {v[0], v[1], v[2]};
+    const double qd[4] = {qf[0], qf[1], qf[2], qf[3]};
+    float rotated[3];
+    double rotated_d[3];
+    quaternionf_rotate_vector(qf, v, rotated);
+    quaternion_rotate_vector(qd, vd, rotated_d);
+    for (int index = 0; index < 3; ++index) {
+        if (fabs(rotated[index] - rotated_d[index]) > 1e-5) {
+            printf("FAIL: quaternionf_rotate_vector component %d differs\n", index);
+            return 0;
+        }
+    }
+
+    float product[4];
+    double product_d[4];
+    quaternionf_multiply(qf, qf, product);
+    quaternion_multiply(qd, qd, product_d);
+    for (int index = 0; index < 4; ++index) {
+        if (!close_to(product[index], product_d[index])) {
+            printf("FAIL: quaternionf_multiply component %d differs\n", index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_vector_api(void) {
+    const float a[3] = {1.0f, 2.0f, 3.0f};
+    const float b[3] = {-2.0f, 0.5f, 4.0f};
+    float cross[3];
+    float unit[3] = {3.0f, 0.0f, 4.0f};
+    float tiny[3] = {0.0f, 0.0f, 0.0f};
+
+    vector3f_cross(a, b, cross);
+    if (vector3f_dot(a, b) != 11.0f || cross[0] != 6.5f || cross[1] != -10.0f || cross[2] != 4.5f) {
+        printf("FAIL: vector3f dot/cross\n");
+        return 0;
+    }
+    if (!vector3f_normalize_safe(unit) || fabsf(vector3f_mag(unit) - 1.0f) > 1e-6f ||
+        vector3f_normalize_safe(tiny)) {
+        printf("FAIL: vector3f normalisation\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    const double cases[][3] = {
+        {0.0, 0.0, 0.0},
+        {0.3, -0.4, 1.2},
+        {-2.9, 1.1, 3.0},
+        {1.0, 1.5707, -0.5},
+        {3.1, -0.2, -3.1}
+    };
+
+    for (unsigned int index = 0; index < sizeof(cases) / sizeof(cases[0]); ++index) {
+        if (!check_case(cases[index][0], cases[index][1], cases[index][2])) {
+            return 1;
+        }
+    }
+    if (!check_vector_api()) {
+        return 1;
+    }
+
+    printf("PASS: single-precision API matches the double API\n");
+    return 0;
+}
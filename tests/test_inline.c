@@ -0,0 +1,154 @@
+#define ATTITUDE_INLINE
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "attitude/dcm.h"
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+#if !defined(quaternion_multiply) || !defined(vector3_dot) || !defined(dcm_apply)
+#error "ATTITUDE_INLINE did not redirect the hot-path functions"
+#endif
+
+static unsigned int g_seed = 31337u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/*
+ * The inline bodies are the library's, so results agree to the last place unless this
+ * translation unit is compiled with FMA contraction; allow for that.
+ */
+static int agree(const double *a, const double *b, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (fabs(a[i] - b[i]) > 8.0 * DBL_EPSILON) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_double(void) {
+    for (int n = 0; n < 1000; ++n) {
+        const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+        double q[4];
+        double p[4] = {random_unit(), random_unit(), random_unit(), random_unit()};
+        double v[3] = {random_unit(), random_unit(), random_unit()};
+        double w[3] = {random_unit(), random_unit(), random_unit()};
+        quaternion_exp(rotvec, q);
+
+        double inlined[4];
+        double called[4];
+        quaternion_multiply(q, p, inlined);
+        (quaternion_multiply)(q, p, called);
+        if (!agree(inlined, called, 4)) {
+            printf("FAIL: inline quaternion_multiply\n");
+            return 0;
+        }
+
+        double dcm_inlined[3][3];
+        double dcm_called[3][3];
+        quaternion_to_dcm(q, dcm_inlined);
+        (quaternion_to_dcm)(q, dcm_called);
+        if (!agree(&dcm_inlined[0][0], &dcm_called[0][0], 9)) {
+            printf("FAIL: inline quaternion_to_dcm\n");
+            return 0;
+        }
+
+        quaternion_rotate_vector(q, v, inlined);
+        (quaternion_rotate_vector)(q, v, called);
+        if (!agree(inlined, called, 3)) {
+            printf("FAIL: inline quaternion_rotate_vector\n");
+            return 0;
+        }
+
+        dcm_apply((const double (*)[3])dcm_called, v, inlined);
+        (dcm_apply)((const double (*)[3])dcm_called, v, called);
+        if (!agree(inlined, called, 3)) {
+            printf("FAIL: inline dcm_apply\n");
+            return 0;
+        }
+
+        vector3_cross(v, w, inlined);
+        (vector3_cross)(v, w, called);
+        if (!agree(inlined, called, 3)) {
+            printf("FAIL: inline vector3_cross\n");
+            return 0;
+        }
+        vector3_add(v, w, inlined);
+        (vector3_add)(v, w, called);
+        vector3_sub(v, w, &inlined[1]);
+        (vector3_sub)(v, w, &called[1]);
+        if (!agree(inlined, called, 4)) {
+            printf("FAIL: inline vector3_add/vector3_sub\n");
+            return 0;
+        }
+        const double scalars_inlined[2] = {vector3_dot(v, w), vector3_mag(v)};
+        const double scalars_called[2] = {(vector3_dot)(v, w), (vector3_mag)(v)};
+        if (!agree(scalars_inlined, scalars_called, 2)) {
+            printf("FAIL: inline vector3_dot/vector3_mag\n");
+            return 0;
+        }
+    }
+
+    /* Aliasing contracts carry over: in-place multiply and rotate. */
+    double q[4] = {0.5, 0.5, -0.5, 0.5};
+    double expected[4];
+    double v[3] = {1.0, 2.0, 3.0};
+    double v_expected[3];
+    (quaternion_multiply)(q, q, expected);
+    quaternion_multiply(q, q, q);
+    (quaternion_rotate_vector)(expected, v, v_expected);
+    quaternion_rotate_vector(expected, v, v);
+    if (!agree(q, expected, 4) || !agree(v, v_expected, 3)) {
+        printf("FAIL: inline kernels with aliased output\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const float q[4] = {0.5f, -0.5f, 0.5f, 0.5f};
+    const float v[3] = {0.25f, -1.0f, 2.0f};
+    float inlined[4];
+    float called[4];
+    float dcm_inlined[3][3];
+    float dcm_called[3][3];
+
+    quaternionf_multiply(q, q, inlined);
+    (quaternionf_multiply)(q, q, called);
+    quaternionf_to_dcm(q, dcm_inlined);
+    (quaternionf_to_dcm)(q, dcm_called);
+    for (int i = 0; i < 4; ++i) {
+        if (fabsf(inlined[i] - called[i]) > 4.0f * FLT_EPSILON) {
+            printf("FAIL: inline quaternionf_multiply\n");
+            return 0;
+        }
+    }
+    for (int i = 0; i < 9; ++i) {
+        if (fabsf((&dcm_inlined[0][0])[i] - (&dcm_called[0][0])[i]) > 4.0f * FLT_EPSILON) {
+            printf("FAIL: inline quaternionf_to_dcm\n");
+            return 0;
+        }
+    }
+    quaternionf_rotate_vector(q, v, inlined);
+    dcmf_apply((const float (*)[3])dcm_called, v, called);
+    if (fabsf(inlined[0] - called[0]) > 8.0f * FLT_EPSILON || fabsf(vector3f_dot(v, v) - (vector3f_dot)(v, v)) > 0.0f ||
+        fabsf(vector3f_mag(v) - (vector3f_mag)(v)) > FLT_EPSILON) {
+        printf("FAIL: inline float kernels\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_double() || !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: ATTITUDE_INLINE header-only kernels\n");
+    return 0;
+}
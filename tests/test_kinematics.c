@@ -0,0 +1,260 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/kinematics.h"
+#include "attitude/quaternion.h"
+
+#define SAMPLE_RATE_HZ 8000.0
+#define CONING_SAMPLES 4800
+
+static double g_omega[CONING_SAMPLES][3];
+static double g_trajectory[CONING_SAMPLES][4];
+static double g_chained[CONING_SAMPLES][4];
+
+/* Angle of the rotation taking a to b, insensitive to quaternion sign. */
+static double attitude_error(const double a[4], const double b[4]) {
+    const double conj[4] = {a[0], -a[1], -a[2], -a[3]};
+    double delta[4];
+    quaternion_multiply(conj, b, delta);
+    return 2.0 * atan2(sqrt(delta[1] * delta[1] + delta[2] * delta[2] + delta[3] * delta[3]), fabs(delta[0]));
+}
+
+static void exact_constant_rate(const double omega[3], double t, double q[4]) {
+    const double rate = sqrt(omega[0] * omega[0] + omega[1] * omega[1] + omega[2] * omega[2]);
+    const double half = 0.5 * rate * t;
+    q[0] = cos(half);
+    q[1] = sin(half) * omega[0] / rate;
+    q[2] = sin(half) * omega[1] / rate;
+    q[3] = sin(half) * omega[2] / rate;
+}
+
+static int check_constant_rate(void) {
+    const double omega[3] = {0.9, -2.1, 3.4};
+    const double identity[4] = {1.0, 0.0, 0.0, 0.0};
+    const double dt = 1.0 / SAMPLE_RATE_HZ;
+    double expected[4];
+    double q[4];
+
+    for (int i = 0; i < CONING_SAMPLES; ++i) {
+        memcpy(g_omega[i], omega, sizeof(omega));
+    }
+    if (!kinematics_propagate(identity, &g_omega[0][0], CONING_SAMPLES, dt, &g_trajectory[0][0])) {
+        printf("FAIL: kinematics_propagate rejected valid input\n");
+        return 0;
+    }
+
+    /* The stream must be bit-identical to chaining the single-step call in place. */
+    memcpy(q, identity, sizeof(q));
+    for (int i = 0; i < CONING_SAMPLES; ++i) {
+        kinematics_integrate_exp(q, omega, dt, q);
+        if (memcmp(q, g_trajectory[i], sizeof(q)) != 0) {
+            printf("FAIL: kinematics_propagate differs from kinematics_integrate_exp at %d\n", i);
+            return 0;
+        }
+    }
+
+    exact_constant_rate(omega, CONING_SAMPLES * dt, expected);
+    const double *last = g_trajectory[CONING_SAMPLES - 1];
+    const double norm = sqrt(last[0] * last[0] + last[1] * last[1] + last[2] * last[2] + last[3] * last[3]);
+    if (attitude_error(expected, last) > 1e-12 || fabs(norm - 1.0) > 1e-14) {
+        printf("FAIL: constant-rate propagation error %.3e, norm error %.3e\n",
+               attitude_error(expected, last), fabs(norm - 1.0));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_large_steps(void) {
+    const double identity[4] = {1.0, 0.0, 0.0, 0.0};
+    const double axis[3] = {0.48, 0.6, -0.64};
+
+    /* Rotation-vector magnitudes on both sides of the series/sin-cos switch and beyond pi. */
+    const double angles[] = {1e-9, 0.15, 0.1549, 0.155, 0.16, 1.0, 2.0, 3.5, 6.0};
+    for (unsigned int i = 0; i < sizeof(angles) / sizeof(angles[0]); ++i) {
+        const double omega[3] = {axis[0] * angles[i], axis[1] * angles[i], axis[2] * angles[i]};
+        double expected[4];
+        double q[4];
+        double q_rk4[4];
+
+        exact_constant_rate(omega, 1.0, expected);
+        kinematics_integrate_exp(identity, omega, 1.0, q);
+        for (int c = 0; c < 4; ++c) {
+            if (fabs(q[c] - expected[c]) > 1e-15) {
+                printf("FAIL: kinematics_integrate_exp angle %g component %d off by %.3e\n", angles[i], c,
+                       fabs(q[c] - expected[c]));
+                return 0;
+            }
+        }
+        /* One RK4 step at constant rate has O(angle^5) error. */
+        kinematics_integrate_rk4(identity, omega, omega, 1.0, q_rk4);
+        if (angles[i] < 1.0 && attitude_error(expected, q_rk4) > 1e-3 * pow(angles[i], 5) + 1e-15) {
+            printf("FAIL: kinematics_integrate_rk4 angle %g error %.3e\n", angles[i],
+                   attitude_error(expected, q_rk4));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_rk4_varying_rate(void) {
+    /* Linearly ramping rate about a turning axis; reference from 100x finer RK4 steps. */
+    const double identity[4] = {1.0, 0.0, 0.0, 0.0};
+    double coarse[4];
+    double fine[4];
+    const int steps = 50;
+    const double duration = 0.5;
+
+    memcpy(coarse, identity, sizeof(coarse));
+    memcpy(fine, identity, sizeof(fine));
+    for (int step = 0; step < steps * 100; ++step) {
+        const double t0 = step * duration / (steps * 100);
+        const double t1 = (step + 1) * duration / (steps * 100);
+        const double w0[3] = {3.0 * t0, 1.0 - 2.0 * t0, 0.5};
+        const double w1[3] = {3.0 * t1, 1.0 - 2.0 * t1, 0.5};
+        kinematics_integrate_rk4(fine, w0, w1, t1 - t0, fine);
+    }
+    for (int step = 0; step < steps; ++step) {
+        const double t0 = step * duration / steps;
+        const double t1 = (step + 1) * duration / steps;
+        const double w0[3] = {3.0 * t0, 1.0 - 2.0 * t0, 0.5};
+        const double w1[3] = {3.0 * t1, 1.0 - 2.0 * t1, 0.5};
+        kinematics_integrate_rk4(coarse, w0, w1, t1 - t0, coarse);
+    }
+    if (attitude_error(fine, coarse) > 1e-9) {
+        printf("FAIL: RK4 with a ramping rate is off by %.3e\n", attitude_error(fine, coarse));
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Classical coning: q(t) = qz(W t) qx(b) qz(-W t). The body rate is W Rz(W t) u with
+ * u = (0, sin b, cos b - 1), so the gyro increments integrate in closed form.
+ */
+static void coning_truth(double beta, double rate, double t, double q[4]) {
+    const double a[4] = {cos(0.5 * rate * t), 0.0, 0.0, sin(0.5 * rate * t)};
+    const double a_conj[4] = {a[0], 0.0, 0.0, -a[3]};
+    const double b[4] = {cos(0.5 * beta), sin(0.5 * beta), 0.0, 0.0};
+    double ab[4];
+    quaternion_multiply(a, b, ab);
+    quaternion_multiply(ab, a_conj, q);
+}
+
+static void coning_increment(double beta, double rate, double t0, double t1, double dtheta[3]) {
+    const double uy = sin(beta);
+    const double uz = cos(beta) - 1.0;
+    dtheta[0] = uy * (cos(rate * t1) - cos(rate * t0));
+    dtheta[1] = uy * (sin(rate * t1) - sin(rate * t0));
+    dtheta[2] = uz * rate * (t1 - t0);
+}
+
+static double coning_drift(size_t samples_per_update, double *out_error) {
+    const double beta = 0.05;
+    const double rate = 2.0 * 3.14159265358979323846 * 40.0;
+    const double dt = 1.0 / SAMPLE_RATE_HZ;
+    double q0[4];
+    double truth[4];
+    double q[4];
+    const size_t updates = CONING_SAMPLES / samples_per_update;
+
+    for (int i = 0; i < CONING_SAMPLES; ++i) {
+        coning_increment(beta, rate, i * dt, (i + 1) * dt, g_omega[i]);
+    }
+    coning_truth(beta, rate, 0.0, q0);
+    if (!kinematics_propagate_coning(q0, &g_omega[0][0], CONING_SAMPLES, samples_per_update,
+                                     &g_trajectory[0][0])) {
+        return -1.0;
+    }
+
+    memcpy(q, q0, sizeof(q));
+    for (size_t update = 0; update < updates; ++update) {
+        kinematics_integrate_coning(q, g_omega[update * samples_per_update], samples_per_update, q);
+        memcpy(g_chained[update], q, sizeof(q));
+    }
+    if (memcmp(g_chained, g_trajectory, updates * sizeof(g_trajectory[0])) != 0) {
+        printf("FAIL: kinematics_propagate_coning differs from kinematics_integrate_coning\n");
+        return -1.0;
+    }
+
+    coning_truth(beta, rate, CONING_SAMPLES * dt, truth);
+    *out_error = attitude_error(truth, g_trajectory[updates - 1]);
+    return *out_error;
+}
+
+static int check_coning(void) {
+    double error[KINEMATICS_MAX_CONING_SAMPLES + 1];
+
+    for (size_t n = 1; n <= KINEMATICS_MAX_CONING_SAMPLES; ++n) {
+        if (coning_drift(n, &error[n]) < 0.0) {
+            printf("FAIL: coning propagation with %zu samples failed\n", n);
+            return 0;
+        }
+    }
+
+    /* Summing increments without correction drifts; each coning variant must be far better. */
+    if (!(error[2] < 0.01 * error[1] && error[3] < 0.01 * error[1] && error[4] < 0.01 * error[2])) {
+        printf("FAIL: coning drift 1:%.3e 2:%.3e 3:%.3e 4:%.3e\n", error[1], error[2], error[3], error[4]);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double q[4] = {1.0, 0.0, 0.0, 0.0};
+    const double omega[6] = {0.1, 0.2, 0.3, 0.1, 0.2, 0.3};
+    double out[8] = {0.0};
+
+    if (kinematics_integrate_exp(q, omega, NAN, out) || kinematics_integrate_exp(NULL, omega, 0.1, out) ||
+        kinematics_integrate_rk4(q, omega, NULL, 0.1, out) || kinematics_propagate(q, omega, 2, INFINITY, out) ||
+        kinematics_propagate(q, NULL, 2, 0.1, out) || !kinematics_propagate(q, NULL, 0, 0.1, NULL) ||
+        kinematics_integrate_coning(q, omega, 0, out) ||
+        kinematics_integrate_coning(q, omega, KINEMATICS_MAX_CONING_SAMPLES + 1, out) ||
+        kinematics_propagate_coning(q, omega, 2, 3, out) || kinematics_propagate_coning(q, omega, 2, 0, out)) {
+        printf("FAIL: kinematics argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const float identity[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+    const double identity_d[4] = {1.0, 0.0, 0.0, 0.0};
+    static float omega[CONING_SAMPLES][3];
+    static float trajectory[CONING_SAMPLES][4];
+    const double dt = 1.0 / SAMPLE_RATE_HZ;
+
+    for (int i = 0; i < CONING_SAMPLES; ++i) {
+        g_omega[i][0] = 2.0 * sin(0.003 * i);
+        g_omega[i][1] = -1.0;
+        g_omega[i][2] = 0.5 * cos(0.002 * i);
+        for (int c = 0; c < 3; ++c) {
+            omega[i][c] = (float)g_omega[i][c];
+        }
+    }
+    kinematics_propagate(identity_d, &g_omega[0][0], CONING_SAMPLES, dt, &g_trajectory[0][0]);
+    if (!kinematicsf_propagate(identity, &omega[0][0], CONING_SAMPLES, (float)dt, &trajectory[0][0])) {
+        printf("FAIL: kinematicsf_propagate rejected valid input\n");
+        return 0;
+    }
+
+    const double last[4] = {trajectory[CONING_SAMPLES - 1][0], trajectory[CONING_SAMPLES - 1][1],
+                            trajectory[CONING_SAMPLES - 1][2], trajectory[CONING_SAMPLES - 1][3]};
+    const double norm = sqrt(last[0] * last[0] + last[1] * last[1] + last[2] * last[2] + last[3] * last[3]);
+    if (attitude_error(g_trajectory[CONING_SAMPLES - 1], last) > 1e-4 || fabs(norm - 1.0) > 1e-6) {
+        printf("FAIL: float propagation differs from double by %.3e (norm error %.3e)\n",
+               attitude_error(g_trajectory[CONING_SAMPLES - 1], last), fabs(norm - 1.0));
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_constant_rate() || !check_large_steps() || !check_rk4_varying_rate() || !check_coning() ||
+        !check_rejections() || !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: quaternion kinematics integrators\n");
+    return 0;
+}
@@ -0,0 +1,518 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/kinematics.h"
+#include "attitude/mekf.h"
+#include "attitude/quaternion.h"
+
+#define N MEKF_STATE_DIM
+
+/* World references for the vector updates: z-up gravity and a field dipping ~65 degrees. */
+static const double k_up[3] = {0.0, 0.0, 1.0};
+static const double k_field_world[3] = {0.21, 0.0, -0.45};
+
+static unsigned int g_seed = 0x5eed1234u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/* Standard normal sample (Box-Muller). */
+static double random_gaussian(void) {
+    double u = 0.5 * (random_unit() + 1.0);
+    if (u < 1e-12) {
+        u = 1e-12;
+    }
+    const double v = random_unit();
+    return sqrt(-2.0 * log(u)) * cos(M_PI * v);
+}
+
+static void random_quaternion(double q[4]) {
+    for (int i = 0; i < 4; ++i) {
+        q[i] = random_unit();
+    }
+    quaternion_normalize(q);
+}
+
+/* Rotation angle between two attitudes (rad); sign-insensitive. */
+static double attitude_error(const double a[4], const double b[4]) {
+    double conjugate[4];
+    double difference[4];
+    quaternion_inverse(a, conjugate);
+    quaternion_multiply(conjugate, b, difference);
+    const double s = sqrt(difference[1] * difference[1] + difference[2] * difference[2] + difference[3] * difference[3]);
+    return 2.0 * atan2(s, fabs(difference[0]));
+}
+
+/* A well-conditioned random covariance, packed into the filter: L L^T + diagonal. */
+static void random_covariance(MekfFilter *filter, double dense[N][N]) {
+    double l[N][N];
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            l[i][j] = 0.1 * random_unit();
+        }
+    }
+    int n = 0;
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            double sum = (i == j) ? 0.05 : 0.0;
+            for (int k = 0; k < N; ++k) {
+                sum += l[i][k] * l[j][k];
+            }
+            dense[i][j] = sum;
+        }
+        for (int j = i; j < N; ++j) {
+            filter->p[n++] = dense[i][j];
+        }
+    }
+}
+
+static double covariance_difference(const MekfFilter *filter, const double expected[N][N]) {
+    double p[N][N];
+    mekf_covariance(filter, p);
+    double worst = 0.0;
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            worst = fmax(worst, fabs(p[i][j] - expected[i][j]));
+        }
+    }
+    return worst;
+}
+
+static void multiply6(const double a[N][N], const double b[N][N], double out[N][N]) {
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            double sum = 0.0;
+            for (int k = 0; k < N; ++k) {
+                sum += a[i][k] * b[k][j];
+            }
+            out[i][j] = sum;
+        }
+    }
+}
+
+/* Reference prediction: dense Phi P Phi^T + Q, with Theta built column by column. */
+static int check_predict_matches_dense(void) {
+    for (int trial = 0; trial < 50; ++trial) {
+        MekfFilter filter;
+        double p[N][N];
+        random_quaternion(filter.q);
+        for (int k = 0; k < 3; ++k) {
+            filter.bias[k] = 0.05 * random_unit();
+        }
+        random_covariance(&filter, p);
+        filter.gyro_noise = 1e-4 * (1.0 + random_unit());
+        filter.bias_noise = 1e-6 * (1.0 + random_unit());
+
+        const double gyro[3] = {2.0 * random_unit(), 2.0 * random_unit(), 2.0 * random_unit()};
+        const double dt = 0.05 * (1.0 + random_unit());
+        const double omega[3] = {gyro[0] - filter.bias[0], gyro[1] - filter.bias[1], gyro[2] - filter.bias[2]};
+        double q_expected[4];
+        kinematics_integrate_exp(filter.q, omega, dt, q_expected);
+
+        const double phi[3] = {omega[0] * dt, omega[1] * dt, omega[2] * dt};
+        double dq[4];
+        double dq_inv[4];
+        quaternion_exp(phi, dq);
+        quaternion_inverse(dq, dq_inv);
+
+        double phi_m[N][N] = {{0.0}};
+        for (int k = 0; k < 3; ++k) {
+            double axis[3] = {0.0, 0.0, 0.0};
+            double column[3];
+            axis[k] = 1.0;
+            quaternion_rotate_vector(dq_inv, axis, column);
+            for (int i = 0; i < 3; ++i) {
+                phi_m[i][k] = column[i];
+            }
+            phi_m[k][3 + k] = -dt;
+            phi_m[3 + k][3 + k] = 1.0;
+        }
+        double phi_t[N][N];
+        for (int i = 0; i < N; ++i) {
+            for (int j = 0; j < N; ++j) {
+                phi_t[i][j] = phi_m[j][i];
+            }
+        }
+        double tmp[N][N];
+        double expected[N][N];
+        multiply6(phi_m, p, tmp);
+        multiply6(tmp, phi_t, expected);
+        for (int k = 0; k < 3; ++k) {
+            expected[k][k] += filter.gyro_noise * dt + filter.bias_noise * dt * dt * dt / 3.0;
+            expected[k][3 + k] -= 0.5 * filter.bias_noise * dt * dt;
+            expected[3 + k][k] -= 0.5 * filter.bias_noise * dt * dt;
+            expected[3 + k][3 + k] += filter.bias_noise * dt;
+        }
+
+        if (!mekf_predict(&filter, gyro, dt)) {
+            printf("FAIL: mekf_predict rejected valid input\n");
+            return 0;
+        }
+        const double q_diff = attitude_error(filter.q, q_expected);
+        const double p_diff = covariance_difference(&filter, expected);
+        if (q_diff > 1e-14 || p_diff > 1e-15) {
+            printf("FAIL: predict trial %d attitude %.3e covariance %.3e from dense reference\n", trial, q_diff, p_diff);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Inverse of a symmetric positive definite 3x3 matrix by cofactors. */
+static void invert3(const double s[3][3], double out[3][3]) {
+    out[0][0] = s[1][1] * s[2][2] - s[1][2] * s[2][1];
+    out[0][1] = s[0][2] * s[2][1] - s[0][1] * s[2][2];
+    out[0][2] = s[0][1] * s[1][2] - s[0][2] * s[1][1];
+    out[1][0] = s[1][2] * s[2][0] - s[1][0] * s[2][2];
+    out[1][1] = s[0][0] * s[2][2] - s[0][2] * s[2][0];
+    out[1][2] = s[0][2] * s[1][0] - s[0][0] * s[1][2];
+    out[2][0] = s[1][0] * s[2][1] - s[1][1] * s[2][0];
+    out[2][1] = s[0][1] * s[2][0] - s[0][0] * s[2][1];
+    out[2][2] = s[0][0] * s[1][1] - s[0][1] * s[1][0];
+    const double det = s[0][0] * out[0][0] + s[0][1] * out[1][0] + s[0][2] * out[2][0];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            out[i][j] /= det;
+        }
+    }
+}
+
+/*
+ * Batch Kalman update for a 3-component measurement with Jacobian [h 0], residual z and noise
+ * variance * I: dx = K z and P - K H P with K = P H^T (H P H^T + R)^-1, then the same reset
+ * the filter applies.
+ */
+static void batch_update(const MekfFilter *prior,
+                         const double h[3][3],
+                         const double z[3],
+                         double variance,
+                         double q_out[4],
+                         double bias_out[3],
+                         double p_out[N][N]) {
+    double p[N][N];
+    mekf_covariance(prior, p);
+
+    double pht[N][3];
+    for (int i = 0; i < N; ++i) {
+        for (int m = 0; m < 3; ++m) {
+            pht[i][m] = p[i][0] * h[m][0] + p[i][1] * h[m][1] + p[i][2] * h[m][2];
+        }
+    }
+    double s[3][3];
+    for (int a = 0; a < 3; ++a) {
+        for (int b = 0; b < 3; ++b) {
+            s[a][b] = h[a][0] * pht[0][b] + h[a][1] * pht[1][b] + h[a][2] * pht[2][b] + (a == b ? variance : 0.0);
+        }
+    }
+    double s_inv[3][3];
+    invert3((const double (*)[3])s, s_inv);
+
+    double k[N][3];
+    double dx[N];
+    for (int i = 0; i < N; ++i) {
+        for (int m = 0; m < 3; ++m) {
+            k[i][m] = pht[i][0] * s_inv[0][m] + pht[i][1] * s_inv[1][m] + pht[i][2] * s_inv[2][m];
+        }
+        dx[i] = k[i][0] * z[0] + k[i][1] * z[1] + k[i][2] * z[2];
+    }
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            p_out[i][j] = p[i][j] - (k[i][0] * pht[j][0] + k[i][1] * pht[j][1] + k[i][2] * pht[j][2]);
+        }
+    }
+
+    const double dq[4] = {1.0, 0.5 * dx[0], 0.5 * dx[1], 0.5 * dx[2]};
+    quaternion_multiply(prior->q, dq, q_out);
+    quaternion_normalize(q_out);
+    for (int k3 = 0; k3 < 3; ++k3) {
+        bias_out[k3] = prior->bias[k3] + dx[3 + k3];
+    }
+}
+
+static int compare_with_batch(const char *label,
+                              int trial,
+                              const MekfFilter *filter,
+                              const double q_expected[4],
+                              const double bias_expected[3],
+                              const double p_expected[N][N]) {
+    const double q_diff = attitude_error(filter->q, q_expected);
+    double bias_diff = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        bias_diff = fmax(bias_diff, fabs(filter->bias[k] - bias_expected[k]));
+    }
+    const double p_diff = covariance_difference(filter, p_expected);
+    if (q_diff > 1e-12 || bias_diff > 1e-13 || p_diff > 1e-14) {
+        printf("FAIL: %s trial %d attitude %.3e bias %.3e covariance %.3e from batch update\n",
+               label, trial, q_diff, bias_diff, p_diff);
+        return 0;
+    }
+    return 1;
+}
+
+/* Sequential scalar updates must reproduce the batch (matrix-inverting) update exactly. */
+static int check_updates_match_batch(void) {
+    for (int trial = 0; trial < 50; ++trial) {
+        MekfFilter filter;
+        double p[N][N];
+        random_quaternion(filter.q);
+        for (int k = 0; k < 3; ++k) {
+            filter.bias[k] = 0.05 * random_unit();
+        }
+        random_covariance(&filter, p);
+        filter.gyro_noise = 1e-4;
+        filter.bias_noise = 1e-6;
+        const double variance = 1e-3 * (1.5 + random_unit());
+
+        // Vector update: a slightly perturbed measurement of a random reference direction.
+        double reference[3] = {random_unit(), random_unit(), random_unit()};
+        double truth[4];
+        double perturbation[4] = {1.0, 0.05 * random_unit(), 0.05 * random_unit(), 0.05 * random_unit()};
+        quaternion_normalize(perturbation);
+        quaternion_multiply(filter.q, perturbation, truth);
+        double truth_inv[4];
+        double measured[3];
+        quaternion_inverse(truth, truth_inv);
+        quaternion_rotate_vector(truth_inv, reference, measured);
+
+        const double r_norm = sqrt(reference[0] * reference[0] + reference[1] * reference[1] + reference[2] * reference[2]);
+        const double unit_reference[3] = {reference[0] / r_norm, reference[1] / r_norm, reference[2] / r_norm};
+        const double m_norm = sqrt(measured[0] * measured[0] + measured[1] * measured[1] + measured[2] * measured[2]);
+        double q_inv[4];
+        double y[3];
+        quaternion_inverse(filter.q, q_inv);
+        quaternion_rotate_vector(q_inv, unit_reference, y);
+        const double h[3][3] = {{0.0, -y[2], y[1]}, {y[2], 0.0, -y[0]}, {-y[1], y[0], 0.0}};
+        const double z[3] = {measured[0] / m_norm - y[0], measured[1] / m_norm - y[1], measured[2] / m_norm - y[2]};
+
+        double q_expected[4];
+        double bias_expected[3];
+        double p_expected[N][N];
+        batch_update(&filter, h, z, variance, q_expected, bias_expected, p_expected);
+        if (!mekf_update_vector(&filter, measured, reference, variance)) {
+            printf("FAIL: mekf_update_vector rejected valid input\n");
+            return 0;
+        }
+        if (!compare_with_batch("vector", trial, &filter, q_expected, bias_expected, p_expected)) {
+            return 0;
+        }
+
+        // Attitude update: H = [I 0] and z the rotation vector of q^-1 (x) q_meas. The
+        // measurement is passed with a flipped sign and a non-unit scale.
+        double q_meas[4];
+        double error_q[4];
+        double rotvec[3];
+        perturbation[1] = 0.05 * random_unit();
+        perturbation[2] = 0.05 * random_unit();
+        perturbation[3] = 0.05 * random_unit();
+        perturbation[0] = 1.0;
+        quaternion_normalize(perturbation);
+        quaternion_multiply(filter.q, perturbation, q_meas);
+        quaternion_inverse(filter.q, q_inv);
+        quaternion_multiply(q_inv, q_meas, error_q);
+        quaternion_log(error_q, rotvec);
+        for (int k = 0; k < 4; ++k) {
+            q_meas[k] *= -1.7;
+        }
+        const double identity[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+        batch_update(&filter, identity, rotvec, variance, q_expected, bias_expected, p_expected);
+        if (!mekf_update_attitude(&filter, q_meas, variance)) {
+            printf("FAIL: mekf_update_attitude rejected valid input\n");
+            return 0;
+        }
+        if (!compare_with_batch("attitude", trial, &filter, q_expected, bias_expected, p_expected)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void body_rate(double t, double omega[3]) {
+    omega[0] = 0.5 * sin(t);
+    omega[1] = 0.3 * cos(0.7 * t);
+    omega[2] = 0.2;
+}
+
+/*
+ * Closed loop with a noisy, biased 100 Hz gyro and 10 Hz gravity and magnetometer updates,
+ * starting 0.5 rad off: the estimate must converge and stay consistent with its covariance.
+ */
+static int check_convergence(void) {
+    const double dt = 0.01;
+    const double gyro_sigma = 1e-3;      // rad/s/sqrt(Hz)
+    const double bias_sigma = 1e-5;      // rad/s^2/sqrt(Hz)
+    const double vector_sigma = 0.01;
+    const double true_bias[3] = {0.01, -0.02, 0.015};
+
+    double truth[4] = {1.0, 0.0, 0.0, 0.0};
+    const double offset[3] = {0.3, -0.2, 0.35};
+    double q0[4];
+    quaternion_exp(offset, q0);
+
+    MekfFilter filter;
+    if (!mekf_init(&filter, q0, 0.5, 0.05, gyro_sigma, bias_sigma)) {
+        printf("FAIL: mekf_init rejected valid input\n");
+        return 0;
+    }
+
+    for (int step = 0; step < 30000; ++step) {
+        double omega[3];
+        body_rate(step * dt, omega);
+        double gyro[3];
+        for (int k = 0; k < 3; ++k) {
+            gyro[k] = omega[k] + true_bias[k] + gyro_sigma / sqrt(dt) * random_gaussian();
+        }
+        double next[4];
+        kinematics_integrate_exp(truth, omega, dt, next);
+        memcpy(truth, next, sizeof(truth));
+        mekf_predict(&filter, gyro, dt);
+
+        if (step % 10 == 9) {
+            double truth_inv[4];
+            double accel[3];
+            double mag[3];
+            quaternion_inverse(truth, truth_inv);
+            quaternion_rotate_vector(truth_inv, k_up, accel);
+            quaternion_rotate_vector(truth_inv, k_field_world, mag);
+            const double mag_norm = sqrt(mag[0] * mag[0] + mag[1] * mag[1] + mag[2] * mag[2]);
+            for (int k = 0; k < 3; ++k) {
+                accel[k] += vector_sigma * random_gaussian();
+                mag[k] += vector_sigma * mag_norm * random_gaussian();
+            }
+            if (!mekf_update_vector(&filter, accel, k_up, vector_sigma * vector_sigma) ||
+                !mekf_update_vector(&filter, mag, k_field_world, vector_sigma * vector_sigma)) {
+                printf("FAIL: vector update rejected simulated measurement at step %d\n", step);
+                return 0;
+            }
+        }
+    }
+
+    double p[N][N];
+    mekf_covariance(&filter, p);
+    const double angle = attitude_error(filter.q, truth);
+    const double attitude_sigma = sqrt(p[0][0] + p[1][1] + p[2][2]);
+    if (angle > 2e-2 || angle > 4.0 * attitude_sigma) {
+        printf("FAIL: MEKF attitude error %.3e rad (1-sigma %.3e)\n", angle, attitude_sigma);
+        return 0;
+    }
+    for (int k = 0; k < 3; ++k) {
+        const double error = fabs(filter.bias[k] - true_bias[k]);
+        if (!(p[3 + k][3 + k] > 0.0) || error > 1e-3 || error > 4.0 * sqrt(p[3 + k][3 + k])) {
+            printf("FAIL: MEKF bias[%d] error %.3e (1-sigma %.3e)\n", k, error, sqrt(p[3 + k][3 + k]));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_degenerate_inputs(void) {
+    MekfFilter filter;
+    const double zero4[4] = {0.0, 0.0, 0.0, 0.0};
+    const double zero3[3] = {0.0, 0.0, 0.0};
+    const double gyro[3] = {0.1, 0.2, 0.3};
+    const double nan3[3] = {NAN, 0.0, 0.0};
+    const double q_meas[4] = {1.0, 0.0, 0.0, 0.0};
+
+    if (mekf_init(NULL, NULL, 0.1, 0.01, 1e-3, 1e-5) || mekf_init(&filter, zero4, 0.1, 0.01, 1e-3, 1e-5) ||
+        mekf_init(&filter, NULL, -0.1, 0.01, 1e-3, 1e-5) || mekf_init(&filter, NULL, 0.1, NAN, 1e-3, 1e-5) ||
+        mekf_init(&filter, NULL, 0.1, 0.01, INFINITY, 1e-5)) {
+        printf("FAIL: mekf_init accepted invalid input\n");
+        return 0;
+    }
+    if (!mekf_init(&filter, NULL, 0.1, 0.01, 1e-3, 1e-5)) {
+        printf("FAIL: mekf_init rejected valid input\n");
+        return 0;
+    }
+
+    MekfFilter before = filter;
+    if (mekf_predict(NULL, gyro, 0.01) || mekf_predict(&filter, NULL, 0.01) || mekf_predict(&filter, nan3, 0.01) ||
+        mekf_predict(&filter, gyro, -0.01) || mekf_predict(&filter, gyro, NAN) ||
+        mekf_update_vector(&filter, zero3, k_up, 1e-4) || mekf_update_vector(&filter, k_up, zero3, 1e-4) ||
+        mekf_update_vector(&filter, nan3, k_up, 1e-4) || mekf_update_vector(&filter, k_up, k_up, 0.0) ||
+        mekf_update_vector(&filter, k_up, k_up, NAN) || mekf_update_vector(&filter, NULL, k_up, 1e-4) ||
+        mekf_update_attitude(&filter, zero4, 1e-4) || mekf_update_attitude(&filter, q_meas, -1e-4) ||
+        mekf_update_attitude(NULL, q_meas, 1e-4) || mekf_covariance(&filter, NULL)) {
+        printf("FAIL: MEKF accepted invalid input\n");
+        return 0;
+    }
+    if (memcmp(&before, &filter, sizeof(filter)) != 0) {
+        printf("FAIL: rejected MEKF input modified the filter\n");
+        return 0;
+    }
+
+    // A zero-length step leaves the estimate and covariance alone.
+    if (!mekf_predict(&filter, gyro, 0.0) || memcmp(&before, &filter, sizeof(filter)) != 0) {
+        printf("FAIL: zero-length MEKF step changed the filter\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const float dt = 0.01f;
+    const float true_bias[3] = {0.01f, -0.02f, 0.015f};
+    const float up[3] = {0.0f, 0.0f, 1.0f};
+    const float field[3] = {0.21f, 0.0f, -0.45f};
+    double truth[4] = {1.0, 0.0, 0.0, 0.0};
+
+    MekfFilterf filter;
+    if (!mekff_init(&filter, NULL, 0.3f, 0.05f, 1e-3f, 1e-5f)) {
+        printf("FAIL: mekff_init rejected valid input\n");
+        return 0;
+    }
+    for (int step = 0; step < 20000; ++step) {
+        double omega[3];
+        body_rate(step * (double)dt, omega);
+        const float gyro[3] = {
+            (float)omega[0] + true_bias[0],
+            (float)omega[1] + true_bias[1],
+            (float)omega[2] + true_bias[2]
+        };
+        double next[4];
+        kinematics_integrate_exp(truth, omega, dt, next);
+        memcpy(truth, next, sizeof(truth));
+        mekff_predict(&filter, gyro, dt);
+
+        if (step % 10 == 9) {
+            double truth_inv[4];
+            double accel[3];
+            double mag[3];
+            const double field_d[3] = {field[0], field[1], field[2]};
+            quaternion_inverse(truth, truth_inv);
+            quaternion_rotate_vector(truth_inv, k_up, accel);
+            quaternion_rotate_vector(truth_inv, field_d, mag);
+            const float accelf[3] = {(float)accel[0], (float)accel[1], (float)accel[2]};
+            const float magf[3] = {(float)mag[0], (float)mag[1], (float)mag[2]};
+            mekff_update_vector(&filter, accelf, up, 1e-4f);
+            mekff_update_vector(&filter, magf, field, 1e-4f);
+        }
+    }
+
+    const double estimate[4] = {filter.q[0], filter.q[1], filter.q[2], filter.q[3]};
+    const double angle = attitude_error(estimate, truth);
+    float p[N][N];
+    mekff_covariance(&filter, p);
+    if (angle > 1e-3) {
+        printf("FAIL: float MEKF attitude error %.3e rad\n", angle);
+        return 0;
+    }
+    for (int k = 0; k < 3; ++k) {
+        if (!(p[k][k] > 0.0f) || !(p[3 + k][3 + k] > 0.0f) || fabsf(filter.bias[k] - true_bias[k]) > 1e-3f) {
+            printf("FAIL: float MEKF bias[%d] error %.3e\n", k, (double)fabsf(filter.bias[k] - true_bias[k]));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_predict_matches_dense() || !check_updates_match_batch() || !check_convergence() ||
+        !check_degenerate_inputs() || !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: multiplicative EKF\n");
+    return 0;
+}
@@ -0,0 +1,316 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/average.h"
+#include "attitude/quaternion.h"
+
+#define SAMPLE_COUNT 2000
+
+static unsigned int g_seed = 424242u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/* Rotation angle between two orientations, insensitive to sign. */
+static double rotation_error(const double a[4], const double b[4]) {
+    const double d[4] = {a[0] - b[0], a[1] - b[1], a[2] - b[2], a[3] - b[3]};
+    const double s[4] = {a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]};
+    const double nd = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3]);
+    const double ns = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2] + s[3] * s[3]);
+    return 4.0 * atan2(fmin(nd, ns), fmax(nd, ns));
+}
+
+/* Samples scattered about mean by rotation vectors of up to spread rad per axis, random sign and scale. */
+static void make_cloud(const double mean[4], double spread, size_t count, double *q, double *weights) {
+    for (size_t i = 0; i < count; ++i) {
+        const double rotvec[3] = {spread * random_unit(), spread * random_unit(), spread * random_unit()};
+        double dq[4];
+        quaternion_exp(rotvec, dq);
+        quaternion_multiply(mean, dq, &q[4 * i]);
+        const double scale = (random_unit() < 0.0 ? -1.0 : 1.0) * (1.0 + 0.5 * random_unit());
+        for (int k = 0; k < 4; ++k) {
+            q[4 * i + k] *= scale;
+        }
+        if (weights != NULL) {
+            weights[i] = 1.0 + 0.9 * random_unit();
+        }
+    }
+}
+
+/* Markley's objective sum a (q . q_i)^2 / |q_i|^2. */
+static double objective(const double mean[4], const double *q, const double *weights, size_t count) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const double *s = &q[4 * i];
+        const double dot = mean[0] * s[0] + mean[1] * s[1] + mean[2] * s[2] + mean[3] * s[3];
+        const double n2 = s[0] * s[0] + s[1] * s[1] + s[2] * s[2] + s[3] * s[3];
+        sum += weights[i] * dot * dot / n2;
+    }
+    return sum;
+}
+
+static int check_symmetric_cloud(void) {
+    /* Samples in +/- pairs of perturbations: the mean is exact however the signs fall. */
+    const double rotvec[3] = {0.4, -2.5, 1.1};
+    double mean[4];
+    double q[4 * 8];
+    quaternion_exp(rotvec, mean);
+    for (int k = 0; k < 4; ++k) {
+        const double offsets[2][3] = {{k == 1 ? 0.3 : 0.0, k == 2 ? 0.3 : 0.0, k == 3 ? 0.3 : 0.0},
+                                      {k == 1 ? -0.3 : 0.0, k == 2 ? -0.3 : 0.0, k == 3 ? -0.3 : 0.0}};
+        for (int side = 0; side < 2; ++side) {
+            double dq[4];
+            quaternion_exp(k == 0 ? (const double[3]){0.0, 0.0, 0.0} : offsets[side], dq);
+            quaternion_multiply(mean, dq, &q[4 * (2 * k + side)]);
+            if ((k + side) % 2 == 1) {
+                for (int c = 0; c < 4; ++c) {
+                    q[4 * (2 * k + side) + c] = -q[4 * (2 * k + side) + c];
+                }
+            }
+        }
+    }
+
+    QuaternionAverage acc;
+    double eigen[4];
+    double fast[4];
+    quaternion_average_init(&acc);
+    if (!quaternion_average_push_batch(&acc, q, NULL, 8) || acc.count != 8 || acc.weight_sum != 8.0 ||
+        !quaternion_average_eigen(&acc, eigen) || !quaternion_average_fast(&acc, fast)) {
+        printf("FAIL: symmetric cloud rejected\n");
+        return 0;
+    }
+    if (rotation_error(eigen, mean) > 1e-14 || rotation_error(fast, mean) > 1e-14 || eigen[0] < 0.0 ||
+        fast[0] < 0.0) {
+        printf("FAIL: symmetric cloud mean off by %.3e (eigen) / %.3e (fast) rad\n", rotation_error(eigen, mean),
+               rotation_error(fast, mean));
+        return 0;
+    }
+
+    /* Naive component averaging of the same samples is nowhere near. */
+    double naive[4] = {0.0, 0.0, 0.0, 0.0};
+    for (int i = 0; i < 8; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            naive[c] += q[4 * i + c];
+        }
+    }
+    const double naive_norm = sqrt(naive[0] * naive[0] + naive[1] * naive[1] + naive[2] * naive[2] + naive[3] * naive[3]);
+    if (naive_norm > 1e-12 && rotation_error(naive, mean) < 0.1) {
+        printf("FAIL: test cloud does not exercise the sign ambiguity\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_optimality(void) {
+    static double q[4 * SAMPLE_COUNT];
+    static double weights[SAMPLE_COUNT];
+    const double spreads[] = {1e-6, 0.05, 0.5, 1.5};
+
+    for (unsigned int s = 0; s < sizeof(spreads) / sizeof(spreads[0]); ++s) {
+        double mean[4];
+        const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+        quaternion_exp(rotvec, mean);
+        make_cloud(mean, spreads[s], SAMPLE_COUNT, q, weights);
+
+        QuaternionAverage acc;
+        double eigen[4];
+        double fast[4];
+        quaternion_average_init(&acc);
+        for (size_t i = 0; i < SAMPLE_COUNT; ++i) {
+            if (!quaternion_average_push(&acc, &q[4 * i], weights[i])) {
+                printf("FAIL: push rejected sample %zu\n", i);
+                return 0;
+            }
+        }
+        if (!quaternion_average_eigen(&acc, eigen) || !quaternion_average_fast(&acc, fast)) {
+            printf("FAIL: spread %.3g rejected\n", spreads[s]);
+            return 0;
+        }
+        if (rotation_error(fast, eigen) > 4e-15 || fast[0] < 0.0 || eigen[0] < 0.0) {
+            printf("FAIL: fast and eigen disagree by %.3e rad at spread %.3g\n", rotation_error(fast, eigen),
+                   spreads[s]);
+            return 0;
+        }
+        if (spreads[s] < 1.0 && rotation_error(eigen, mean) > spreads[s]) {
+            printf("FAIL: spread %.3g mean off by %.3e rad\n", spreads[s], rotation_error(eigen, mean));
+            return 0;
+        }
+
+        /* The mean maximises the objective: no small rotation of it does better. */
+        const double best = objective(eigen, q, weights, SAMPLE_COUNT);
+        for (int k = 0; k < 3; ++k) {
+            for (int side = -1; side <= 1; side += 2) {
+                double nudge[3] = {0.0, 0.0, 0.0};
+                double dq[4];
+                double candidate[4];
+                nudge[k] = side * 1e-4;
+                quaternion_exp(nudge, dq);
+                quaternion_multiply(eigen, dq, candidate);
+                if (objective(candidate, q, weights, SAMPLE_COUNT) > best) {
+                    printf("FAIL: mean is not a maximum at spread %.3g\n", spreads[s]);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_merge(void) {
+    static double q[4 * SAMPLE_COUNT];
+    static double weights[SAMPLE_COUNT];
+    const double mean[4] = {0.5, -0.5, 0.5, 0.5};
+    make_cloud(mean, 0.3, SAMPLE_COUNT, q, weights);
+
+    /* One pass versus four "threads" of uneven size merged in reverse order. */
+    QuaternionAverage whole;
+    QuaternionAverage parts[4];
+    const size_t bounds[5] = {0, 1, 700, 1500, SAMPLE_COUNT};
+    quaternion_average_init(&whole);
+    quaternion_average_push_batch(&whole, q, weights, SAMPLE_COUNT);
+    for (int p = 0; p < 4; ++p) {
+        quaternion_average_init(&parts[p]);
+        quaternion_average_push_batch(&parts[p], &q[4 * bounds[p]], &weights[bounds[p]], bounds[p + 1] - bounds[p]);
+    }
+    for (int p = 2; p >= 0; --p) {
+        quaternion_average_merge(&parts[3], &parts[p]);
+    }
+
+    double a[4];
+    double b[4];
+    if (parts[3].count != SAMPLE_COUNT || fabs(parts[3].weight_sum - whole.weight_sum) > 1e-12 * whole.weight_sum ||
+        !quaternion_average_eigen(&whole, a) || !quaternion_average_fast(&parts[3], b) || rotation_error(a, b) > 1e-13) {
+        printf("FAIL: merged accumulators disagree with a single pass by %.3e rad\n", rotation_error(a, b));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_degenerate(void) {
+    /* Two orthogonal rotations of equal weight: every point of the great circle between them ties. */
+    const double q[8] = {1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    QuaternionAverage acc;
+    double eigen[4];
+    double fast[4];
+    quaternion_average_init(&acc);
+    quaternion_average_push_batch(&acc, q, NULL, 2);
+    if (!quaternion_average_eigen(&acc, eigen) || !quaternion_average_fast(&acc, fast) || fabs(eigen[2]) > 1e-15 ||
+        fabs(eigen[3]) > 1e-15 || fabs(fast[2]) > 1e-15 || fabs(fast[3]) > 1e-15 ||
+        fabs(fast[0] * fast[0] + fast[1] * fast[1] - 1.0) > 1e-15) {
+        printf("FAIL: degenerate average left the tied subspace\n");
+        return 0;
+    }
+
+    /* The heavier sample wins even though the lighter one has the largest diagonal entry of M. */
+    const double uneven[8] = {sqrt(0.5), sqrt(0.5), 0.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+    const double uneven_weights[2] = {1.0, 0.9};
+    quaternion_average_init(&acc);
+    quaternion_average_push_batch(&acc, uneven, uneven_weights, 2);
+    if (!quaternion_average_eigen(&acc, eigen) || !quaternion_average_fast(&acc, fast) ||
+        rotation_error(eigen, uneven) > 1e-15 || rotation_error(fast, uneven) > 1e-15) {
+        printf("FAIL: fast average picked the lighter sample (%.3e rad off)\n", rotation_error(fast, uneven));
+        return 0;
+    }
+
+    /* A single sample is its own mean. */
+    const double single[4] = {-0.1, 0.2, -0.7, 0.3};
+    const double expected[4] = {0.1 / sqrt(0.63), -0.2 / sqrt(0.63), 0.7 / sqrt(0.63), -0.3 / sqrt(0.63)};
+    quaternion_average_init(&acc);
+    quaternion_average_push(&acc, single, 3.0);
+    if (!quaternion_average_fast(&acc, fast) || !quaternion_average_eigen(&acc, eigen)) {
+        printf("FAIL: single sample rejected\n");
+        return 0;
+    }
+    for (int k = 0; k < 4; ++k) {
+        if (fabs(fast[k] - expected[k]) > 1e-15 || fabs(eigen[k] - expected[k]) > 1e-15) {
+            printf("FAIL: single sample average is not the sample\n");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    static double q[4 * SAMPLE_COUNT];
+    static float qf[4 * SAMPLE_COUNT];
+    static float weightsf[SAMPLE_COUNT];
+    double weights[SAMPLE_COUNT];
+    const double mean[4] = {0.2, 0.6, -0.3, sqrt(1.0 - 0.49)};
+    make_cloud(mean, 0.2, SAMPLE_COUNT, q, weights);
+    for (size_t i = 0; i < 4 * SAMPLE_COUNT; ++i) {
+        qf[i] = (float)q[i];
+    }
+    for (size_t i = 0; i < SAMPLE_COUNT; ++i) {
+        weightsf[i] = (float)weights[i];
+    }
+
+    QuaternionAverage acc;
+    QuaternionAveragef accf;
+    double reference[4];
+    float eigenf[4];
+    float fastf[4];
+    quaternion_average_init(&acc);
+    quaternion_average_push_batch(&acc, q, weights, SAMPLE_COUNT);
+    quaternion_average_eigen(&acc, reference);
+    quaternionf_average_init(&accf);
+    if (!quaternionf_average_push(&accf, qf, weightsf[0]) ||
+        !quaternionf_average_push_batch(&accf, &qf[4], &weightsf[1], SAMPLE_COUNT - 1) || !quaternionf_average_eigen(&accf, eigenf) ||
+        !quaternionf_average_fast(&accf, fastf)) {
+        printf("FAIL: float average rejected valid input\n");
+        return 0;
+    }
+    const double eigen[4] = {eigenf[0], eigenf[1], eigenf[2], eigenf[3]};
+    const double fast[4] = {fastf[0], fastf[1], fastf[2], fastf[3]};
+    if (rotation_error(eigen, reference) > 4e-6 || rotation_error(fast, reference) > 4e-6) {
+        printf("FAIL: float average off by %.3e (eigen) / %.3e (fast) rad\n", rotation_error(eigen, reference),
+               rotation_error(fast, reference));
+        return 0;
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double good[4] = {1.0, 0.0, 0.0, 0.0};
+    const double zero[4] = {0.0, 0.0, 0.0, 0.0};
+    const double nan_q[4] = {NAN, 0.0, 0.0, 1.0};
+    const double inf_q[4] = {INFINITY, 0.0, 0.0, 1.0};
+    const double batch[12] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    const double batch_weights[3] = {1.0, 1.0, -1.0};
+    QuaternionAverage acc;
+    double q[4] = {7.0, 7.0, 7.0, 7.0};
+
+    quaternion_average_init(&acc);
+    if (quaternion_average_init(NULL) || quaternion_average_eigen(&acc, q) || quaternion_average_fast(&acc, q) ||
+        quaternion_average_push(NULL, good, 1.0) || quaternion_average_push(&acc, NULL, 1.0) ||
+        quaternion_average_push(&acc, zero, 1.0) || quaternion_average_push(&acc, nan_q, 1.0) ||
+        quaternion_average_push(&acc, inf_q, 1.0) || quaternion_average_push(&acc, good, 0.0) ||
+        quaternion_average_push(&acc, good, -1.0) || quaternion_average_push(&acc, good, NAN) ||
+        quaternion_average_push_batch(NULL, batch, NULL, 3) || quaternion_average_push_batch(&acc, NULL, NULL, 3) ||
+        quaternion_average_merge(&acc, NULL) || quaternion_average_merge(NULL, &acc) || acc.count != 0 ||
+        acc.weight_sum != 0.0 || q[0] != 7.0) {
+        printf("FAIL: averaging argument checks\n");
+        return 0;
+    }
+
+    /* A batch with a zero sample and a negative weight keeps only the good sample. */
+    if (quaternion_average_push_batch(&acc, batch, batch_weights, 3) || acc.count != 1 || acc.weight_sum != 1.0 ||
+        !quaternion_average_push_batch(&acc, NULL, NULL, 0) || quaternion_average_eigen(&acc, NULL) ||
+        !quaternion_average_eigen(&acc, q) || q[0] != 1.0) {
+        printf("FAIL: partially invalid batch\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_symmetric_cloud() || !check_optimality() || !check_merge() || !check_degenerate() || !check_float() ||
+        !check_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: quaternion averaging\n");
+    return 0;
+}
@@ -0,0 +1,323 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/quaternion_codec.h"
+
+#define COUNT 20000
+
+static unsigned int g_seed = 0xc0dec25u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+static double g_input[COUNT][4];
+static double g_output[COUNT][4];
+static unsigned char g_packed[QUATERNION_PACK_BYTES(COUNT, QUATERNION_CODEC_MAX_BITS) + 16];
+static unsigned char g_stream[QUATERNION_STREAM_MAX_BYTES(COUNT, QUATERNION_CODEC_MAX_BITS) + 16];
+
+/* Rotation angle between two quaternions, either sign. */
+static double angle_between(const double a[4], const double b[4]) {
+    const double na = sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2] + a[3] * a[3]);
+    const double nb = sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2] + b[3] * b[3]);
+    const double dot = fabs(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]) / (na * nb);
+    /* 4 asin(|a - b| / 2) for the closer of +-b keeps precision for tiny angles. */
+    double chord2 = 2.0 - 2.0 * (dot > 1.0 ? 1.0 : dot);
+    return 4.0 * asin(0.5 * sqrt(chord2 > 0.0 ? chord2 : 0.0));
+}
+
+/* Random unit quaternions, with the hard cases mixed in: ties for the largest component, the
+ * largest component as small as it gets (all four 1/2), and one huge or tiny input. */
+static void fill_random(void) {
+    for (size_t i = 0; i < COUNT; ++i) {
+        double *q = g_input[i];
+        for (int k = 0; k < 4; ++k) {
+            q[k] = random_unit();
+        }
+        if (i % 7 == 1) {
+            for (int k = 0; k < 4; ++k) {
+                q[k] = (q[k] < 0.0 ? -0.5 : 0.5) + 1e-3 * random_unit();
+            }
+        } else if (i % 11 == 2) {
+            q[1] = q[0];
+        } else if (i % 13 == 3) {
+            q[2] = q[3] = 0.0;
+        }
+        quaternion_normalize(q);
+    }
+    for (int k = 0; k < 4; ++k) {
+        g_input[5][k] *= 1e12;
+        g_input[6][k] *= 1e-12;
+    }
+}
+
+/* Angular error of every decoded sample against the documented bound; returns the maximum. */
+static double max_error(size_t count, unsigned bits, const char *what) {
+    double worst = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const double err = angle_between(g_input[i], g_output[i]);
+        if (!(err <= quaternion_codec_max_error(bits))) {
+            printf("FAIL: %s at %u bits: sample %zu off by %.3e rad (bound %.3e)\n", what, bits, i, err,
+                   quaternion_codec_max_error(bits));
+            return -1.0;
+        }
+        worst = err > worst ? err : worst;
+    }
+    return worst;
+}
+
+static int check_pack(void) {
+    fill_random();
+    for (unsigned bits = QUATERNION_CODEC_MIN_BITS; bits <= QUATERNION_CODEC_MAX_BITS; ++bits) {
+        const size_t bytes = QUATERNION_PACK_BYTES(COUNT, bits);
+        memset(g_packed, 0xa5, sizeof(g_packed));
+        if (!quaternion_pack(&g_input[0][0], COUNT, bits, g_packed) ||
+            !quaternion_unpack(g_packed, COUNT, bits, &g_output[0][0])) {
+            printf("FAIL: pack/unpack at %u bits\n", bits);
+            return 0;
+        }
+        for (size_t i = bytes; i < sizeof(g_packed); ++i) {
+            if (g_packed[i] != 0xa5) {
+                printf("FAIL: pack at %u bits wrote past QUATERNION_PACK_BYTES\n", bits);
+                return 0;
+            }
+        }
+        const double worst = max_error(COUNT, bits, "pack");
+        /* The bound is tight: the all-1/2 samples come close to it. */
+        if (worst < 0.0 || worst < 0.5 * quaternion_codec_max_error(bits)) {
+            if (worst >= 0.0) {
+                printf("FAIL: pack at %u bits: worst error %.3e is far below the bound\n", bits, worst);
+            }
+            return 0;
+        }
+        for (size_t i = 0; i < COUNT; ++i) {
+            const double *q = g_output[i];
+            const double n = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            int largest = 0;
+            for (int k = 1; k < 4; ++k) {
+                largest = fabs(g_input[i][k]) > fabs(g_input[i][largest]) ? k : largest;
+            }
+            if (fabs(n - 1.0) > 1e-15 || q[largest] < 0.0) {
+                printf("FAIL: unpacked sample %zu at %u bits: norm %.17g, w/x/y/z[%d] = %.3g\n", i, bits, n, largest,
+                       q[largest]);
+                return 0;
+            }
+        }
+    }
+
+    /* Records decode independently, so a sub-range unpacks from the same bytes. */
+    double tail[4];
+    if (!quaternion_pack(&g_input[0][0], 3, 10, g_packed) || !quaternion_unpack(g_packed, 3, 10, &g_output[0][0]) ||
+        !quaternion_unpack(g_packed, 3, 10, &g_output[3][0])) {
+        return 0;
+    }
+    memcpy(tail, g_output[2], sizeof(tail));
+    if (memcmp(tail, g_output[5], sizeof(tail)) != 0) {
+        printf("FAIL: unpack not deterministic\n");
+        return 0;
+    }
+    return 1;
+}
+
+/* Bit layout at 10 bits: a 32-bit record, index in bits 0-1, then three 10-bit fields offset
+ * by 512 (zero). */
+static int check_layout(void) {
+    const double q[2][4] = {{1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, -1.0, 0.0}};
+    unsigned char packed[QUATERNION_PACK_BYTES(2, 10)];
+    double out[2][4];
+    const unsigned record0 = 0u | (512u << 2) | (512u << 12) | (512u << 22);
+    const unsigned record1 = 2u | (512u << 2) | (512u << 12) | (512u << 22);
+    const unsigned char expected[8] = {(unsigned char)record0, (unsigned char)(record0 >> 8),
+                                       (unsigned char)(record0 >> 16), (unsigned char)(record0 >> 24),
+                                       (unsigned char)record1, (unsigned char)(record1 >> 8),
+                                       (unsigned char)(record1 >> 16), (unsigned char)(record1 >> 24)};
+    if (sizeof(packed) != 8 || !quaternion_pack(&q[0][0], 2, 10, packed) || memcmp(packed, expected, 8) != 0 ||
+        !quaternion_unpack(packed, 2, 10, &out[0][0])) {
+        printf("FAIL: packed layout\n");
+        return 0;
+    }
+    /* Zero is a quantisation level, so axis-aligned rotations come back exactly. */
+    const double flipped[4] = {0.0, 0.0, 1.0, 0.0};
+    if (memcmp(out[0], q[0], sizeof(out[0])) != 0 || memcmp(out[1], flipped, sizeof(out[1])) != 0) {
+        printf("FAIL: identity / axis rotation not exact\n");
+        return 0;
+    }
+    return 1;
+}
+
+/* A 1 kHz attitude: steady spin plus slow coning and a little sensor-rate noise. */
+static void fill_trajectory(double noise) {
+    for (size_t i = 0; i < COUNT; ++i) {
+        const double t = 1e-3 * (double)i;
+        const double rotvec[3] = {0.3 * sin(2.0 * t), 0.2 * cos(1.3 * t), 1.5 * t};
+        quaternion_exp(rotvec, g_input[i]);
+        for (int k = 0; k < 4; ++k) {
+            g_input[i][k] += noise * random_unit();
+        }
+        quaternion_normalize(g_input[i]);
+    }
+}
+
+static int round_trip_stream(const QuaternionStreamConfig *config, size_t *size, const char *what) {
+    if (!quaternion_stream_encode(&g_input[0][0], COUNT, config, g_stream, sizeof(g_stream), size) || *size == 0 ||
+        *size > QUATERNION_STREAM_MAX_BYTES(COUNT, config->bits) ||
+        !quaternion_stream_decode(g_stream, *size, COUNT, config, &g_output[0][0])) {
+        printf("FAIL: %s stream at %u bits\n", what, config->bits);
+        return 0;
+    }
+    return max_error(COUNT, config->bits, what) >= 0.0;
+}
+
+static int check_streams(void) {
+    for (unsigned bits = QUATERNION_CODEC_MIN_BITS; bits <= QUATERNION_CODEC_MAX_BITS; ++bits) {
+        fill_trajectory(0.0);
+        QuaternionStreamConfig delta = {bits, QUATERNION_CODEC_DELTA, 0};
+        QuaternionStreamConfig predictive = {bits, QUATERNION_CODEC_PREDICTIVE, 0};
+        size_t delta_size;
+        size_t predictive_size;
+        if (!round_trip_stream(&delta, &delta_size, "delta") ||
+            !round_trip_stream(&predictive, &predictive_size, "predictive")) {
+            return 0;
+        }
+        /* Smooth motion: both beat fixed-width packing. Once the step per sample spans several
+         * quantisation levels, extrapolating it beats plain deltas. */
+        const size_t packed_size = QUATERNION_PACK_BYTES(COUNT, bits);
+        if (delta_size >= packed_size || predictive_size >= packed_size ||
+            (bits >= 12 && predictive_size >= delta_size / 2)) {
+            printf("FAIL: %u bits: packed %zu, delta %zu, predictive %zu bytes\n", bits, packed_size, delta_size,
+                   predictive_size);
+            return 0;
+        }
+
+        /* Noise and periodic keyframes. */
+        fill_trajectory(1e-3);
+        predictive.keyframe_interval = 100;
+        if (!round_trip_stream(&predictive, &predictive_size, "noisy keyframed")) {
+            return 0;
+        }
+    }
+
+    /* Unrelated samples: most residuals are out of range and become keyframes. */
+    fill_random();
+    const QuaternionStreamConfig config = {12, QUATERNION_CODEC_PREDICTIVE, 0};
+    size_t size;
+    if (!round_trip_stream(&config, &size, "random") || size > (COUNT * (4 + 2 + 3 * 12) + 7) / 8) {
+        printf("FAIL: random samples cost more than keyframes (%zu bytes)\n", size);
+        return 0;
+    }
+    return 1;
+}
+
+static double g_reference[COUNT][4];
+
+/* Bit offset of record @p index in a stream: a 4-bit tag, then 3 * tag payload bits or, for tag
+ * 15, a packed keyframe record. */
+static size_t record_offset(size_t index, unsigned bits, unsigned *tag) {
+    size_t bit = 0;
+    for (size_t i = 0;; ++i) {
+        *tag = (g_stream[bit / 8] | (unsigned)g_stream[bit / 8 + 1] << 8) >> (bit % 8) & 15u;
+        if (i == index) {
+            return bit;
+        }
+        bit += 4 + (*tag == 15u ? 2 + 3 * bits : 3 * *tag);
+    }
+}
+
+/* A flipped residual bit spoils the samples up to the next keyframe and none after it. */
+static int check_bit_flips(QuaternionCodecMode mode, const char *what) {
+    const QuaternionStreamConfig config = {16, mode, 100};
+    size_t size;
+    if (!quaternion_stream_encode(&g_input[0][0], COUNT, &config, g_stream, sizeof(g_stream), &size) ||
+        !quaternion_stream_decode(g_stream, size, COUNT, &config, &g_reference[0][0])) {
+        printf("FAIL: %s keyframed stream\n", what);
+        return 0;
+    }
+    for (size_t i = 1; i < 100; ++i) {
+        unsigned tag;
+        const size_t bit = record_offset(i, 16, &tag) + 4;
+        if (tag == 0 || tag == 15u) {
+            continue;
+        }
+        g_stream[bit / 8] ^= (unsigned char)(1u << (bit % 8));
+        const int decoded = quaternion_stream_decode(g_stream, size, COUNT, &config, &g_output[0][0]);
+        g_stream[bit / 8] ^= (unsigned char)(1u << (bit % 8));
+        if (!decoded || memcmp(g_output[i], g_reference[i], sizeof(g_output[i])) == 0 ||
+            memcmp(g_output[100], g_reference[100], sizeof(g_output[0]) * (COUNT - 100)) != 0) {
+            printf("FAIL: %s stream does not recover from a flip in sample %zu\n", what, i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_stream_errors(void) {
+    fill_trajectory(0.0);
+    if (!check_bit_flips(QUATERNION_CODEC_DELTA, "delta") ||
+        !check_bit_flips(QUATERNION_CODEC_PREDICTIVE, "predictive")) {
+        return 0;
+    }
+
+    const QuaternionStreamConfig config = {16, QUATERNION_CODEC_PREDICTIVE, 0};
+    size_t size;
+
+    /* A rejected sample repeats the prediction; the samples around it are unaffected. */
+    const double saved = g_input[500][1];
+    g_input[500][1] = NAN;
+    if (quaternion_stream_encode(&g_input[0][0], COUNT, &config, g_stream, sizeof(g_stream), &size) || size == 0 ||
+        !quaternion_stream_decode(g_stream, size, COUNT, &config, &g_output[0][0])) {
+        printf("FAIL: stream with a NaN sample\n");
+        return 0;
+    }
+    g_input[500][1] = saved;
+    for (size_t i = 0; i < COUNT; ++i) {
+        const double err = angle_between(g_input[i], g_output[i]);
+        if (i != 500 && !(err <= quaternion_codec_max_error(16))) {
+            printf("FAIL: sample %zu after a rejected sample off by %.3e\n", i, err);
+            return 0;
+        }
+    }
+
+    /* Truncated streams, a missing leading keyframe and bad configurations are reported. */
+    const QuaternionStreamConfig bad_bits = {QUATERNION_CODEC_MAX_BITS + 1, QUATERNION_CODEC_DELTA, 0};
+    const QuaternionStreamConfig bad_mode = {16, (QuaternionCodecMode)7, 0};
+    g_stream[0] ^= 0x0f;
+    const int unkeyed = quaternion_stream_decode(g_stream, size, COUNT, &config, &g_output[0][0]);
+    g_stream[0] ^= 0x0f;
+    size_t untouched = 123;
+    if (quaternion_stream_decode(g_stream, size / 2, COUNT, &config, &g_output[0][0]) || unkeyed ||
+        quaternion_stream_decode(g_stream, size, COUNT, &bad_bits, &g_output[0][0]) ||
+        quaternion_stream_decode(g_stream, size, COUNT, &bad_mode, &g_output[0][0]) ||
+        quaternion_stream_decode(NULL, size, COUNT, &config, &g_output[0][0]) ||
+        !quaternion_stream_decode(NULL, 0, 0, &config, NULL) ||
+        quaternion_stream_encode(&g_input[0][0], COUNT, &config, g_stream,
+                                 QUATERNION_STREAM_MAX_BYTES(COUNT, 16) - 1, &untouched) ||
+        untouched != 0 || quaternion_stream_encode(&g_input[0][0], COUNT, NULL, g_stream, sizeof(g_stream), &size) ||
+        quaternion_stream_encode(&g_input[0][0], COUNT, &config, g_stream, sizeof(g_stream), NULL) ||
+        !quaternion_stream_encode(NULL, 0, &config, NULL, 0, &size) || size != 0) {
+        printf("FAIL: stream argument and corruption checks\n");
+        return 0;
+    }
+
+    /* Packing rejects what it cannot represent the same way. */
+    const double zero[4] = {0.0, 0.0, 0.0, 0.0};
+    double out[4];
+    if (quaternion_pack(zero, 1, 8, g_packed) || !quaternion_unpack(g_packed, 1, 8, out) || out[0] != 1.0 ||
+        quaternion_pack(&g_input[0][0], 1, QUATERNION_CODEC_MIN_BITS - 1, g_packed) ||
+        quaternion_unpack(g_packed, 1, QUATERNION_CODEC_MAX_BITS + 1, out) || !quaternion_pack(NULL, 0, 8, NULL) ||
+        quaternion_codec_max_error(3) != 0.0) {
+        printf("FAIL: pack argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_pack() || !check_layout() || !check_streams() || !check_stream_errors()) {
+        return 1;
+    }
+    printf("PASS: quaternion codec\n");
+    return 0;
+}
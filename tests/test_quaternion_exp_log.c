@@ -0,0 +1,213 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+
+#define BATCH_COUNT 64
+
+static double g_rotvecs[BATCH_COUNT][3];
+static double g_quaternions[BATCH_COUNT][4];
+static double g_logs[BATCH_COUNT][3];
+static double g_dcms[BATCH_COUNT][3][3];
+
+static void reference_exp(const double rotvec[3], double q[4]) {
+    const double angle = sqrt(rotvec[0] * rotvec[0] + rotvec[1] * rotvec[1] + rotvec[2] * rotvec[2]);
+    if (angle == 0.0) {
+        q[0] = 1.0;
+        q[1] = q[2] = q[3] = 0.0;
+        return;
+    }
+    const double s = sin(0.5 * angle) / angle;
+    q[0] = cos(0.5 * angle);
+    q[1] = s * rotvec[0];
+    q[2] = s * rotvec[1];
+    q[3] = s * rotvec[2];
+}
+
+static double max_relative_error(const double *a, const double *b, int n) {
+    double scale = 0.0;
+    double error = 0.0;
+    for (int i = 0; i < n; ++i) {
+        scale = fmax(scale, fabs(b[i]));
+        error = fmax(error, fabs(a[i] - b[i]));
+    }
+    return scale > 0.0 ? error / scale : error;
+}
+
+static int check_round_trip(void) {
+    const double axis[3] = {0.48, 0.6, -0.64};
+
+    /* Magnitudes spanning the series/closed-form switch of both maps, down to subnormal-ish angles. */
+    const double angles[] = {0.0, 1e-300, 1e-12, 1e-8, 1e-4, 0.02, 0.0199, 0.15, 0.155, 0.16, 1.0, 2.5, 3.1};
+    for (unsigned int i = 0; i < sizeof(angles) / sizeof(angles[0]); ++i) {
+        const double rotvec[3] = {axis[0] * angles[i], axis[1] * angles[i], axis[2] * angles[i]};
+        double expected[4];
+        double q[4];
+        double back[3];
+
+        reference_exp(rotvec, expected);
+        quaternion_exp(rotvec, q);
+        if (max_relative_error(q, expected, 4) > 4e-16) {
+            printf("FAIL: quaternion_exp angle %g off by %.3e\n", angles[i], max_relative_error(q, expected, 4));
+            return 0;
+        }
+        if (!quaternion_log(q, back) || (angles[i] > 0.0 && max_relative_error(back, rotvec, 3) > 1e-15) ||
+            (angles[i] == 0.0 && (back[0] != 0.0 || back[1] != 0.0 || back[2] != 0.0))) {
+            printf("FAIL: quaternion_log(quaternion_exp) angle %g off by %.3e\n", angles[i],
+                   max_relative_error(back, rotvec, 3));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_log_properties(void) {
+    /* Non-unit input, the sign ambiguity, and the half-turn must all give the shortest vector. */
+    const double q[4] = {0.8, 0.36, -0.48, 0.0};
+    const double scaled[4] = {-2.4, -1.08, 1.44, 0.0};
+    const double half_turn[4] = {0.0, 0.0, 0.0, -3.0};
+    double a[3];
+    double b[3];
+    double c[3];
+
+    if (!quaternion_log(q, a) || !quaternion_log(scaled, b) || !quaternion_log(half_turn, c)) {
+        printf("FAIL: quaternion_log rejected a valid quaternion\n");
+        return 0;
+    }
+    if (max_relative_error(a, b, 3) > 1e-15 || fabs(fabs(c[2]) - 3.14159265358979323846) > 1e-15 ||
+        c[0] != 0.0 || c[1] != 0.0) {
+        printf("FAIL: quaternion_log is not sign/scale invariant or misses the half-turn\n");
+        return 0;
+    }
+
+    /* Tiny rotations keep full relative precision, unlike the acos formulation. */
+    const double tiny[4] = {1.0, 5e-10, 0.0, 0.0};
+    double axis[3];
+    double angle;
+    if (!quaternion_log(tiny, a) || fabs(a[0] - 1e-9) > 1e-24 ||
+        !quaternion_to_axis_angle(tiny, axis, &angle) || fabs(angle - 1e-9) > 1e-24) {
+        printf("FAIL: small-angle logarithm lost precision (%.17g, %.17g)\n", a[0], angle);
+        return 0;
+    }
+
+    const double zero[4] = {0.0, 0.0, 0.0, 0.0};
+    const double bad[4] = {NAN, 0.0, 0.0, 0.0};
+    if (quaternion_log(zero, a) || !isnan(a[0]) || quaternion_log(bad, a) || !isnan(a[2])) {
+        printf("FAIL: quaternion_log accepted an invalid quaternion\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_rotvec_to_dcm(void) {
+    const double angles[] = {0.0, 1e-9, 0.1, 0.155, 0.16, 1.7, 3.1};
+    for (unsigned int i = 0; i < sizeof(angles) / sizeof(angles[0]); ++i) {
+        const double rotvec[3] = {-0.36 * angles[i], 0.8 * angles[i], 0.48 * angles[i]};
+        double q[4];
+        double expected[3][3];
+        double dcm[3][3];
+
+        quaternion_exp(rotvec, q);
+        quaternion_to_dcm(q, expected);
+        rotvec_to_dcm(rotvec, dcm);
+        if (max_relative_error(&dcm[0][0], &expected[0][0], 9) > 1e-15) {
+            printf("FAIL: rotvec_to_dcm angle %g off by %.3e\n", angles[i],
+                   max_relative_error(&dcm[0][0], &expected[0][0], 9));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_batch(void) {
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        const double angle = 3.0 * i / BATCH_COUNT;
+        g_rotvecs[i][0] = angle * cos(0.7 * i);
+        g_rotvecs[i][1] = angle * sin(0.7 * i) * 0.6;
+        g_rotvecs[i][2] = angle * sin(0.7 * i) * -0.8;
+    }
+    if (!quaternion_exp_batch(&g_rotvecs[0][0], BATCH_COUNT, &g_quaternions[0][0]) ||
+        !quaternion_log_batch(&g_quaternions[0][0], BATCH_COUNT, &g_logs[0][0]) ||
+        !rotvec_to_dcm_batch(&g_rotvecs[0][0], BATCH_COUNT, g_dcms)) {
+        printf("FAIL: batch exp/log rejected valid input\n");
+        return 0;
+    }
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        double q[4];
+        double rotvec[3];
+        double dcm[3][3];
+        quaternion_exp(g_rotvecs[i], q);
+        quaternion_log(q, rotvec);
+        rotvec_to_dcm(g_rotvecs[i], dcm);
+        if (memcmp(q, g_quaternions[i], sizeof(q)) != 0 || memcmp(rotvec, g_logs[i], sizeof(rotvec)) != 0 ||
+            memcmp(dcm, g_dcms[i], sizeof(dcm)) != 0) {
+            printf("FAIL: batch exp/log differs from the single-element call at %d\n", i);
+            return 0;
+        }
+    }
+
+    /* One bad element is reported but does not stop the rest of the batch. */
+    g_quaternions[3][0] = g_quaternions[3][1] = g_quaternions[3][2] = g_quaternions[3][3] = 0.0;
+    if (quaternion_log_batch(&g_quaternions[0][0], BATCH_COUNT, &g_logs[0][0]) || !isnan(g_logs[3][0]) ||
+        isnan(g_logs[4][0])) {
+        printf("FAIL: quaternion_log_batch invalid-element handling\n");
+        return 0;
+    }
+    if (quaternion_exp_batch(NULL, 1, &g_quaternions[0][0]) || rotvec_to_dcm_batch(&g_rotvecs[0][0], 1, NULL) ||
+        !quaternion_log_batch(NULL, 0, NULL)) {
+        printf("FAIL: batch exp/log argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const float rotvecs[][3] = {{0.0f, 0.0f, 0.0f}, {1e-6f, -2e-6f, 0.0f}, {0.05f, 0.1f, -0.2f}, {1.0f, -2.0f, 0.5f}};
+    for (unsigned int i = 0; i < sizeof(rotvecs) / sizeof(rotvecs[0]); ++i) {
+        const double rotvec_d[3] = {rotvecs[i][0], rotvecs[i][1], rotvecs[i][2]};
+        double expected[4];
+        float q[4];
+        float back[3];
+        float dcm[3][3];
+        double dcm_d[3][3];
+
+        quaternion_exp(rotvec_d, expected);
+        quaternionf_exp(rotvecs[i], q);
+        rotvecf_to_dcm(rotvecs[i], dcm);
+        rotvec_to_dcm(rotvec_d, dcm_d);
+        if (!quaternionf_log(q, back)) {
+            printf("FAIL: quaternionf_log rejected a valid quaternion\n");
+            return 0;
+        }
+        for (int c = 0; c < 4; ++c) {
+            if (fabs(q[c] - expected[c]) > 2e-7) {
+                printf("FAIL: quaternionf_exp case %u component %d\n", i, c);
+                return 0;
+            }
+        }
+        for (int c = 0; c < 3; ++c) {
+            if (fabs(back[c] - rotvecs[i][c]) > 4e-7 * (1.0 + fabs(rotvecs[i][c]))) {
+                printf("FAIL: quaternionf_log case %u component %d\n", i, c);
+                return 0;
+            }
+            for (int r = 0; r < 3; ++r) {
+                if (fabs(dcm[r][c] - dcm_d[r][c]) > 4e-7) {
+                    printf("FAIL: rotvecf_to_dcm case %u element %d,%d\n", i, r, c);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_round_trip() || !check_log_properties() || !check_rotvec_to_dcm() || !check_batch() ||
+        !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: quaternion exp/log maps and rotation-vector DCM\n");
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+
+#define POINT_COUNT 64
+
+static void make_axis_angle_quaternion(const double axis[3], double angle, double q[4]) {
+    const double norm = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    const double s = sin(0.5 * angle) / norm;
+    q[0] = cos(0.5 * angle);
+    q[1] = axis[0] * s;
+    q[2] = axis[1] * s;
+    q[3] = axis[2] * s;
+}
+
+static int test_packed_matches_single(const double q[4]) {
+    double points[POINT_COUNT * 3];
+    double rotated[POINT_COUNT * 3];
+
+    for (int index = 0; index < POINT_COUNT * 3; ++index) {
+        points[index] = sin(0.37 * index) * (1.0 + index);
+    }
+
+    if (!quaternion_rotate_vectors(q, points, rotated, POINT_COUNT, 3)) {
+        printf("FAIL: packed batch rotation rejected valid input\n");
+        return 0;
+    }
+
+    for (int index = 0; index < POINT_COUNT; ++index) {
+        double expected[3];
+        quaternion_rotate_vector(q, &points[index * 3], expected);
+        if (memcmp(expected, &rotated[index * 3], sizeof(expected)) != 0) {
+            printf("FAIL: batch vector %d differs from quaternion_rotate_vector\n", index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_strided_in_place(const double q[4]) {
+    /* x, y, z, intensity: the fourth channel must be left untouched. */
+    double cloud[POINT_COUNT * 4];
+    double original[POINT_COUNT * 4];
+
+    for (int index = 0; index < POINT_COUNT; ++index) {
+        cloud[index * 4 + 0] = cos(0.11 * index);
+        cloud[index * 4 + 1] = sin(0.23 * index);
+        cloud[index * 4 + 2] = 0.5 * index;
+        cloud[index * 4 + 3] = 1000.0 + index;
+    }
+    memcpy(original, cloud, sizeof(cloud));
+
+    if (!quaternion_rotate_vectors(q, cloud, cloud, POINT_COUNT, 4)) {
+        printf("FAIL: in-place strided rotation rejected valid input\n");
+        return 0;
+    }
+
+    for (int index = 0; index < POINT_COUNT; ++index) {
+        double expected[3];
+        quaternion_rotate_vector(q, &original[index * 4], expected);
+        if (memcmp(expected, &cloud[index * 4], sizeof(expected)) != 0) {
+            printf("FAIL: in-place vector %d differs from quaternion_rotate_vector\n", index);
+            return 0;
+        }
+        if (cloud[index * 4 + 3] != original[index * 4 + 3]) {
+            printf("FAIL: stride padding of vector %d was modified\n", index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_rejections(const double q[4]) {
+    double v[3] = {1.0, 2.0, 3.0};
+
+    if (quaternion_rotate_vectors(q, v, v, 1, 2) ||
+        quaternion_rotate_vectors(NULL, v, v, 1, 3) ||
+        quaternion_rotate_vectors(q, NULL, v, 1, 3)) {
+        printf("FAIL: invalid batch arguments were accepted\n");
+        return 0;
+    }
+    if (!quaternion_rotate_vectors(q, NULL, NULL, 0, 3)) {
+        printf("FAIL: empty batch was rejected\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    const double axis[3] = {0.3, -0.5, 0.8};
+    double q[4];
+
+    make_axis_angle_quaternion(axis, 1.1, q);
+
+    if (!test_packed_matches_single(q) ||
+        !test_strided_in_place(q) ||
+        !test_rejections(q)) {
+        return 1;
+    }
+
+    printf("PASS: quaternion_rotate_vectors batch tests\n");
+    return 0;
+}
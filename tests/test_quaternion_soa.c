@@ -0,0 +1,236 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/dcm.h"
+#include "attitude/quaternion.h"
+#include "attitude/quaternion_soa.h"
+
+/* Deliberately not a multiple of any lane width so every backend exercises its scalar tail. */
+#define ELEMENT_COUNT 37
+
+static double g_storage_a[QUATERNION_SOA_STORAGE_DOUBLES(ELEMENT_COUNT)];
+static double g_storage_b[QUATERNION_SOA_STORAGE_DOUBLES(ELEMENT_COUNT)];
+static double g_storage_out[QUATERNION_SOA_STORAGE_DOUBLES(ELEMENT_COUNT)];
+
+static double g_a[ELEMENT_COUNT][4];
+static double g_b[ELEMENT_COUNT][4];
+
+static void build_inputs(void) {
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        for (int component = 0; component < 4; ++component) {
+            g_a[index][component] = sin(0.7 * index + 1.3 * component + 0.1);
+            g_b[index][component] = cos(0.3 * index - 0.9 * component) * 1.5;
+        }
+    }
+
+    /* Edge cases for the masked paths: already-unit, tiny, zero, and negative zero. */
+    g_a[3][0] = 1.0;
+    g_a[3][1] = g_a[3][2] = g_a[3][3] = 0.0;
+    g_a[5][0] = 1e-9;
+    g_a[5][1] = g_a[5][2] = g_a[5][3] = 0.0;
+    g_a[8][0] = g_a[8][1] = g_a[8][2] = g_a[8][3] = 0.0;
+    g_a[13][1] = -0.0;
+}
+
+static int same_bits(const double *a, const double *b, size_t count) {
+    return memcmp(a, b, count * sizeof(double)) == 0;
+}
+
+static int check_backend(QuaternionSoaBackend backend) {
+    QuaternionSoA a;
+    QuaternionSoA b;
+    QuaternionSoA out;
+    const char *name = quaternion_soa_backend_name(backend);
+
+    if (!quaternion_soa_init(&a, g_storage_a, sizeof(g_storage_a) / sizeof(double), ELEMENT_COUNT) ||
+        !quaternion_soa_init(&b, g_storage_b, sizeof(g_storage_b) / sizeof(double), ELEMENT_COUNT) ||
+        !quaternion_soa_init(&out, g_storage_out, sizeof(g_storage_out) / sizeof(double), ELEMENT_COUNT) ||
+        !quaternion_soa_from_aos(&a, &g_a[0][0]) ||
+        !quaternion_soa_from_aos(&b, &g_b[0][0])) {
+        printf("FAIL[%s]: could not prepare batches\n", name);
+        return 0;
+    }
+
+    /* Multiply */
+    quaternion_soa_multiply(&a, &b, &out);
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double expected[4];
+        double actual[4] = {out.w[index], out.x[index], out.y[index], out.z[index]};
+        quaternion_multiply(g_a[index], g_b[index], expected);
+        if (!same_bits(expected, actual, 4)) {
+            printf("FAIL[%s]: multiply element %d is not bit-identical\n", name, index);
+            return 0;
+        }
+    }
+
+    /* Inverse: the zero element must fail and leave its sentinel output untouched. */
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        out.w[index] = out.x[index] = out.y[index] = out.z[index] = 42.0;
+    }
+    if (quaternion_soa_inverse(&a, &out)) {
+        printf("FAIL[%s]: inverse reported success for a zero quaternion\n", name);
+        return 0;
+    }
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double expected[4] = {42.0, 42.0, 42.0, 42.0};
+        double actual[4] = {out.w[index], out.x[index], out.y[index], out.z[index]};
+        quaternion_inverse(g_a[index], expected);
+        if (!same_bits(expected, actual, 4)) {
+            printf("FAIL[%s]: inverse element %d is not bit-identical\n", name, index);
+            return 0;
+        }
+    }
+
+    /* Rotate, in place on the vector lanes. */
+    double vx[ELEMENT_COUNT];
+    double vy[ELEMENT_COUNT];
+    double vz[ELEMENT_COUNT];
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        vx[index] = g_b[index][1];
+        vy[index] = g_b[index][2];
+        vz[index] = g_b[index][3];
+    }
+    double *const lanes[3] = {vx, vy, vz};
+    quaternion_soa_rotate(&a, (const double *const *)lanes, lanes);
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double expected[3];
+        double actual[3] = {vx[index], vy[index], vz[index]};
+        quaternion_rotate_vector(g_a[index], &g_b[index][1], expected);
+        if (!same_bits(expected, actual, 3)) {
+            printf("FAIL[%s]: rotate element %d is not bit-identical\n", name, index);
+            return 0;
+        }
+    }
+
+    /* To DCM */
+    double dcm_storage[9][ELEMENT_COUNT];
+    double *const dcm_lanes[9] = {
+        dcm_storage[0], dcm_storage[1], dcm_storage[2],
+        dcm_storage[3], dcm_storage[4], dcm_storage[5],
+        dcm_storage[6], dcm_storage[7], dcm_storage[8]
+    };
+    quaternion_soa_to_dcm(&a, dcm_lanes);
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double expected[3][3];
+        quaternion_to_dcm(g_a[index], expected);
+        for (int lane = 0; lane < 9; ++lane) {
+            if (!same_bits(&expected[lane / 3][lane % 3], &dcm_storage[lane][index], 1)) {
+                printf("FAIL[%s]: to_dcm element %d lane %d is not bit-identical\n", name, index, lane);
+                return 0;
+            }
+        }
+    }
+
+    /*
+     * From DCM, on the matrices above plus ones that take each of the scalar branches at its
+     * boundary: half-turns about the axes and a diagonal, a zero trace, and tied diagonals.
+     */
+    const double special[][3][3] = {
+        {{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}},
+        {{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}},
+        {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}},
+        {{0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}},
+        {{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}},
+        {{-1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0}, {2.0 / 3.0, -1.0 / 3.0, 2.0 / 3.0}, {2.0 / 3.0, 2.0 / 3.0, -1.0 / 3.0}}
+    };
+    for (size_t s = 0; s < sizeof(special) / sizeof(special[0]); ++s) {
+        for (int lane = 0; lane < 9; ++lane) {
+            dcm_storage[lane][20 + s] = special[s][lane / 3][lane % 3];
+        }
+    }
+    quaternion_soa_from_dcm((const double *const *)dcm_lanes, &out);
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double matrix[3][3];
+        double expected[4];
+        double actual[4] = {out.w[index], out.x[index], out.y[index], out.z[index]};
+        for (int lane = 0; lane < 9; ++lane) {
+            matrix[lane / 3][lane % 3] = dcm_storage[lane][index];
+        }
+        dcm_to_quaternion_unchecked((const double (*)[3])matrix, expected);
+        if (!same_bits(expected, actual, 4)) {
+            printf("FAIL[%s]: from_dcm element %d is not bit-identical\n", name, index);
+            return 0;
+        }
+    }
+
+    /* Normalize last because it mutates the input batch. */
+    quaternion_soa_normalize(&a);
+    for (int index = 0; index < ELEMENT_COUNT; ++index) {
+        double expected[4];
+        double actual[4] = {a.w[index], a.x[index], a.y[index], a.z[index]};
+        memcpy(expected, g_a[index], sizeof(expected));
+        quaternion_normalize(expected);
+        if (!same_bits(expected, actual, 4)) {
+            printf("FAIL[%s]: normalize element %d is not bit-identical\n", name, index);
+            return 0;
+        }
+    }
+
+    printf("  backend %-7s bit-identical to the scalar API\n", name);
+    return 1;
+}
+
+static int check_init_contract(void) {
+    double small[8];
+    double storage[QUATERNION_SOA_STORAGE_DOUBLES(4) + 1];
+    QuaternionSoA soa;
+
+    if (quaternion_soa_init(&soa, small, 8, 5)) {
+        printf("FAIL: quaternion_soa_init accepted undersized storage\n");
+        return 0;
+    }
+    /* Start one double into the buffer to force the alignment shift. */
+    if (!quaternion_soa_init(&soa, storage + 1, sizeof(storage) / sizeof(double) - 1, 4)) {
+        printf("FAIL: quaternion_soa_init rejected sufficient storage\n");
+        return 0;
+    }
+    if (((size_t)soa.w % QUATERNION_SOA_ALIGNMENT) != 0 ||
+        ((size_t)soa.x % QUATERNION_SOA_ALIGNMENT) != 0 ||
+        ((size_t)soa.y % QUATERNION_SOA_ALIGNMENT) != 0 ||
+        ((size_t)soa.z % QUATERNION_SOA_ALIGNMENT) != 0) {
+        printf("FAIL: quaternion_soa_init produced unaligned lanes\n");
+        return 0;
+    }
+    if (soa.z + 4 > storage + sizeof(storage) / sizeof(double)) {
+        printf("FAIL: quaternion_soa_init lanes overrun the storage\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    const QuaternionSoaBackend backends[] = {
+        QUATERNION_SOA_BACKEND_SCALAR,
+        QUATERNION_SOA_BACKEND_SSE2,
+        QUATERNION_SOA_BACKEND_AVX2,
+        QUATERNION_SOA_BACKEND_AVX512,
+        QUATERNION_SOA_BACKEND_NEON
+    };
+
+    build_inputs();
+    if (!check_init_contract()) {
+        return 1;
+    }
+
+    if (!quaternion_soa_set_backend(QUATERNION_SOA_BACKEND_AUTO)) {
+        printf("FAIL: automatic backend selection failed\n");
+        return 1;
+    }
+    printf("Automatic backend: %s\n", quaternion_soa_backend_name(quaternion_soa_backend()));
+
+    for (size_t index = 0; index < sizeof(backends) / sizeof(backends[0]); ++index) {
+        if (!quaternion_soa_set_backend(backends[index])) {
+            printf("  backend %-7s not available on this build/CPU\n",
+                   quaternion_soa_backend_name(backends[index]));
+            continue;
+        }
+        if (!check_backend(backends[index])) {
+            return 1;
+        }
+    }
+
+    quaternion_soa_set_backend(QUATERNION_SOA_BACKEND_AUTO);
+    printf("PASS: quaternion SoA batch kernels\n");
+    return 0;
+}
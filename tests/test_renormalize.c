@@ -0,0 +1,176 @@
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/vector3.h"
+
+static unsigned int g_seed = 2024u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+static double norm_error(const double *v, int size) {
+    double norm_sq = 0.0;
+    for (int i = 0; i < size; ++i) {
+        norm_sq += v[i] * v[i];
+    }
+    return fabs(sqrt(norm_sq) - 1.0);
+}
+
+static int check_against_exact(void) {
+    /* Drift sizes on both sides of the series limit, down to pure rounding. */
+    const double drifts[] = {1e-15, 1e-9, 1e-7, 1e-6, 1.9e-6, 3e-6, 1e-4, 0.2, 5.0};
+    double worst_norm = 0.0;
+    double worst_difference = 0.0;
+
+    for (unsigned int d = 0; d < sizeof(drifts) / sizeof(drifts[0]); ++d) {
+        for (int n = 0; n < 2000; ++n) {
+            const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+            double q[4];
+            quaternion_exp(rotvec, q);
+            const double scale = 1.0 + drifts[d] * random_unit();
+            for (int i = 0; i < 4; ++i) {
+                q[i] *= scale;
+            }
+            double exact[4];
+            const double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (int i = 0; i < 4; ++i) {
+                exact[i] = q[i] / norm;
+            }
+            if (!quaternion_renormalize(q)) {
+                printf("FAIL: quaternion_renormalize rejected drift %g\n", drifts[d]);
+                return 0;
+            }
+            worst_norm = fmax(worst_norm, norm_error(q, 4));
+            for (int i = 0; i < 4; ++i) {
+                worst_difference = fmax(worst_difference, fabs(q[i] - exact[i]));
+            }
+
+            double v[3] = {random_unit(), random_unit(), random_unit()};
+            vector3_normalize(v);
+            for (int i = 0; i < 3; ++i) {
+                v[i] *= scale;
+            }
+            if (!vector3_renormalize(v)) {
+                printf("FAIL: vector3_renormalize rejected drift %g\n", drifts[d]);
+                return 0;
+            }
+            worst_norm = fmax(worst_norm, norm_error(v, 3));
+        }
+    }
+
+    if (worst_norm > 3.0 * DBL_EPSILON || worst_difference > 3.0 * DBL_EPSILON) {
+        printf("FAIL: renormalize norm error %.3g, difference from exact %.3g\n", worst_norm, worst_difference);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_no_accumulation(void) {
+    /* A million compositions: renormalising every step holds the norm at rounding level. */
+    const double rotvec[3] = {1e-3, -2e-3, 0.5e-3};
+    double dq[4];
+    double q[4] = {1.0, 0.0, 0.0, 0.0};
+    double worst = 0.0;
+    quaternion_exp(rotvec, dq);
+
+    for (int n = 0; n < 1000000; ++n) {
+        double next[4];
+        quaternion_multiply(q, dq, next);
+        quaternion_renormalize(next);
+        memcpy(q, next, sizeof(q));
+        worst = fmax(worst, norm_error(q, 4));
+    }
+    if (worst > 3.0 * DBL_EPSILON) {
+        printf("FAIL: renormalized integration drifted to %.3g\n", worst);
+        return 0;
+    }
+
+    /* quaternion_normalize no longer leaves norms within 1e-6 of one untouched. */
+    double near[4] = {0.5 * (1.0 + 5e-7), 0.5 * (1.0 + 5e-7), -0.5 * (1.0 + 5e-7), 0.5 * (1.0 + 5e-7)};
+    quaternion_normalize(near);
+    if (norm_error(near, 4) > 2.0 * DBL_EPSILON) {
+        printf("FAIL: quaternion_normalize skipped a near-unit quaternion\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    double zero[4] = {0.0, 0.0, 0.0, 0.0};
+    double with_nan[4] = {1.0, NAN, 0.0, 0.0};
+    double huge[3] = {1e300, 1e300, 0.0};
+    double zero_vector[3] = {0.0, 0.0, 0.0};
+
+    if (quaternion_renormalize(NULL) || quaternion_renormalize(zero) || quaternion_renormalize(with_nan) ||
+        vector3_renormalize(NULL) || vector3_renormalize(zero_vector) || vector3_renormalize(huge) ||
+        zero[0] != 0.0 || with_nan[0] != 1.0 || huge[0] != 1e300) {
+        printf("FAIL: renormalize rejections\n");
+        return 0;
+    }
+
+    /* A batch with one bad element still renormalises the rest and leaves the bad one alone. */
+    double batch[3][4] = {{2.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 1.0 + 1e-7, 0.0}};
+    if (quaternion_renormalize_batch(&batch[0][0], 3) || batch[0][0] != 1.0 || batch[1][0] != 0.0 ||
+        norm_error(batch[2], 4) > DBL_EPSILON || !quaternion_renormalize_batch(NULL, 0) ||
+        quaternion_renormalize_batch(NULL, 1)) {
+        printf("FAIL: quaternion_renormalize_batch\n");
+        return 0;
+    }
+    double vectors[2][3] = {{3.0, 4.0, 0.0}, {0.0, 1.0 - 1e-7, 0.0}};
+    if (!vector3_renormalize_batch(&vectors[0][0], 2) || fabs(vectors[0][0] - 0.6) > DBL_EPSILON ||
+        norm_error(vectors[1], 3) > DBL_EPSILON || vector3_renormalize_batch(NULL, 2)) {
+        printf("FAIL: vector3_renormalize_batch\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const float drifts[] = {1e-7f, 1e-4f, 1.5e-3f, 0.1f};
+    for (unsigned int d = 0; d < sizeof(drifts) / sizeof(drifts[0]); ++d) {
+        float q[2][4] = {{0.5f, -0.5f, 0.5f, 0.5f}, {0.0f, 0.6f, 0.0f, -0.8f}};
+        float v[3] = {0.0f, 0.6f, 0.8f};
+        for (int i = 0; i < 4; ++i) {
+            q[0][i] *= 1.0f + drifts[d];
+            q[1][i] *= 1.0f - drifts[d];
+        }
+        for (int i = 0; i < 3; ++i) {
+            v[i] *= 1.0f + drifts[d];
+        }
+        if (!quaternionf_renormalize_batch(&q[0][0], 2) || !vector3f_renormalize(v)) {
+            printf("FAIL: float renormalize rejected drift %g\n", (double)drifts[d]);
+            return 0;
+        }
+        const float errors[3] = {
+            fabsf(sqrtf(q[0][0] * q[0][0] + q[0][1] * q[0][1] + q[0][2] * q[0][2] + q[0][3] * q[0][3]) - 1.0f),
+            fabsf(sqrtf(q[1][0] * q[1][0] + q[1][1] * q[1][1] + q[1][2] * q[1][2] + q[1][3] * q[1][3]) - 1.0f),
+            fabsf(sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) - 1.0f)
+        };
+        for (int e = 0; e < 3; ++e) {
+            if (errors[e] > 3.0f * FLT_EPSILON) {
+                printf("FAIL: float renormalize drift %g error %g\n", (double)drifts[d], (double)errors[e]);
+                return 0;
+            }
+        }
+    }
+    float zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    if (quaternionf_renormalize(zero) || vector3f_renormalize_batch(NULL, 1)) {
+        printf("FAIL: float renormalize rejections\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_against_exact() || !check_no_accumulation() || !check_rejections() || !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: fast renormalization\n");
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/slerp.h"
+
+#define PI 3.14159265358979323846
+#define BATCH_COUNT 257
+
+static double g_q1[BATCH_COUNT][4];
+static double g_q2[BATCH_COUNT][4];
+static double g_t[BATCH_COUNT];
+static double g_out[BATCH_COUNT][4];
+
+/* Angle of the rotation taking a to b, insensitive to quaternion sign. */
+static double attitude_error(const double a[4], const double b[4]) {
+    const double conj[4] = {a[0], -a[1], -a[2], -a[3]};
+    double delta[4];
+    quaternion_multiply(conj, b, delta);
+    return 2.0 * atan2(sqrt(delta[1] * delta[1] + delta[2] * delta[2] + delta[3] * delta[3]), fabs(delta[0]));
+}
+
+typedef void (*SlerpFn)(const double q1[4], const double q2[4], double t, double q_out[4]);
+typedef int (*SlerpBatchFn)(const double *q1, const double *q2, const double *t, size_t count, double *q_out);
+
+/* quaternion_slerp() interpolates linearly for nearby endpoints, which is this far off SLERP. */
+#define NLERP_ERROR 1.2e-6
+
+/*
+ * Worst angular and norm error of a fast SLERP over a dense grid of t for endpoints up to
+ * max_rotation apart, against the exact SlerpSegment evaluation and against quaternion_slerp().
+ */
+static int check_error_bound(SlerpFn slerp, const char *name, double max_rotation, double angle_bound, double norm_bound) {
+    const double start[4] = {0.5, -0.5, 0.5, 0.5};
+    const double axis[3] = {0.36, 0.48, 0.8};
+    double worst_angle = 0.0;
+    double worst_slerp = 0.0;
+    double worst_norm = 0.0;
+
+    for (int a = 0; a <= 200; ++a) {
+        const double rotation = max_rotation * a / 200.0;
+        const double rotvec[3] = {rotation * axis[0], rotation * axis[1], rotation * axis[2]};
+        double step[4];
+        double end[4];
+        SlerpSegment segment;
+
+        quaternion_exp(rotvec, step);
+        quaternion_multiply(start, step, end);
+        if (a % 2 == 1) {
+            /* Same rotation, other hemisphere: the fast path must flip it too. */
+            end[0] = -end[0], end[1] = -end[1], end[2] = -end[2], end[3] = -end[3];
+        }
+        slerp_segment_init(&segment, start, end);
+        for (int i = 0; i <= 200; ++i) {
+            const double t = i / 200.0;
+            double exact[4];
+            double reference[4];
+            double fast[4];
+            slerp_segment_eval(&segment, t, exact);
+            quaternion_slerp(start, end, t, reference);
+            slerp(start, end, t, fast);
+            worst_angle = fmax(worst_angle, attitude_error(exact, fast));
+            worst_slerp = fmax(worst_slerp, attitude_error(reference, fast));
+            worst_norm = fmax(worst_norm, fabs(sqrt(fast[0] * fast[0] + fast[1] * fast[1] + fast[2] * fast[2] +
+                                                    fast[3] * fast[3]) - 1.0));
+        }
+    }
+    if (worst_angle > angle_bound || worst_slerp > fmax(angle_bound, NLERP_ERROR) || worst_norm > norm_bound) {
+        printf("FAIL: %s up to %.0f deg: angle error %.3e (bound %.1e), %.3e against quaternion_slerp, "
+               "norm error %.3e\n", name, max_rotation * 180.0 / PI, worst_angle, angle_bound, worst_slerp, worst_norm);
+        return 0;
+    }
+    return 1;
+}
+
+static int check_batch(SlerpFn slerp, SlerpBatchFn slerp_batch) {
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        const double a[3] = {0.7 * sin(0.3 * i), 0.5 * cos(0.2 * i), 1.1 * sin(0.05 * i)};
+        const double b[3] = {-a[1], 2.0 * a[0], 0.3};
+        quaternion_exp(a, g_q1[i]);
+        quaternion_exp(b, g_q2[i]);
+        g_t[i] = (double)i / (BATCH_COUNT - 1);
+    }
+    if (!slerp_batch(&g_q1[0][0], &g_q2[0][0], g_t, BATCH_COUNT, &g_out[0][0])) {
+        printf("FAIL: fast SLERP batch rejected valid input\n");
+        return 0;
+    }
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        double q[4];
+        slerp(g_q1[i], g_q2[i], g_t[i], q);
+        if (memcmp(q, g_out[i], sizeof(q)) != 0) {
+            printf("FAIL: fast SLERP batch differs from the scalar call at %d\n", i);
+            return 0;
+        }
+    }
+    if (slerp_batch(&g_q1[0][0], NULL, g_t, 1, &g_out[0][0]) || !slerp_batch(NULL, NULL, NULL, 0, NULL)) {
+        printf("FAIL: fast SLERP batch argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        float q1[4];
+        float q2[4];
+        float q[4];
+        float coarse[4];
+        double exact[4];
+        double exact_coarse[4];
+        for (int c = 0; c < 4; ++c) {
+            q1[c] = (float)g_q1[i][c];
+            q2[c] = (float)g_q2[i][c];
+        }
+        slerpf_fast(q1, q2, (float)g_t[i], q);
+        slerpf_fast_coarse(q1, q2, (float)g_t[i], coarse);
+        slerp_fast(g_q1[i], g_q2[i], g_t[i], exact);
+        slerp_fast_coarse(g_q1[i], g_q2[i], g_t[i], exact_coarse);
+        for (int c = 0; c < 4; ++c) {
+            if (fabs(q[c] - exact[c]) > 1e-6 || fabs(coarse[c] - exact_coarse[c]) > 1e-6) {
+                printf("FAIL: slerpf_fast element %d component %d\n", i, c);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    /* The bounds documented in slerp.h. */
+    if (!check_error_bound(slerp_fast, "slerp_fast", PI / 4.0, 1e-12, 2e-9) ||
+        !check_error_bound(slerp_fast, "slerp_fast", PI / 2.0, 1e-8, 2e-9) ||
+        !check_error_bound(slerp_fast, "slerp_fast", PI, 2e-5, 2e-9) ||
+        !check_error_bound(slerp_fast_coarse, "slerp_fast_coarse", PI / 4.0, 1e-10, 5e-8) ||
+        !check_error_bound(slerp_fast_coarse, "slerp_fast_coarse", PI / 2.0, 4e-7, 5e-8) ||
+        !check_error_bound(slerp_fast_coarse, "slerp_fast_coarse", PI, 8e-5, 5e-8) ||
+        !check_batch(slerp_fast, slerp_fast_batch) || !check_batch(slerp_fast_coarse, slerp_fast_coarse_batch) ||
+        !check_float()) {
+        return 1;
+    }
+
+    printf("PASS: trig-free approximate SLERP\n");
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/slerp.h"
+
+#define SAMPLE_COUNT 1000
+#define KEY_COUNT 12
+#define UPSAMPLE_FACTOR 20
+#define OUTPUT_COUNT ((KEY_COUNT - 1) * UPSAMPLE_FACTOR + 1)
+
+static double g_samples[SAMPLE_COUNT][4];
+static double g_t[SAMPLE_COUNT];
+static double g_keys[KEY_COUNT][4];
+static double g_output[OUTPUT_COUNT][4];
+static float g_keysf[KEY_COUNT][4];
+static float g_outputf[OUTPUT_COUNT][4];
+
+static double max_difference(const double a[4], const double b[4]) {
+    double error = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        error = fmax(error, fabs(a[i] - b[i]));
+    }
+    return error;
+}
+
+static double norm_error(const double q[4]) {
+    return fabs(sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]) - 1.0);
+}
+
+static int check_matches_quaternion_slerp(void) {
+    /* Pairs far enough apart that quaternion_slerp takes its exact branch, including dot < 0. */
+    const double pairs[][2][4] = {
+        {{1.0, 0.0, 0.0, 0.0}, {0.7071067811865476, 0.7071067811865476, 0.0, 0.0}},
+        {{0.5, 0.5, -0.5, 0.5}, {-0.1, 0.7, 0.7, 0.1}},
+        {{0.9, 0.1, 0.3, -0.3}, {-0.8, 0.2, 0.2, 0.52}},
+        {{1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 1.0}}
+    };
+    const double t_values[] = {0.0, 0.1, 0.25, 0.5, 0.77, 1.0};
+
+    for (unsigned int p = 0; p < sizeof(pairs) / sizeof(pairs[0]); ++p) {
+        double q1[4];
+        double q2[4];
+        SlerpSegment segment;
+        memcpy(q1, pairs[p][0], sizeof(q1));
+        memcpy(q2, pairs[p][1], sizeof(q2));
+        quaternion_normalize(q1);
+        quaternion_normalize(q2);
+
+        /* The segment normalises its endpoints itself. */
+        const double scaled[4] = {3.0 * pairs[p][0][0], 3.0 * pairs[p][0][1], 3.0 * pairs[p][0][2], 3.0 * pairs[p][0][3]};
+        if (!slerp_segment_init(&segment, scaled, pairs[p][1])) {
+            printf("FAIL: slerp_segment_init rejected pair %u\n", p);
+            return 0;
+        }
+        for (unsigned int i = 0; i < sizeof(t_values) / sizeof(t_values[0]); ++i) {
+            double expected[4];
+            double q[4];
+            quaternion_slerp(q1, q2, t_values[i], expected);
+            slerp_segment_eval(&segment, t_values[i], q);
+            if (max_difference(q, expected) > 1e-15 || norm_error(q) > 4e-16) {
+                printf("FAIL: pair %u t=%g differs from quaternion_slerp by %.3e\n", p, t_values[i],
+                       max_difference(q, expected));
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_small_angle(void) {
+    /* Endpoints 2e-9 rad apart: acos(dot) would round the angle to zero or a multiple of 1e-8. */
+    const double start[4] = {0.6, 0.0, 0.8, 0.0};
+    const double rotvec[3] = {0.0, 0.0, 2e-9};
+    const double half_rotvec[3] = {0.0, 0.0, 1e-9};
+    double step[4];
+    double half_step[4];
+    double end[4];
+    double expected[4];
+    double q[4];
+    SlerpSegment segment;
+
+    quaternion_exp(rotvec, step);
+    quaternion_exp(half_rotvec, half_step);
+    quaternion_multiply(start, step, end);
+    quaternion_multiply(start, half_step, expected);
+
+    if (!slerp_segment_init(&segment, start, end) || fabs(segment.theta - 1e-9) > 1e-22) {
+        printf("FAIL: small-angle segment theta %.17g\n", segment.theta);
+        return 0;
+    }
+    slerp_segment_eval(&segment, 0.5, q);
+    if (max_difference(q, expected) > 2e-16) {
+        printf("FAIL: small-angle midpoint off by %.3e\n", max_difference(q, expected));
+        return 0;
+    }
+
+    /* Identical endpoints give a zero-length segment that evaluates to the endpoint. */
+    if (!slerp_segment_init(&segment, start, start) || segment.theta != 0.0) {
+        printf("FAIL: identical endpoints\n");
+        return 0;
+    }
+    slerp_segment_eval(&segment, 0.3, q);
+    if (max_difference(q, start) != 0.0) {
+        printf("FAIL: zero-length segment moved\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_sample_recurrence(void) {
+    const double q1[4] = {0.5, 0.5, -0.5, 0.5};
+    const double q2[4] = {0.1, -0.7, 0.7, 0.1};
+    const double t_step = 1.0 / (SAMPLE_COUNT - 1);
+    SlerpSegment segment;
+
+    slerp_segment_init(&segment, q1, q2);
+    if (!slerp_segment_sample(&segment, 0.0, t_step, SAMPLE_COUNT, &g_samples[0][0])) {
+        printf("FAIL: slerp_segment_sample rejected valid input\n");
+        return 0;
+    }
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        double expected[4];
+        slerp_segment_eval(&segment, i * t_step, expected);
+        if (max_difference(g_samples[i], expected) > 2e-15 || norm_error(g_samples[i]) > 2e-15) {
+            printf("FAIL: recurrence sample %d drifted by %.3e\n", i, max_difference(g_samples[i], expected));
+            return 0;
+        }
+    }
+
+    /* Arbitrary-t batch is the single-sample call in a loop. */
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        g_t[i] = 1.5 * sin(0.37 * i);
+    }
+    if (!slerp_segment_eval_batch(&segment, g_t, SAMPLE_COUNT, &g_samples[0][0])) {
+        printf("FAIL: slerp_segment_eval_batch rejected valid input\n");
+        return 0;
+    }
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        double expected[4];
+        slerp_segment_eval(&segment, g_t[i], expected);
+        if (memcmp(expected, g_samples[i], sizeof(expected)) != 0) {
+            printf("FAIL: slerp_segment_eval_batch differs at %d\n", i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_upsample(void) {
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        /* Alternate signs so the upsampler has to keep the output stream continuous. */
+        const double sign = (key % 3 == 1) ? -1.0 : 1.0;
+        g_keys[key][0] = sign * cos(0.2 * key);
+        g_keys[key][1] = sign * sin(0.2 * key) * 0.6;
+        g_keys[key][2] = sign * sin(0.2 * key) * 0.8 * cos(0.5 * key);
+        g_keys[key][3] = sign * sin(0.2 * key) * 0.8 * sin(0.5 * key);
+        for (int c = 0; c < 4; ++c) {
+            g_keysf[key][c] = (float)g_keys[key][c];
+        }
+    }
+    if (!slerp_upsample(&g_keys[0][0], KEY_COUNT, UPSAMPLE_FACTOR, &g_output[0][0])) {
+        printf("FAIL: slerp_upsample rejected valid keyframes\n");
+        return 0;
+    }
+
+    for (int i = 0; i < OUTPUT_COUNT; ++i) {
+        const int key = i / UPSAMPLE_FACTOR;
+        double expected[4];
+        if (i > 0) {
+            const double *a = g_output[i - 1];
+            const double *b = g_output[i];
+            if (a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3] < 0.9) {
+                printf("FAIL: slerp_upsample output flips or jumps at %d\n", i);
+                return 0;
+            }
+        }
+        if (key == KEY_COUNT - 1) {
+            memcpy(expected, g_keys[key], sizeof(expected));
+        } else {
+            quaternion_slerp(g_keys[key], g_keys[key + 1], (double)(i % UPSAMPLE_FACTOR) / UPSAMPLE_FACTOR, expected);
+        }
+        /* Compare as rotations: the upsampler may return -expected. */
+        const double dot = g_output[i][0] * expected[0] + g_output[i][1] * expected[1] +
+                           g_output[i][2] * expected[2] + g_output[i][3] * expected[3];
+        if (fabs(fabs(dot) - 1.0) > 1e-14) {
+            printf("FAIL: slerp_upsample sample %d differs from quaternion_slerp\n", i);
+            return 0;
+        }
+    }
+
+    if (!slerpf_upsample(&g_keysf[0][0], KEY_COUNT, UPSAMPLE_FACTOR, &g_outputf[0][0])) {
+        printf("FAIL: slerpf_upsample rejected valid keyframes\n");
+        return 0;
+    }
+    for (int i = 0; i < OUTPUT_COUNT; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            if (fabs(g_outputf[i][c] - g_output[i][c]) > 1e-6) {
+                printf("FAIL: slerpf_upsample sample %d component %d\n", i, c);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double q[4] = {1.0, 0.0, 0.0, 0.0};
+    const double zero[4] = {0.0, 0.0, 0.0, 0.0};
+    const double bad[4] = {1.0, INFINITY, 0.0, 0.0};
+    const double keys[8] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double out[12];
+    SlerpSegment segment;
+
+    if (slerp_segment_init(NULL, q, q) || slerp_segment_init(&segment, zero, q) ||
+        slerp_segment_init(&segment, q, bad) || !slerp_segment_init(&segment, q, q) ||
+        slerp_segment_sample(&segment, 0.0, NAN, 2, out) || slerp_segment_sample(&segment, 0.0, 0.1, 2, NULL) ||
+        slerp_segment_eval_batch(&segment, NULL, 2, out) || slerp_upsample(keys, 2, 0, out) ||
+        slerp_upsample(keys, 2, 1, out) || !slerp_upsample(NULL, 0, 1, NULL)) {
+        printf("FAIL: SLERP segment argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_matches_quaternion_slerp() || !check_small_angle() || !check_sample_recurrence() ||
+        !check_upsample() || !check_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: precomputed SLERP segments\n");
+    return 0;
+}
@@ -0,0 +1,344 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/spline.h"
+
+#define KEY_COUNT 9
+#define SAMPLE_COUNT 400
+
+static double g_times[KEY_COUNT];
+static double g_keys[KEY_COUNT][4];
+static double g_storage[QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT)];
+static float g_storagef[QUATERNION_SPLINE_STORAGE_DOUBLES(KEY_COUNT)];
+static double g_t[SAMPLE_COUNT];
+static double g_q[SAMPLE_COUNT][4];
+static double g_omega[SAMPLE_COUNT][3];
+static double g_alpha[SAMPLE_COUNT][3];
+
+static const QuaternionSplineType k_types[] = {
+    QUATERNION_SPLINE_SQUAD, QUATERNION_SPLINE_HERMITE, QUATERNION_SPLINE_BSPLINE
+};
+static const char *const k_type_names[] = {"SQUAD", "Hermite", "B-spline"};
+
+/* Rotation angle between two orientations, insensitive to sign. */
+static double rotation_error(const double a[4], const double b[4]) {
+    const double d[4] = {a[0] - b[0], a[1] - b[1], a[2] - b[2], a[3] - b[3]};
+    const double s[4] = {a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]};
+    const double nd = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3]);
+    const double ns = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2] + s[3] * s[3]);
+    return 4.0 * atan2(fmin(nd, ns), fmax(nd, ns));
+}
+
+static double vector_difference(const double a[3], const double b[3]) {
+    return fmax(fabs(a[0] - b[0]), fmax(fabs(a[1] - b[1]), fabs(a[2] - b[2])));
+}
+
+/* Unevenly spaced keyframes on a wandering trajectory, with a sign flip thrown in. */
+static void make_keyframes(void) {
+    double t = 0.0;
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        const double rotvec[3] = {0.4 * sin(0.9 * t), 0.7 * cos(0.6 * t) - 0.2, 0.5 * t};
+        quaternion_exp(rotvec, g_keys[key]);
+        if (key == 4) {
+            for (int i = 0; i < 4; ++i) {
+                g_keys[key][i] = -2.0 * g_keys[key][i];
+            }
+        }
+        g_times[key] = t;
+        t += 0.3 + 0.25 * (key % 3);
+    }
+}
+
+static int check_interpolates_keyframes(void) {
+    QuaternionSpline spline;
+    for (int type = 0; type < 2; ++type) {
+        if (!quaternion_spline_init(&spline, k_types[type], g_times, &g_keys[0][0], KEY_COUNT, g_storage,
+                                    sizeof(g_storage) / sizeof(g_storage[0]))) {
+            printf("FAIL: %s spline rejected valid keyframes\n", k_type_names[type]);
+            return 0;
+        }
+        for (int key = 0; key < KEY_COUNT; ++key) {
+            double expected[4];
+            double q[4];
+            memcpy(expected, g_keys[key], sizeof(expected));
+            quaternion_normalize(expected);
+            quaternion_spline_eval(&spline, g_times[key], q, NULL, NULL);
+            if (rotation_error(q, expected) > 1e-14) {
+                printf("FAIL: %s spline misses keyframe %d by %.3e rad\n", k_type_names[type], key,
+                       rotation_error(q, expected));
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_derivatives(void) {
+    QuaternionSpline spline;
+    const double step = 1e-5;
+    for (int type = 0; type < 3; ++type) {
+        quaternion_spline_init(&spline, k_types[type], g_times, &g_keys[0][0], KEY_COUNT, g_storage,
+                               sizeof(g_storage) / sizeof(g_storage[0]));
+        for (int key = 0; key + 1 < KEY_COUNT; ++key) {
+            const double t = g_times[key] + 0.37 * (g_times[key + 1] - g_times[key]);
+            double q[4];
+            double q_minus[4];
+            double q_plus[4];
+            double omega[3];
+            double alpha[3];
+            double omega_minus[3];
+            double omega_plus[3];
+            quaternion_spline_eval(&spline, t, q, omega, alpha);
+            quaternion_spline_eval(&spline, t - step, q_minus, omega_minus, NULL);
+            quaternion_spline_eval(&spline, t + step, q_plus, omega_plus, NULL);
+
+            /* omega = 2 vec(q* q'), alpha = d omega / dt, both by central differences. */
+            double q_conj[4];
+            double dq[4];
+            double rate[4];
+            double omega_fd[3];
+            double alpha_fd[3];
+            quaternion_inverse(q, q_conj);
+            for (int i = 0; i < 4; ++i) {
+                dq[i] = (q_plus[i] - q_minus[i]) / (2.0 * step);
+            }
+            quaternion_multiply(q_conj, dq, rate);
+            for (int i = 0; i < 3; ++i) {
+                omega_fd[i] = 2.0 * rate[i + 1];
+                alpha_fd[i] = (omega_plus[i] - omega_minus[i]) / (2.0 * step);
+            }
+            if (vector_difference(omega, omega_fd) > 1e-8 || vector_difference(alpha, alpha_fd) > 1e-6) {
+                printf("FAIL: %s derivatives in segment %d: omega %.3e alpha %.3e\n", k_type_names[type], key,
+                       vector_difference(omega, omega_fd), vector_difference(alpha, alpha_fd));
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_continuity(void) {
+    QuaternionSpline spline;
+    double times[KEY_COUNT];
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        times[key] = 0.5 * key;
+    }
+
+    for (int type = 0; type < 3; ++type) {
+        /* Hermite is C1 on any spacing; SQUAD and the B-spline need even spacing. */
+        const double *knots = k_types[type] == QUATERNION_SPLINE_HERMITE ? g_times : times;
+        quaternion_spline_init(&spline, k_types[type], knots, &g_keys[0][0], KEY_COUNT, g_storage,
+                               sizeof(g_storage) / sizeof(g_storage[0]));
+        for (int key = 1; key + 1 < KEY_COUNT; ++key) {
+            const double eps = 1e-9;
+            double q[2][4];
+            double omega[2][3];
+            double alpha[2][3];
+            quaternion_spline_eval(&spline, knots[key] - eps, q[0], omega[0], alpha[0]);
+            quaternion_spline_eval(&spline, knots[key] + eps, q[1], omega[1], alpha[1]);
+            if (vector_difference(omega[0], omega[1]) > 1e-7) {
+                printf("FAIL: %s angular velocity jumps by %.3e at knot %d\n", k_type_names[type],
+                       vector_difference(omega[0], omega[1]), key);
+                return 0;
+            }
+            if (k_types[type] == QUATERNION_SPLINE_BSPLINE && vector_difference(alpha[0], alpha[1]) > 1e-6) {
+                printf("FAIL: B-spline angular acceleration jumps by %.3e at knot %d\n",
+                       vector_difference(alpha[0], alpha[1]), key);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_constant_rate(void) {
+    /* Keyframes sampled from a constant body rate: every family reproduces it exactly. */
+    const double omega_true[3] = {0.3, -0.8, 1.1};
+    const double dt = 0.2;
+    double keys[KEY_COUNT][4];
+    double times[KEY_COUNT];
+    QuaternionSpline spline;
+
+    keys[0][0] = 0.5;
+    keys[0][1] = 0.5;
+    keys[0][2] = -0.5;
+    keys[0][3] = 0.5;
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        const double rotvec[3] = {omega_true[0] * dt, omega_true[1] * dt, omega_true[2] * dt};
+        double step[4];
+        times[key] = dt * key;
+        if (key > 0) {
+            quaternion_exp(rotvec, step);
+            quaternion_multiply(keys[key - 1], step, keys[key]);
+        }
+    }
+
+    for (int type = 0; type < 3; ++type) {
+        quaternion_spline_init(&spline, k_types[type], times, &keys[0][0], KEY_COUNT, g_storage,
+                               sizeof(g_storage) / sizeof(g_storage[0]));
+        /* The B-spline repeats its end control points, so only its interior is rigid. */
+        const double start = k_types[type] == QUATERNION_SPLINE_BSPLINE ? times[1] : times[0];
+        const double end = k_types[type] == QUATERNION_SPLINE_BSPLINE ? times[KEY_COUNT - 2] : times[KEY_COUNT - 1];
+        for (int i = 0; i <= 50; ++i) {
+            const double t = start + (end - start) * i / 50.0;
+            double q[4];
+            double omega[3];
+            double alpha[3];
+            const double zero[3] = {0.0, 0.0, 0.0};
+            quaternion_spline_eval(&spline, t, q, omega, alpha);
+            if (vector_difference(omega, omega_true) > 1e-12 || vector_difference(alpha, zero) > 1e-11) {
+                printf("FAIL: %s constant-rate track off by omega %.3e alpha %.3e at t=%g\n", k_type_names[type],
+                       vector_difference(omega, omega_true), vector_difference(alpha, zero), t);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_hermite_rates(void) {
+    double omegas[KEY_COUNT][3];
+    QuaternionSpline spline;
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        omegas[key][0] = 0.5 * sin(key);
+        omegas[key][1] = -0.3 + 0.1 * key;
+        omegas[key][2] = 0.8 * cos(2.0 * key);
+    }
+    if (!quaternion_spline_init_hermite(&spline, g_times, &g_keys[0][0], &omegas[0][0], KEY_COUNT, g_storage,
+                                        sizeof(g_storage) / sizeof(g_storage[0]))) {
+        printf("FAIL: quaternion_spline_init_hermite rejected valid input\n");
+        return 0;
+    }
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        double expected[4];
+        double q[4];
+        double omega[3];
+        memcpy(expected, g_keys[key], sizeof(expected));
+        quaternion_normalize(expected);
+        quaternion_spline_eval(&spline, g_times[key], q, omega, NULL);
+        if (rotation_error(q, expected) > 1e-14 || vector_difference(omega, omegas[key]) > 1e-13) {
+            printf("FAIL: Hermite keyframe %d rate off by %.3e\n", key, vector_difference(omega, omegas[key]));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_batch(void) {
+    QuaternionSpline spline;
+    const double span = g_times[KEY_COUNT - 1] - g_times[0];
+    quaternion_spline_init(&spline, QUATERNION_SPLINE_SQUAD, g_times, &g_keys[0][0], KEY_COUNT, g_storage,
+                           sizeof(g_storage) / sizeof(g_storage[0]));
+
+    /* Ascending with clamped ends, then a scrambled tail that forces the binary search. */
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        g_t[i] = i < SAMPLE_COUNT / 2 ? -0.1 + (span + 0.2) * i / (SAMPLE_COUNT / 2 - 1)
+                                      : g_times[0] + span * (0.5 + 0.5 * sin(1.7 * i));
+    }
+    if (!quaternion_spline_eval_batch(&spline, g_t, SAMPLE_COUNT, &g_q[0][0], &g_omega[0][0], &g_alpha[0][0])) {
+        printf("FAIL: quaternion_spline_eval_batch rejected valid input\n");
+        return 0;
+    }
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        double q[4];
+        double omega[3];
+        double alpha[3];
+        quaternion_spline_eval(&spline, g_t[i], q, omega, alpha);
+        if (memcmp(q, g_q[i], sizeof(q)) != 0 || memcmp(omega, g_omega[i], sizeof(omega)) != 0 ||
+            memcmp(alpha, g_alpha[i], sizeof(alpha)) != 0) {
+            printf("FAIL: quaternion_spline_eval_batch differs at %d\n", i);
+            return 0;
+        }
+    }
+
+    /* A NaN timestamp poisons only its own sample. */
+    g_t[3] = NAN;
+    if (quaternion_spline_eval_batch(&spline, g_t, 5, &g_q[0][0], NULL, NULL) || !isnan(g_q[3][0]) ||
+        isnan(g_q[4][0])) {
+        printf("FAIL: quaternion_spline_eval_batch NaN handling\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    float times[KEY_COUNT];
+    float keys[KEY_COUNT][4];
+    QuaternionSpline spline;
+    QuaternionSplinef splinef;
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        times[key] = (float)g_times[key];
+        for (int i = 0; i < 4; ++i) {
+            keys[key][i] = (float)g_keys[key][i];
+        }
+    }
+
+    for (int type = 0; type < 3; ++type) {
+        quaternion_spline_init(&spline, k_types[type], g_times, &g_keys[0][0], KEY_COUNT, g_storage,
+                               sizeof(g_storage) / sizeof(g_storage[0]));
+        if (!quaternionf_spline_init(&splinef, k_types[type], times, &keys[0][0], KEY_COUNT, g_storagef,
+                                     sizeof(g_storagef) / sizeof(g_storagef[0]))) {
+            printf("FAIL: quaternionf_spline_init rejected %s keyframes\n", k_type_names[type]);
+            return 0;
+        }
+        for (int i = 0; i <= 40; ++i) {
+            const double t = g_times[KEY_COUNT - 1] * i / 40.0;
+            double q[4];
+            double omega[3];
+            float qf[4];
+            float omegaf[3];
+            quaternion_spline_eval(&spline, t, q, omega, NULL);
+            quaternionf_spline_eval(&splinef, (float)t, qf, omegaf, NULL);
+            for (int c = 0; c < 4; ++c) {
+                if (fabs(qf[c] - q[c]) > 2e-6 || (c < 3 && fabs(omegaf[c] - omega[c]) > 2e-5)) {
+                    printf("FAIL: float %s spline differs at t=%g\n", k_type_names[type], t);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double times[3] = {0.0, 1.0, 1.0};
+    const double bad_times[3] = {0.0, NAN, 2.0};
+    const double keys[12] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    const double zero_key[12] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    const double ok_times[3] = {0.0, 1.0, 2.0};
+    const double bad_omegas[9] = {0.0, 0.0, 0.0, INFINITY, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double storage[QUATERNION_SPLINE_STORAGE_DOUBLES(3)];
+    double q[4];
+    QuaternionSpline spline;
+    const size_t size = sizeof(storage) / sizeof(storage[0]);
+
+    if (quaternion_spline_init(NULL, QUATERNION_SPLINE_SQUAD, ok_times, keys, 3, storage, size) ||
+        quaternion_spline_init(&spline, QUATERNION_SPLINE_SQUAD, ok_times, keys, 1, storage, size) ||
+        quaternion_spline_init(&spline, QUATERNION_SPLINE_SQUAD, ok_times, keys, 3, storage, size - 1) ||
+        quaternion_spline_init(&spline, (QuaternionSplineType)7, ok_times, keys, 3, storage, size) ||
+        quaternion_spline_init(&spline, QUATERNION_SPLINE_SQUAD, times, keys, 3, storage, size) ||
+        quaternion_spline_init(&spline, QUATERNION_SPLINE_SQUAD, bad_times, keys, 3, storage, size) ||
+        quaternion_spline_init(&spline, QUATERNION_SPLINE_HERMITE, ok_times, zero_key, 3, storage, size) ||
+        quaternion_spline_init_hermite(&spline, ok_times, keys, bad_omegas, 3, storage, size) ||
+        !quaternion_spline_init(&spline, QUATERNION_SPLINE_BSPLINE, ok_times, keys, 2, storage, size) ||
+        quaternion_spline_eval(&spline, NAN, q, NULL, NULL) || quaternion_spline_eval(&spline, 0.5, NULL, NULL, NULL) ||
+        quaternion_spline_eval_batch(&spline, NULL, 2, q, NULL, NULL) ||
+        !quaternion_spline_eval_batch(&spline, NULL, 0, NULL, NULL, NULL)) {
+        printf("FAIL: spline argument checks\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    make_keyframes();
+    if (!check_interpolates_keyframes() || !check_derivatives() || !check_continuity() || !check_constant_rate() ||
+        !check_hermite_rates() || !check_batch() || !check_float() || !check_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: quaternion splines\n");
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "attitude/quaternion.h"
+#include "attitude/wahba.h"
+
+#define MAX_PAIRS 16
+
+typedef int (*WahbaSolver)(const double *, const double *, const double *, size_t, double[4], double[3][3]);
+
+static const WahbaSolver k_solvers[] = {wahba_quest, wahba_esoq2, wahba_davenport, wahba_svd};
+static const char *const k_solver_names[] = {"QUEST", "ESOQ2", "Davenport", "SVD"};
+#define SOLVER_COUNT (sizeof(k_solvers) / sizeof(k_solvers[0]))
+
+static unsigned int g_seed = 12345u;
+
+static double random_unit(void) {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (double)(g_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/* Rotation angle between two orientations, insensitive to sign. */
+static double rotation_error(const double a[4], const double b[4]) {
+    const double d[4] = {a[0] - b[0], a[1] - b[1], a[2] - b[2], a[3] - b[3]};
+    const double s[4] = {a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]};
+    const double nd = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3]);
+    const double ns = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2] + s[3] * s[3]);
+    return 4.0 * atan2(fmin(nd, ns), fmax(nd, ns));
+}
+
+/* Reference directions with random lengths, and their images under q plus optional noise. */
+static void make_pairs(const double q[4], size_t count, double noise, double *observed, double *reference) {
+    for (size_t i = 0; i < count; ++i) {
+        double r[3] = {random_unit(), random_unit(), random_unit()};
+        const double length = sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+        const double scale = (1.0 + 2.0 * (double)i) / length;
+        for (int k = 0; k < 3; ++k) {
+            r[k] *= scale;
+            reference[3 * i + k] = r[k];
+        }
+        quaternion_rotate_vector(q, r, &observed[3 * i]);
+        for (int k = 0; k < 3; ++k) {
+            observed[3 * i + k] = observed[3 * i + k] / scale + noise * random_unit();
+        }
+    }
+}
+
+static int check_noise_free(void) {
+    /* Identity, a tiny angle, generic attitudes and exact half-turns about several axes. */
+    const double rotvecs[][3] = {
+        {0.0, 0.0, 0.0}, {1e-7, -2e-7, 3e-8}, {0.3, -0.5, 0.9}, {-1.2, 0.4, 2.0},
+        {M_PI, 0.0, 0.0}, {0.0, M_PI, 0.0}, {0.0, 0.0, -M_PI}, {M_PI / sqrt(3.0), M_PI / sqrt(3.0), M_PI / sqrt(3.0)},
+        {3.1, 0.1, -0.05}
+    };
+    const size_t counts[] = {2, 3, 7, MAX_PAIRS};
+
+    for (unsigned int a = 0; a < sizeof(rotvecs) / sizeof(rotvecs[0]); ++a) {
+        double q_true[4];
+        quaternion_exp(rotvecs[a], q_true);
+        for (unsigned int c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+            double observed[3 * MAX_PAIRS];
+            double reference[3 * MAX_PAIRS];
+            make_pairs(q_true, counts[c], 0.0, observed, reference);
+            for (unsigned int s = 0; s < SOLVER_COUNT; ++s) {
+                double q[4];
+                if (!k_solvers[s](observed, reference, NULL, counts[c], q, NULL)) {
+                    printf("FAIL: %s rejected attitude %u with %zu pairs\n", k_solver_names[s], a, counts[c]);
+                    return 0;
+                }
+                const double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+                if (rotation_error(q, q_true) > 2e-14 || fabs(norm - 1.0) > 4e-16 || q[0] < 0.0) {
+                    printf("FAIL: %s attitude %u with %zu pairs off by %.3e rad\n", k_solver_names[s], a, counts[c],
+                           rotation_error(q, q_true));
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static double wahba_loss(const double q[4], const double *observed, const double *reference, const double *weights,
+                         size_t count) {
+    double loss = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const double *b = observed + 3 * i;
+        const double *r = reference + 3 * i;
+        const double nb = sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2]);
+        const double nr = sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+        double rotated[3];
+        quaternion_rotate_vector(q, r, rotated);
+        for (int k = 0; k < 3; ++k) {
+            const double d = b[k] / nb - rotated[k] / nr;
+            loss += 0.5 * weights[i] * d * d;
+        }
+    }
+    return loss;
+}
+
+static int check_noisy_agreement(void) {
+    for (int trial = 0; trial < 200; ++trial) {
+        const size_t count = 2 + (size_t)trial % (MAX_PAIRS - 1);
+        const double rotvec[3] = {3.0 * random_unit(), 3.0 * random_unit(), 3.0 * random_unit()};
+        double q_true[4];
+        double observed[3 * MAX_PAIRS];
+        double reference[3 * MAX_PAIRS];
+        double weights[MAX_PAIRS];
+        double q_ref[4];
+        quaternion_exp(rotvec, q_true);
+        make_pairs(q_true, count, 1e-3, observed, reference);
+        for (size_t i = 0; i < count; ++i) {
+            weights[i] = 1.5 + random_unit();
+        }
+
+        wahba_davenport(observed, reference, weights, count, q_ref, NULL);
+        const double loss_ref = wahba_loss(q_ref, observed, reference, weights, count);
+        for (unsigned int s = 0; s < SOLVER_COUNT; ++s) {
+            double q[4];
+            k_solvers[s](observed, reference, weights, count, q, NULL);
+            if (rotation_error(q, q_ref) > 1e-10) {
+                printf("FAIL: %s disagrees with Davenport by %.3e rad on trial %d\n", k_solver_names[s],
+                       rotation_error(q, q_ref), trial);
+                return 0;
+            }
+        }
+
+        /* The optimum beats small perturbations of itself. */
+        for (int k = 0; k < 3; ++k) {
+            double nudge[3] = {0.0, 0.0, 0.0};
+            double dq[4];
+            double q[4];
+            nudge[k] = 1e-4;
+            quaternion_exp(nudge, dq);
+            quaternion_multiply(dq, q_ref, q);
+            if (wahba_loss(q, observed, reference, weights, count) < loss_ref) {
+                printf("FAIL: Davenport solution is not a minimum on trial %d\n", trial);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int check_covariance(void) {
+    /* Two orthogonal unit observations along x and y with sigmas 1e-3 and 2e-3 rad. */
+    const double q_true[4] = {0.5, 0.5, 0.5, 0.5};
+    const double reference[6] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+    const double weights[2] = {1e6, 0.25e6};
+    double observed[6];
+    quaternion_rotate_vector(q_true, &reference[0], &observed[0]);
+    quaternion_rotate_vector(q_true, &reference[3], &observed[3]);
+
+    /* Body-frame information sum a (I - b b^T), inverted by hand for this geometry. */
+    double info[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            info[i][j] = (i == j ? weights[0] + weights[1] : 0.0) - weights[0] * observed[i] * observed[j] -
+                         weights[1] * observed[3 + i] * observed[3 + j];
+        }
+    }
+
+    for (unsigned int s = 0; s < SOLVER_COUNT; ++s) {
+        double q[4];
+        double covariance[3][3];
+        if (!k_solvers[s](observed, reference, weights, 2, q, covariance)) {
+            printf("FAIL: %s rejected covariance geometry\n", k_solver_names[s]);
+            return 0;
+        }
+        /* P * info must be the identity. */
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                const double product = covariance[i][0] * info[0][j] + covariance[i][1] * info[1][j] +
+                                       covariance[i][2] * info[2][j];
+                if (fabs(product - (i == j ? 1.0 : 0.0)) > 1e-9 || covariance[i][j] != covariance[j][i]) {
+                    printf("FAIL: %s covariance is not the inverse information matrix\n", k_solver_names[s]);
+                    return 0;
+                }
+            }
+        }
+        /* q_true maps reference x, y to body y, z, so both observations constrain rotation about body x. */
+        const double expected_xx = 1.0 / (weights[0] + weights[1]);
+        if (fabs(covariance[0][0] - expected_xx) > 1e-18) {
+            printf("FAIL: %s roll variance %.6e, expected %.6e\n", k_solver_names[s], covariance[0][0], expected_xx);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_float(void) {
+    const double rotvec[3] = {0.7, -2.2, 1.4};
+    double q_true[4];
+    double observed[3 * 6];
+    double reference[3 * 6];
+    float observedf[3 * 6];
+    float referencef[3 * 6];
+    quaternion_exp(rotvec, q_true);
+    make_pairs(q_true, 6, 0.0, observed, reference);
+    for (int i = 0; i < 18; ++i) {
+        observedf[i] = (float)observed[i];
+        referencef[i] = (float)reference[i];
+    }
+
+    int (*const solvers[])(const float *, const float *, const float *, size_t, float[4], float[3][3]) = {
+        wahbaf_quest, wahbaf_esoq2, wahbaf_davenport, wahbaf_svd
+    };
+    for (unsigned int s = 0; s < SOLVER_COUNT; ++s) {
+        float qf[4];
+        float covariance[3][3];
+        if (!solvers[s](observedf, referencef, NULL, 6, qf, covariance)) {
+            printf("FAIL: float %s rejected valid input\n", k_solver_names[s]);
+            return 0;
+        }
+        const double q[4] = {qf[0], qf[1], qf[2], qf[3]};
+        if (rotation_error(q, q_true) > 2e-6 || !(covariance[0][0] > 0.0f)) {
+            printf("FAIL: float %s off by %.3e rad\n", k_solver_names[s], rotation_error(q, q_true));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_rejections(void) {
+    const double reference[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    const double parallel[9] = {1.0, 0.0, 0.0, -2.0, 0.0, 0.0, 3.0, 0.0, 0.0};
+    const double zero[9] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+    const double bad_weights[3] = {1.0, -1.0, 1.0};
+    const double nan_weights[3] = {1.0, NAN, 1.0};
+    double q[4] = {7.0, 7.0, 7.0, 7.0};
+
+    for (unsigned int s = 0; s < SOLVER_COUNT; ++s) {
+        if (k_solvers[s](reference, reference, NULL, 1, q, NULL) ||
+            k_solvers[s](NULL, reference, NULL, 3, q, NULL) || k_solvers[s](reference, NULL, NULL, 3, q, NULL) ||
+            k_solvers[s](reference, reference, NULL, 3, NULL, NULL) ||
+            k_solvers[s](parallel, parallel, NULL, 3, q, NULL) || k_solvers[s](zero, reference, NULL, 3, q, NULL) ||
+            k_solvers[s](reference, reference, bad_weights, 3, q, NULL) ||
+            k_solvers[s](reference, reference, nan_weights, 3, q, NULL) || q[0] != 7.0) {
+            printf("FAIL: %s argument checks\n", k_solver_names[s]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    if (!check_noise_free() || !check_noisy_agreement() || !check_covariance() || !check_float() ||
+        !check_rejections()) {
+        return 1;
+    }
+
+    printf("PASS: Wahba solvers\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Convert attitude logs between CSV and the binary format of include/attitude/attitude_log.h.
+ *
+ * CSV files start with a header line, "t,qw,qx,qy,qz" or "t,qw,qx,qy,qz,wx,wy,wz" when the
+ * records carry a body rate, followed by one record per line. Values are written with 17
+ * significant digits, so CSV -> binary -> CSV reproduces the values exactly (byte-identical
+ * for %.17g input).
+ */
+#include "attitude/attitude_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_BYTES 1024
+/* 64 KiB of buffered records per block, as a logger on the vehicle might use. */
+#define BLOCK_BYTES (64u * 1024u)
+
+static const char k_header[] = "t,qw,qx,qy,qz";
+static const char k_header_rate[] = "t,qw,qx,qy,qz,wx,wy,wz";
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "Usage: %s to-bin INPUT.csv OUTPUT.alog\n"
+            "       %s to-csv INPUT.alog OUTPUT.csv\n"
+            "\n"
+            "CSV header: %s, or %s with body rates.\n",
+            program, program, k_header, k_header_rate);
+}
+
+static void strip_newline(char *line) {
+    line[strcspn(line, "\r\n")] = '\0';
+}
+
+/* Parses exactly @p count comma-separated numbers covering the whole line. */
+static int parse_fields(const char *line, double *values, int count) {
+    const char *p = line;
+    for (int i = 0; i < count; ++i) {
+        char *end = NULL;
+        values[i] = strtod(p, &end);
+        if (end == p || *end != (i + 1 < count ? ',' : '\0')) {
+            return 0;
+        }
+        p = end + 1;
+    }
+    return 1;
+}
+
+static int csv_to_bin(const char *input, const char *output) {
+    FILE *in = fopen(input, "r");
+    if (in == NULL) {
+        perror(input);
+        return 1;
+    }
+    char line[LINE_BYTES];
+    if (fgets(line, sizeof(line), in) == NULL) {
+        fprintf(stderr, "%s: empty file\n", input);
+        fclose(in);
+        return 1;
+    }
+    strip_newline(line);
+    uint32_t flags;
+    if (strcmp(line, k_header) == 0) {
+        flags = 0;
+    } else if (strcmp(line, k_header_rate) == 0) {
+        flags = ATTITUDE_LOG_HAS_RATE;
+    } else {
+        fprintf(stderr, "%s:1: expected header \"%s\" or \"%s\"\n", input, k_header, k_header_rate);
+        fclose(in);
+        return 1;
+    }
+
+    static unsigned char block[BLOCK_BYTES];
+    AttitudeLogWriter writer;
+    if (!attitude_log_writer_open_file(&writer, output, flags, block, sizeof(block))) {
+        perror(output);
+        fclose(in);
+        return 1;
+    }
+    const int fields = (flags & ATTITUDE_LOG_HAS_RATE) ? 8 : 5;
+    int status = 0;
+    for (unsigned long number = 2; fgets(line, sizeof(line), in) != NULL; ++number) {
+        strip_newline(line);
+        if (line[0] == '\0') {
+            continue;
+        }
+        double values[8];
+        if (!parse_fields(line, values, fields)) {
+            fprintf(stderr, "%s:%lu: expected %d comma-separated numbers\n", input, number, fields);
+            status = 1;
+            break;
+        }
+        if (!attitude_log_writer_append(&writer, values[0], values + 1, values + 5)) {
+            fprintf(stderr, "%s: write failed\n", output);
+            status = 1;
+            break;
+        }
+    }
+    if (!attitude_log_writer_close(&writer) && status == 0) {
+        fprintf(stderr, "%s: write failed\n", output);
+        status = 1;
+    }
+    fclose(in);
+    return status;
+}
+
+/* Falls back to reading the file into memory where the library was built without mmap. */
+static int open_log(AttitudeLogReader *reader, const char *path, void **storage) {
+    *storage = NULL;
+    if (attitude_log_reader_open_file(reader, path)) {
+        return 1;
+    }
+    FILE *in = fopen(path, "rb");
+    if (in == NULL) {
+        perror(path);
+        return 0;
+    }
+    long size = -1;
+    if (fseek(in, 0, SEEK_END) == 0) {
+        size = ftell(in);
+    }
+    rewind(in);
+    void *data = size > 0 ? malloc((size_t)size) : NULL;
+    int ok = data != NULL && fread(data, 1, (size_t)size, in) == (size_t)size &&
+             attitude_log_reader_open_memory(reader, data, (size_t)size);
+    fclose(in);
+    if (!ok) {
+        free(data);
+        fprintf(stderr, "%s: not an attitude log\n", path);
+        return 0;
+    }
+    *storage = data;
+    return 1;
+}
+
+static int bin_to_csv(const char *input, const char *output) {
+    AttitudeLogReader reader;
+    void *storage;
+    if (!open_log(&reader, input, &storage)) {
+        return 1;
+    }
+    FILE *out = fopen(output, "w");
+    if (out == NULL) {
+        perror(output);
+        attitude_log_reader_close(&reader);
+        free(storage);
+        return 1;
+    }
+    const int has_rate = (reader.flags & ATTITUDE_LOG_HAS_RATE) != 0;
+    fprintf(out, "%s\n", has_rate ? k_header_rate : k_header);
+    AttitudeLogBlock block;
+    unsigned long records = 0;
+    while (attitude_log_reader_next(&reader, &block)) {
+        for (size_t i = 0; i < block.count; ++i) {
+            const double *q = block.quaternions + 4 * i;
+            fprintf(out, "%.17g,%.17g,%.17g,%.17g,%.17g", block.timestamps[i], q[0], q[1], q[2], q[3]);
+            if (has_rate) {
+                const double *w = block.rates + 3 * i;
+                fprintf(out, ",%.17g,%.17g,%.17g", w[0], w[1], w[2]);
+            }
+            fputc('\n', out);
+        }
+        records += block.count;
+    }
+    int status = 0;
+    if (reader.damaged) {
+        fprintf(stderr, "%s: truncated or corrupt block after %lu records\n", input, records);
+        status = 1;
+    }
+    if (fclose(out) != 0) {
+        perror(output);
+        status = 1;
+    }
+    attitude_log_reader_close(&reader);
+    free(storage);
+    return status;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && strcmp(argv[1], "to-bin") == 0) {
+        return csv_to_bin(argv[2], argv[3]);
+    }
+    if (argc == 4 && strcmp(argv[1], "to-csv") == 0) {
+        return bin_to_csv(argv[2], argv[3]);
+    }
+    usage(argv[0]);
+    return 2;
+}